@@ -1,15 +1,40 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
+import esphome.final_validate as fv
 from esphome.components import light
-from esphome.const import CONF_ID
+from esphome.components.esp32 import add_idf_sdkconfig_option
+from esphome.const import (
+    CONF_CODE,
+    CONF_COLOR,
+    CONF_COLORS,
+    CONF_DURATION,
+    CONF_HOURS,
+    CONF_ID,
+    CONF_MINUTES,
+    CONF_NAME,
+    CONF_PATH,
+    CONF_PORT,
+    CONF_PROTOCOL,
+    CONF_TIMEOUT,
+    PLATFORM_ESP32,
+    PLATFORM_HOST,
+)
+from esphome.core import CORE
 
 DEPENDENCIES = ["time", "light", "wifi"]
-AUTO_LOAD = ["light", "switch", "select", "number", "button"]
+AUTO_LOAD = ["light", "switch", "select", "number", "button", "socket"]
+MULTI_CONF = True
 
 wordclock_ns = cg.esphome_ns.namespace("wordclock")
 WordClock = wordclock_ns.class_("WordClock", cg.Component)
+PreviewStream = wordclock_ns.class_("PreviewStream", cg.Component)
 
 LightType = wordclock_ns.enum("LightType")
+RenderCommandType = wordclock_ns.enum("RenderCommandType")
+UdpProtocol = wordclock_ns.enum("UdpProtocol")
+UdpInputLayout = wordclock_ns.enum("UdpInputLayout")
+OverlayBlend = wordclock_ns.enum("OverlayBlend")
+PhraseEngine = wordclock_ns.enum("PhraseEngine")
 
 LIGHT_TYPES = {
     "hours": LightType.LIGHT_HOURS,
@@ -23,16 +48,458 @@ CONF_WORDCLOCK_ID = "wordclock_id"
 CONF_NUM_LEDS = "num_leds"
 CONF_TIME_ID = "time_id"
 CONF_STRIP_ID = "strip_id"
+CONF_RENDER_TASK = "render_task"
+CONF_CORE = "core"
+CONF_PRIORITY = "priority"
+CONF_LANGUAGES = "languages"
+CONF_EFFECTS = "effects"
+CONF_BOOT_ANIMATION = "boot_animation"
+CONF_ALLOC_AUDIT = "alloc_audit"
+CONF_PREVIEW = "preview"
+CONF_MAX_FPS = "max_fps"
+CONF_UDP_INPUT = "udp_input"
+CONF_UNIVERSE = "universe"
+CONF_LAYOUT = "layout"
+CONF_EFFECT_PROGRAMS = "effect_programs"
+CONF_PALETTES = "palettes"
+CONF_WORD_COLORS = "word_colors"
+CONF_OVERLAYS = "overlays"
+CONF_MISC = "misc"
+CONF_BLEND = "blend"
+CONF_FLASH = "flash"
+CONF_MARQUEE = "marquee"
+CONF_SPEED = "speed"
+CONF_REPEAT = "repeat"
+CONF_WARM_START = "warm_start"
+CONF_THROTTLE = "throttle"
+CONF_PHRASE_ENGINE = "phrase_engine"
+CONF_OTA = "ota"
+CONF_BUSY_LOOP_TIME = "busy_loop_time"
+CONF_HOLD = "hold"
 
-CONFIG_SCHEMA = cv.Schema(
+# protocol -> (enum, default port)
+UDP_PROTOCOLS = {
+    "ddp": (UdpProtocol.UDP_PROTOCOL_DDP, 4048),
+    "e131": (UdpProtocol.UDP_PROTOCOL_E131, 5568),
+}
+
+# string_keys is a benchmark reference only (phrase_bench.h)
+PHRASE_ENGINES = {
+    "bytecode": PhraseEngine.PHRASE_ENGINE_BYTECODE,
+    "table": PhraseEngine.PHRASE_ENGINE_TABLE,
+}
+
+UDP_LAYOUTS = {
+    "strip": UdpInputLayout.UDP_LAYOUT_STRIP,
+    "rows": UdpInputLayout.UDP_LAYOUT_ROWS,
+}
+
+# Compile-time features: option -> (enum value, select option, define).
+# Enum values match MatrixLanguage / EffectType in wordclock.h.
+LANGUAGES = {
+    "french": (0, "Francais", "USE_WORDCLOCK_LANG_FRENCH"),
+    "english_uk": (1, "English UK", "USE_WORDCLOCK_LANG_ENGLISH_UK"),
+}
+
+EFFECTS = {
+    "rainbow": (1, "Rainbow", "USE_WORDCLOCK_EFFECT_RAINBOW"),
+    "pulse": (2, "Pulse", "USE_WORDCLOCK_EFFECT_PULSE"),
+    "breathe": (3, "Breathe", "USE_WORDCLOCK_EFFECT_BREATHE"),
+    "color_cycle": (4, "Color cycle", "USE_WORDCLOCK_EFFECT_COLOR_CYCLE"),
+}
+
+# Effect programs: select value = EFFECT_PROGRAM + slot. Limits and
+# instruction set mirror effect_vm.h / wordclock_config.h.
+EFFECT_PROGRAM_BASE = 16
+EFFECT_VM_SLOTS = 4
+EFFECT_VM_MAX_INSTRUCTIONS = 32
+EFFECT_VM_MAX_CONSTANTS = 16
+EFFECT_VM_MAX_CYCLES = 128
+
+# opcode -> (sources, cycles)
+VM_OPCODES = {
+    "mov": (1, 1),
+    "add": (2, 1),
+    "sub": (2, 1),
+    "mul": (2, 1),
+    "div": (2, 2),
+    "mad": (2, 1),
+    "min": (2, 1),
+    "max": (2, 1),
+    "lt": (2, 1),
+    "abs": (1, 1),
+    "fract": (1, 2),
+    "sin": (1, 4),
+    "hsv": (2, 8),
+}
+VM_INPUTS = ["x", "y", "i", "n", "t"]
+VM_WRITABLE = ["r", "g", "b"] + [f"s{n}" for n in range(8)]
+
+
+def validate_effect_program(value):
+    """Same checks as EffectVm::stage(), so bad programs fail at compile time."""
+    value = cv.string(value)
+    constants = set()
+    instructions = 0
+    cycles = 0
+    for number, line in enumerate(value.split("\n"), start=1):
+        for statement in line.split("#", 1)[0].split(";"):
+            tokens = statement.replace(",", " ").split()
+            if not tokens:
+                continue
+            where = f"line {number}: {statement.strip()!r}"
+            if tokens[0] not in VM_OPCODES:
+                raise cv.Invalid(f"Unknown instruction, {where}")
+            sources, cost = VM_OPCODES[tokens[0]]
+            if len(tokens) != 2 + sources:
+                raise cv.Invalid(f"Wrong number of operands, {where}")
+            writable = VM_WRITABLE[:9] if tokens[0] == "hsv" else VM_WRITABLE
+            if tokens[1] not in writable:
+                raise cv.Invalid(
+                    f"Destination must be one of {', '.join(writable)}, {where}"
+                )
+            for operand in tokens[2:]:
+                if operand in VM_INPUTS or operand in VM_WRITABLE:
+                    continue
+                try:
+                    if "_" in operand:
+                        raise ValueError
+                    literal = float(operand)
+                except ValueError:
+                    raise cv.Invalid(f"Bad operand {operand!r}, {where}") from None
+                if literal != literal or literal in (float("inf"), float("-inf")):
+                    raise cv.Invalid(f"Bad operand {operand!r}, {where}")
+                constants.add(literal)
+            instructions += 1
+            cycles += cost
+    if instructions > EFFECT_VM_MAX_INSTRUCTIONS:
+        raise cv.Invalid(
+            f"{instructions} instructions, at most {EFFECT_VM_MAX_INSTRUCTIONS}"
+        )
+    if len(constants) > EFFECT_VM_MAX_CONSTANTS:
+        raise cv.Invalid(
+            f"{len(constants)} distinct numbers, at most {EFFECT_VM_MAX_CONSTANTS}"
+        )
+    if cycles > EFFECT_VM_MAX_CYCLES:
+        raise cv.Invalid(f"{cycles} cycles per LED, at most {EFFECT_VM_MAX_CYCLES}")
+    return value
+
+
+EFFECT_PROGRAM_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_NAME): cv.string_strict,
+        # Empty: layer colour until a program is loaded at runtime
+        cv.Optional(CONF_CODE, default=""): validate_effect_program,
+    }
+)
+
+
+# Palettes: select value = EFFECT_PALETTE + index (built-ins first, in the
+# order listed). Stops are (position 0-255, 0xRRGGBB); the last stop blends
+# back into the first.
+EFFECT_PALETTE_BASE = 32
+PALETTE_SLOTS = 8
+PALETTE_MAX_STOPS = 16
+
+PALETTES = {
+    "sunset": (
+        "Sunset",
+        [(0, 0x780000), (60, 0xFF4000), (120, 0xFFAA00), (170, 0xC82850), (220, 0x3C006E)],
+    ),
+    "ocean": (
+        "Ocean",
+        [(0, 0x001450), (80, 0x005AA0), (140, 0x00B4C8), (200, 0x78E6FF), (240, 0x003C78)],
+    ),
+    "forest": (
+        "Forest",
+        [(0, 0x003C00), (90, 0x288C14), (160, 0x78B428), (220, 0x145A1E)],
+    ),
+    "lava": (
+        "Lava",
+        [(0, 0x200000), (70, 0x900000), (130, 0xFF2800), (190, 0xFFA000), (230, 0xFFFF78)],
+    ),
+}
+
+
+def hex_color(value):
+    """'#RRGGBB' or 'RRGGBB' -> 0xRRGGBB"""
+    value = cv.string_strict(value).strip()
+    digits = value[1:] if value.startswith("#") else value
+    if len(digits) != 6:
+        raise cv.Invalid(f"Colour {value!r} must be #RRGGBB")
+    try:
+        return int(digits, 16)
+    except ValueError:
+        raise cv.Invalid(f"Colour {value!r} must be #RRGGBB") from None
+
+
+CUSTOM_PALETTE_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_NAME): cv.string_strict,
+        # Evenly spaced round the cycle
+        cv.Required(CONF_COLORS): cv.All(
+            cv.ensure_list(hex_color), cv.Length(min=2, max=PALETTE_MAX_STOPS)
+        ),
+    }
+)
+
+
+def palette_entry(value):
+    """A built-in palette name or a custom {name, colors} palette."""
+    if isinstance(value, dict):
+        return CUSTOM_PALETTE_SCHEMA(value)
+    return cv.one_of(*PALETTES, lower=True)(value)
+
+
+def palette_name(palette):
+    return palette[CONF_NAME] if isinstance(palette, dict) else PALETTES[palette][1]
+
+
+def palette_stops(palette):
+    """0xPPRRGGBB stops for WordClock::add_palette()"""
+    if isinstance(palette, dict):
+        colors = palette[CONF_COLORS]
+        stops = [(i * 256 // len(colors), color) for i, color in enumerate(colors)]
+    else:
+        stops = PALETTES[palette][1]
+    return [(position << 24) | color for position, color in stops]
+
+
+# Word colours: each slot colours the listed LED map keys (hours layer:
+# start words and hours, e.g. "il", "est", "heure"; minutes layer: minute
+# words). Keys missing from a language are ignored for that language.
+WORD_COLOR_SLOTS = 8
+
+WORD_COLOR_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Required(CONF_COLOR): hex_color,
+            cv.Optional(CONF_HOURS): cv.ensure_list(cv.string_strict),
+            cv.Optional(CONF_MINUTES): cv.ensure_list(cv.string_strict),
+        }
+    ),
+    cv.has_at_least_one_key(CONF_HOURS, CONF_MINUTES),
+)
+
+# Overlays: notification presets shown over the clock (show_overlay()).
+# Keys as for word colours, plus misc keys ("42").
+OVERLAY_PRESETS = 8
+
+OVERLAY_BLENDS = {
+    "replace": OverlayBlend.OVERLAY_REPLACE,
+    "add": OverlayBlend.OVERLAY_ADD,
+    "mix": OverlayBlend.OVERLAY_MIX,
+}
+
+OVERLAY_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Required(CONF_NAME): cv.string_strict,
+            cv.Required(CONF_COLOR): hex_color,
+            cv.Optional(CONF_HOURS): cv.ensure_list(cv.string_strict),
+            cv.Optional(CONF_MINUTES): cv.ensure_list(cv.string_strict),
+            cv.Optional(CONF_MISC): cv.ensure_list(cv.string_strict),
+            cv.Optional(CONF_PRIORITY, default=0): cv.int_range(min=0, max=255),
+            cv.Optional(CONF_DURATION, default="5s"): cv.positive_not_null_time_period,
+            cv.Optional(CONF_FLASH, default="0ms"): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_BLEND, default="replace"): cv.one_of(*OVERLAY_BLENDS, lower=True),
+        }
+    ),
+    cv.has_at_least_one_key(CONF_HOURS, CONF_MINUTES, CONF_MISC),
+)
+
+
+def _validate_overlay_names(config):
+    names = [overlay[CONF_NAME] for overlay in config[CONF_OVERLAYS]]
+    duplicates = sorted({name for name in names if names.count(name) > 1})
+    if duplicates:
+        raise cv.Invalid(f"Overlay names must be unique: {', '.join(duplicates)}")
+    return config
+
+# Marquee: scrolling text over the letter grid (show_marquee())
+MARQUEE_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_COLOR, default="#FFFFFF"): hex_color,
+        # Letter columns per second
+        cv.Optional(CONF_SPEED, default=8): cv.float_range(min=0.5, max=50),
+        # Times a message crosses the grid, 0 = until stop_marquee()
+        cv.Optional(CONF_REPEAT, default=1): cv.int_range(min=0, max=255),
+    }
+)
+
+
+RENDER_TASK_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_CORE, default=-1): cv.int_range(min=-1, max=1),
+        cv.Optional(CONF_PRIORITY, default=1): cv.int_range(min=0, max=24),
+    }
+)
+
+PREVIEW_SCHEMA = cv.Schema(
     {
-        cv.GenerateID(): cv.declare_id(WordClock),
-        cv.Required(CONF_STRIP_ID): cv.use_id(light.AddressableLightState),
-        cv.Optional(CONF_NUM_LEDS, default=256): cv.int_,
-        cv.Required(CONF_TIME_ID): cv.use_id(cg.PollingComponent),
+        cv.GenerateID(): cv.declare_id(PreviewStream),
+        # Default: /wordclock/<id>/preview, so several clocks do not collide
+        cv.Optional(CONF_PATH): cv.All(cv.string_strict, cv.Length(min=2)),
+        cv.Optional(CONF_MAX_FPS, default=10): cv.float_range(min=0.1, max=50),
     }
 ).extend(cv.COMPONENT_SCHEMA)
 
+# Throttle: animations pause during OTA updates and network bursts
+THROTTLE_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_OTA, default=True): cv.boolean,
+        # Smoothed loop() period that counts as a burst; 0ms = OTA only
+        cv.Optional(CONF_BUSY_LOOP_TIME, default="50ms"): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_HOLD, default="2s"): cv.positive_time_period_milliseconds,
+    }
+)
+
+UDP_INPUT_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_PROTOCOL, default="ddp"): cv.one_of(*UDP_PROTOCOLS, lower=True),
+        cv.Optional(CONF_PORT): cv.port,
+        cv.Optional(CONF_UNIVERSE, default=1): cv.int_range(min=1, max=63999),
+        cv.Optional(CONF_LAYOUT, default="strip"): cv.one_of(*UDP_LAYOUTS, lower=True),
+        cv.Optional(CONF_TIMEOUT, default="2500ms"): cv.positive_time_period_milliseconds,
+    }
+)
+
+
+def _validate_alloc_audit(config):
+    # The heap hook needs CONFIG_HEAP_USE_HOOKS, which only ESP-IDF builds can set
+    if config[CONF_ALLOC_AUDIT] and not (
+        CORE.is_host or (CORE.is_esp32 and CORE.using_esp_idf)
+    ):
+        raise cv.Invalid(
+            f"{CONF_ALLOC_AUDIT} is only available on host and on ESP32 with the ESP-IDF framework"
+        )
+    return config
+
+
+# Retained records in RTC memory (WARM_START_SLOTS in wordclock_config.h)
+WARM_START_SLOTS = 2
+
+
+def _validate_warm_start(config):
+    # The record lives in RTC no-init memory, which survives soft resets on ESP32
+    if config[CONF_WARM_START] and not (CORE.is_host or CORE.is_esp32):
+        raise cv.Invalid(f"{CONF_WARM_START} is only available on host and on ESP32")
+    return config
+
+
+def _final_validate_warm_start(config):
+    clocks = [conf for conf in fv.full_config.get().get("wordclock", []) if conf[CONF_WARM_START]]
+    if len(clocks) > WARM_START_SLOTS:
+        raise cv.Invalid(f"At most {WARM_START_SLOTS} clocks can use {CONF_WARM_START}")
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate_warm_start
+
+
+def warm_start_slot(config):
+    """Retained record of this clock: its index among the warm_start clocks."""
+    clocks = [conf[CONF_ID] for conf in CORE.config.get("wordclock", []) if conf[CONF_WARM_START]]
+    return clocks.index(config[CONF_ID])
+
+
+def _validate_effect_names(config):
+    # Effects, palettes and programs share the effect selects' option list
+    names = [name for name, _ in effect_options(config)]
+    duplicates = sorted({name for name in names if names.count(name) > 1})
+    if duplicates:
+        raise cv.Invalid(
+            f"Effect option names must be unique: {', '.join(duplicates)}"
+        )
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(WordClock),
+            cv.Required(CONF_STRIP_ID): cv.use_id(light.AddressableLightState),
+            cv.Optional(CONF_NUM_LEDS, default=256): cv.int_range(min=1, max=256),
+            cv.Required(CONF_TIME_ID): cv.use_id(cg.PollingComponent),
+            cv.Optional(CONF_RENDER_TASK): cv.All(
+                RENDER_TASK_SCHEMA, cv.only_on([PLATFORM_ESP32, PLATFORM_HOST])
+            ),
+            cv.Optional(CONF_LANGUAGES, default=list(LANGUAGES)): cv.All(
+                cv.ensure_list(cv.one_of(*LANGUAGES, lower=True)),
+                cv.Length(min=1),
+                cv.unique,
+            ),
+            cv.Optional(CONF_EFFECTS, default=list(EFFECTS)): cv.All(
+                cv.ensure_list(cv.one_of(*EFFECTS, lower=True)),
+                cv.unique,
+            ),
+            cv.Optional(CONF_EFFECT_PROGRAMS, default=[]): cv.All(
+                cv.ensure_list(EFFECT_PROGRAM_SCHEMA),
+                cv.Length(max=EFFECT_VM_SLOTS),
+            ),
+            cv.Optional(CONF_PALETTES, default=[]): cv.All(
+                cv.ensure_list(palette_entry),
+                cv.Length(max=PALETTE_SLOTS),
+            ),
+            cv.Optional(CONF_WORD_COLORS, default=[]): cv.All(
+                cv.ensure_list(WORD_COLOR_SCHEMA),
+                cv.Length(max=WORD_COLOR_SLOTS),
+            ),
+            cv.Optional(CONF_OVERLAYS, default=[]): cv.All(
+                cv.ensure_list(OVERLAY_SCHEMA),
+                cv.Length(max=OVERLAY_PRESETS),
+            ),
+            cv.Optional(CONF_MARQUEE): MARQUEE_SCHEMA,
+            cv.Optional(CONF_PHRASE_ENGINE, default="bytecode"): cv.one_of(*PHRASE_ENGINES, lower=True),
+            cv.Optional(CONF_BOOT_ANIMATION, default=True): cv.boolean,
+            cv.Optional(CONF_ALLOC_AUDIT, default=False): cv.boolean,
+            cv.Optional(CONF_WARM_START, default=False): cv.boolean,
+            cv.Optional(CONF_PREVIEW): cv.All(
+                PREVIEW_SCHEMA, cv.requires_component("web_server_base")
+            ),
+            cv.Optional(CONF_UDP_INPUT): UDP_INPUT_SCHEMA,
+            cv.Optional(CONF_THROTTLE): THROTTLE_SCHEMA,
+        }
+    ).extend(cv.COMPONENT_SCHEMA),
+    _validate_alloc_audit,
+    _validate_warm_start,
+    _validate_effect_names,
+    _validate_overlay_names,
+)
+
+
+def get_wordclock_config(wordclock_id):
+    """Returns the wordclock: entry with this id (for the select platform)."""
+    for conf in CORE.config.get("wordclock", []):
+        if conf[CONF_ID] == wordclock_id:
+            return conf
+    return None
+
+
+def language_options(config):
+    """(select option, enum value) of the compiled-in languages, default first."""
+    return [(LANGUAGES[lang][1], LANGUAGES[lang][0]) for lang in config[CONF_LANGUAGES]]
+
+
+def effect_options(config):
+    """(select option, enum value) of "None", the compiled-in effects, palettes and programs."""
+    return (
+        [("None", 0)]
+        + [
+            (EFFECTS[effect][1], EFFECTS[effect][0])
+            for effect in EFFECTS
+            if effect in config[CONF_EFFECTS]
+        ]
+        + [
+            (palette_name(palette), EFFECT_PALETTE_BASE + index)
+            for index, palette in enumerate(config[CONF_PALETTES])
+        ]
+        + [
+            (program[CONF_NAME], EFFECT_PROGRAM_BASE + slot)
+            for slot, program in enumerate(config[CONF_EFFECT_PROGRAMS])
+        ]
+    )
+
 
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
@@ -42,3 +509,98 @@ async def to_code(config):
     cg.add(var.set_strip(strip))
     time_comp = await cg.get_variable(config[CONF_TIME_ID])
     cg.add(var.set_time(time_comp))
+    if CONF_RENDER_TASK in config:
+        render_task = config[CONF_RENDER_TASK]
+        cg.add_define("USE_WORDCLOCK_RENDER_TASK")
+        cg.add(var.set_render_task(render_task[CONF_CORE], render_task[CONF_PRIORITY]))
+
+    # Only the selected languages, effect kernels and boot animation are
+    # compiled in (defines are per build, so several clocks share the union)
+    for lang in config[CONF_LANGUAGES]:
+        cg.add_define(LANGUAGES[lang][2])
+    for effect in config[CONF_EFFECTS]:
+        cg.add_define(EFFECTS[effect][2])
+    if config[CONF_EFFECT_PROGRAMS]:
+        cg.add_define("USE_WORDCLOCK_EFFECT_VM")
+        for slot, program in enumerate(config[CONF_EFFECT_PROGRAMS]):
+            cg.add(var.set_effect_program(slot, program[CONF_CODE]))
+    if config[CONF_PALETTES]:
+        cg.add_define("USE_WORDCLOCK_PALETTES")
+        for palette in config[CONF_PALETTES]:
+            cg.add(var.add_palette(palette_stops(palette)))
+    if config[CONF_WORD_COLORS]:
+        cg.add_define("USE_WORDCLOCK_WORD_COLORS")
+        for slot in config[CONF_WORD_COLORS]:
+            cg.add(
+                var.add_word_color(
+                    slot[CONF_COLOR], slot.get(CONF_HOURS, []), slot.get(CONF_MINUTES, [])
+                )
+            )
+    if config[CONF_OVERLAYS]:
+        cg.add_define("USE_WORDCLOCK_OVERLAYS")
+        for overlay in config[CONF_OVERLAYS]:
+            cg.add(
+                var.add_overlay(
+                    overlay[CONF_NAME],
+                    overlay[CONF_COLOR],
+                    OVERLAY_BLENDS[overlay[CONF_BLEND]],
+                    overlay[CONF_PRIORITY],
+                    overlay[CONF_DURATION].total_milliseconds,
+                    overlay[CONF_FLASH].total_milliseconds,
+                    overlay.get(CONF_HOURS, []),
+                    overlay.get(CONF_MINUTES, []),
+                    overlay.get(CONF_MISC, []),
+                )
+            )
+    if CONF_MARQUEE in config:
+        marquee = config[CONF_MARQUEE]
+        cg.add_define("USE_WORDCLOCK_MARQUEE")
+        cg.add(var.set_marquee(marquee[CONF_COLOR], marquee[CONF_SPEED], marquee[CONF_REPEAT]))
+    if config[CONF_PHRASE_ENGINE] == "table":
+        cg.add_define("USE_WORDCLOCK_PHRASE_TABLE")
+        cg.add(var.set_phrase_engine(PHRASE_ENGINES[config[CONF_PHRASE_ENGINE]]))
+    if config[CONF_BOOT_ANIMATION]:
+        cg.add_define("USE_WORDCLOCK_BOOT_ANIMATION")
+    if config[CONF_ALLOC_AUDIT]:
+        cg.add_define("USE_WORDCLOCK_ALLOC_AUDIT")
+        if CORE.is_esp32:
+            add_idf_sdkconfig_option("CONFIG_HEAP_USE_HOOKS", True)
+    if CONF_THROTTLE in config:
+        throttle = config[CONF_THROTTLE]
+        cg.add_define("USE_WORDCLOCK_THROTTLE")
+        if throttle[CONF_OTA] and "ota" in CORE.config:
+            # OTA platforms only report to the global state callback with this define
+            cg.add_define("USE_OTA_STATE_CALLBACK")
+        cg.add(
+            var.set_throttle(
+                throttle[CONF_BUSY_LOOP_TIME].total_milliseconds,
+                throttle[CONF_HOLD].total_milliseconds,
+                throttle[CONF_OTA],
+            )
+        )
+    if config[CONF_WARM_START]:
+        cg.add_define("USE_WORDCLOCK_WARM_START")
+        cg.add(var.set_warm_start(warm_start_slot(config)))
+    if CONF_PREVIEW in config:
+        preview = config[CONF_PREVIEW]
+        cg.add_define("USE_WORDCLOCK_PREVIEW")
+        stream = cg.new_Pvariable(preview[CONF_ID])
+        await cg.register_component(stream, preview)
+        path = preview.get(CONF_PATH, f"/wordclock/{config[CONF_ID].id}/preview")
+        cg.add(stream.set_path(path))
+        cg.add(stream.set_max_fps(preview[CONF_MAX_FPS]))
+        cg.add(var.set_preview(stream))
+    if CONF_UDP_INPUT in config:
+        udp = config[CONF_UDP_INPUT]
+        protocol, default_port = UDP_PROTOCOLS[udp[CONF_PROTOCOL]]
+        cg.add_define("USE_WORDCLOCK_UDP_INPUT")
+        cg.add(
+            var.set_udp_input(
+                protocol,
+                udp.get(CONF_PORT, default_port),
+                udp[CONF_UNIVERSE],
+                udp[CONF_TIMEOUT].total_milliseconds,
+                UDP_LAYOUTS[udp[CONF_LAYOUT]],
+            )
+        )
+    cg.add(var.set_default_language(LANGUAGES[config[CONF_LANGUAGES][0]][0]))
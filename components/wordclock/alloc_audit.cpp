@@ -0,0 +1,63 @@
+#include "alloc_audit.h"
+
+#ifdef USE_WORDCLOCK_ALLOC_AUDIT
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(USE_ESP32)
+#include "esp_attr.h"
+#include "sdkconfig.h"
+#if !defined(CONFIG_HEAP_USE_HOOKS)
+#error "alloc_audit needs CONFIG_HEAP_USE_HOOKS (ESP-IDF framework)"
+#endif
+#endif
+
+namespace esphome {
+namespace wordclock {
+
+static std::atomic<uint32_t> heap_allocations{0};
+
+uint32_t heap_allocation_count() { return heap_allocations.load(std::memory_order_relaxed); }
+
+static inline void record_allocation() { heap_allocations.fetch_add(1, std::memory_order_relaxed); }
+
+}  // namespace wordclock
+}  // namespace esphome
+
+#if defined(USE_HOST)
+// ============================================================================
+// Host: operator new interposition
+// ============================================================================
+
+void *operator new(std::size_t size) {
+  esphome::wordclock::record_allocation();
+  void *ptr = std::malloc(size ? size : 1);
+  if (ptr == nullptr) throw std::bad_alloc();
+  return ptr;
+}
+void *operator new[](std::size_t size) { return ::operator new(size); }
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+  esphome::wordclock::record_allocation();
+  return std::malloc(size ? size : 1);
+}
+void *operator new[](std::size_t size, const std::nothrow_t &tag) noexcept { return ::operator new(size, tag); }
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, std::size_t) noexcept { std::free(ptr); }
+
+#elif defined(USE_ESP32)
+// ============================================================================
+// ESP32: heap allocation hook (every heap_caps / malloc / new call)
+// ============================================================================
+
+extern "C" IRAM_ATTR void esp_heap_trace_alloc_hook(void *ptr, size_t size, uint32_t caps) {
+  if (ptr != nullptr) esphome::wordclock::record_allocation();
+}
+
+#endif
+
+#endif  // USE_WORDCLOCK_ALLOC_AUDIT
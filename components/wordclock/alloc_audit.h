@@ -0,0 +1,77 @@
+#pragma once
+
+#include "wordclock_config.h"
+#include <cstdint>
+
+namespace esphome {
+namespace wordclock {
+
+// ============================================================================
+// Allocation Audit (alloc_audit: true)
+// ============================================================================
+//
+// Debug mode counting heap allocations per WordClock::loop(). The counter
+// is fed by a hook defined in alloc_audit.cpp: operator new on the host
+// platform, the ESP-IDF heap hook (CONFIG_HEAP_USE_HOOKS) on ESP32. On the
+// device the hook sees every task, so Wi-Fi or API allocations made while
+// loop() runs are counted too; the host count is exact.
+
+#ifdef USE_WORDCLOCK_ALLOC_AUDIT
+
+/// Heap allocations seen by the hook since boot
+uint32_t heap_allocation_count();
+
+/**
+ * @brief Per-loop allocation statistics
+ *
+ * Loops are "steady" once the display runs (boot transition done) and
+ * ALLOC_AUDIT_WARMUP_MS have passed; any allocation after that point is
+ * a regression of the zero-allocation render path.
+ */
+class AllocAudit {
+ public:
+  /// Starts the warm-up period (call when the time display begins)
+  void arm(uint32_t now_ms) {
+    armed_ = true;
+    armed_ms_ = now_ms;
+  }
+
+  void begin_loop() { loop_start_ = heap_allocation_count(); }
+
+  /// @return Allocations made by this loop
+  uint32_t end_loop(uint32_t now_ms) {
+    uint32_t count = heap_allocation_count() - loop_start_;
+    last_loop_ = count;
+    if (count > peak_loop_) peak_loop_ = count;
+    if (armed_ && now_ms - armed_ms_ >= config::ALLOC_AUDIT_WARMUP_MS) {
+      steady_loops_++;
+      steady_total_ += count;
+    }
+    return count;
+  }
+
+  bool is_steady() const { return steady_loops_ > 0; }
+  uint32_t last_loop() const { return last_loop_; }
+  /// Largest single-loop count since the last take_peak()
+  uint32_t take_peak() {
+    uint32_t peak = peak_loop_;
+    peak_loop_ = 0;
+    return peak;
+  }
+  uint32_t steady_total() const { return steady_total_; }
+  uint32_t steady_loops() const { return steady_loops_; }
+
+ protected:
+  bool armed_{false};
+  uint32_t armed_ms_{0};
+  uint32_t loop_start_{0};
+  uint32_t last_loop_{0};
+  uint32_t peak_loop_{0};
+  uint32_t steady_total_{0};
+  uint32_t steady_loops_{0};
+};
+
+#endif  // USE_WORDCLOCK_ALLOC_AUDIT
+
+}  // namespace wordclock
+}  // namespace esphome
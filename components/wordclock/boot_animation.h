@@ -0,0 +1,80 @@
+#pragma once
+
+#include "wordclock_config.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace wordclock {
+
+// ============================================================================
+// Boot Ring Trail
+// ============================================================================
+
+/**
+ * @brief Builds the boot ring trail table at compile time
+ *
+ * Entry d is the level (0-255) of the ring LED d steps behind the head:
+ * (1 - d / BOOT_RING_TRAIL_LENGTH)^2, scaled by BOOT_BRIGHTNESS_MULT.
+ */
+constexpr std::array<uint8_t, config::SECONDS_RING_SIZE> make_boot_ring_lut() {
+  std::array<uint8_t, config::SECONDS_RING_SIZE> lut{};
+  for (int d = 0; d < config::SECONDS_RING_SIZE; d++) {
+    if (d >= config::BOOT_RING_TRAIL_LENGTH) break;
+    float brightness = 1.0f - float(d) / float(config::BOOT_RING_TRAIL_LENGTH);
+    lut[d] = uint8_t(brightness * brightness * config::BOOT_BRIGHTNESS_MULT * 255.0f + 0.5f);
+  }
+  return lut;
+}
+
+static constexpr auto BOOT_RING_LUT = make_boot_ring_lut();
+
+// ============================================================================
+// Boot Animation Spans
+// ============================================================================
+
+/// Upper bound of the "42" LEDs of a faceplate
+static constexpr int BOOT_MATRIX_MAX_LEDS = 32;
+
+/**
+ * @brief Fixed LED spans and lookups of the boot screens
+ *
+ * The "42" LEDs are copied once per language (set_matrix_leds()), so the
+ * boot frames neither intern strings nor search the LED maps. Ring levels
+ * come from BOOT_RING_LUT.
+ */
+class BootAnimation {
+ public:
+  void set_matrix_leds(const std::vector<int> &leds) {
+    matrix_count_ = 0;
+    for (int led : leds) {
+      if (matrix_count_ == BOOT_MATRIX_MAX_LEDS) break;
+      if (led >= 0 && led < 256) matrix_leds_[matrix_count_++] = uint8_t(led);
+    }
+  }
+  void clear_matrix_leds() { matrix_count_ = 0; }
+
+  int matrix_count() const { return matrix_count_; }
+  int matrix_led(int i) const { return matrix_leds_[i]; }
+
+  /// Head position on the ring (0 .. SECONDS_RING_SIZE - 1)
+  static int ring_position(uint32_t now_ms) {
+    return (now_ms / config::BOOT_RING_ROTATION_MS) % config::SECONDS_RING_SIZE;
+  }
+
+  /// Trail level (0-255) of ring second s for a head position
+  static uint8_t ring_level(int second, int position) {
+    int idx = (second <= 29) ? (second - 1) : (second - 2);  // skip the gaps
+    int distance = idx - position;
+    if (distance < 0) distance += config::SECONDS_RING_SIZE;
+    return BOOT_RING_LUT[distance];
+  }
+
+ protected:
+  std::array<uint8_t, BOOT_MATRIX_MAX_LEDS> matrix_leds_{};
+  uint8_t matrix_count_{0};
+};
+
+}  // namespace wordclock
+}  // namespace esphome
@@ -1,7 +1,10 @@
 #pragma once
 
 #include "esphome/core/color.h"
+#include "wordclock_config.h"
+#include <array>
 #include <cmath>
+#include <cstdint>
 
 namespace esphome {
 namespace wordclock {
@@ -45,18 +48,70 @@ struct LightColors {
 };
 
 /**
- * @brief Effect timing parameters
+ * @brief Word colour table: entry 2 x slot + layer (hours 0, minutes 1)
+ *
+ * Slot 0 is the layer light colour; slots 1.. are the word_colors: entries
+ * at the brightness of the word's layer. Each lit word LED holds an index
+ * into this table (WordClock::led_color_index_), resolved when the active
+ * words change.
  */
-struct EffectParams {
-  float cycle_time;           ///< Rainbow cycle time in seconds
-  float pulse_period;         ///< Pulse effect period in ms
-  float breathe_period;       ///< Breathe effect period in ms
-  float color_cycle_period;   ///< Color cycle period in ms
-  float words_brightness_mult;    ///< Words brightness multiplier [0-1]
-  float seconds_brightness_mult;  ///< Seconds brightness multiplier [0-1]
-  float hue_time;             ///< Current hue time offset [0-1]
-  float hue_per_led;          ///< Hue increment per LED
-  uint32_t now_ms;            ///< Current timestamp
+#ifdef USE_WORDCLOCK_WORD_COLORS
+static constexpr int WORD_COLOR_COUNT = 2 * (1 + config::WORD_COLOR_SLOTS);
+#else
+static constexpr int WORD_COLOR_COUNT = 2;
+#endif
+
+constexpr uint8_t word_color_index(int slot, int layer) { return uint8_t(2 * slot + layer); }
+
+/// Layers with their own effect: hours, minutes, seconds, background (LightType order)
+static constexpr int EFFECT_LAYER_COUNT = 4;
+
+/**
+ * @brief Effect settings of one layer, derived for the renderer
+ */
+struct LayerRenderConfig {
+  int effect;                         ///< EffectType, EFFECT_NONE (0) for a static layer
+  uint32_t cycle_ms;                  ///< Rainbow cycle
+  uint32_t pulse_period_ms;           ///< Pulse effect period
+  uint32_t breathe_period_ms;         ///< Breathe effect period
+  uint32_t color_cycle_period_ms;     ///< Color cycle period
+  float brightness_mult;              ///< Effect brightness multiplier [0-1]
+};
+
+/**
+ * @brief Render settings derived from the Number / Select / Light state
+ *
+ * Rebuilt by WordClock::rebuild_render_config() when one of them changes;
+ * frames only read it. Periods are whole milliseconds so effect phases
+ * come from integer modulo of the frame timestamp.
+ */
+struct RenderConfig {
+  LightColors colors;                 ///< Layer colors, black while a layer is off
+  std::array<Color, WORD_COLOR_COUNT> word_colors;  ///< Base colour of each word LED (see word_color_index())
+  std::array<LayerRenderConfig, EFFECT_LAYER_COUNT> layers;  ///< Indexed by LightType
+  float hue_per_led;                  ///< Rainbow hue increment per LED
+};
+
+/**
+ * @brief Effect phases of one layer for the current frame
+ *
+ * Only filled for layers with an effect: static layers cost nothing.
+ */
+struct LayerPhase {
+  float hue_time;             ///< Rainbow hue offset [0-1)
+  float pulse_wave;           ///< Pulse intensity before brightness
+  float breathe_wave;         ///< Breathe intensity before brightness
+  float color_cycle_hue;      ///< Color cycle hue [0-1)
+  float effect_phase;         ///< Effect cycle phase [0-1) (effect programs)
+};
+
+/**
+ * @brief Per-frame values, computed once from a single millis() sample
+ */
+struct FrameContext {
+  uint32_t now_ms;            ///< Frame timestamp
+  std::array<LayerPhase, EFFECT_LAYER_COUNT> layers;  ///< Indexed by LightType
+  float second_phase;         ///< Progress through the displayed second [0-1)
 };
 
 // ============================================================================
@@ -169,22 +224,10 @@ class HSVCache {
   }
 };
 
-/// Global static HSV cache instance
-static HSVCache g_hsv_cache;
-
 // ============================================================================
 // Color Function Declarations
 // ============================================================================
 
-/**
- * @brief Convert HSV color to RGB using cache
- * @param h Hue [0,1]
- * @param s Saturation [0,1]
- * @param v Value/Brightness [0,1]
- * @return RGB Color
- */
-Color hsv_to_rgb(float h, float s, float v);
-
 /**
  * @brief Blend two colors with smooth interpolation (ease in/out)
  * @param from Source color
@@ -194,6 +237,36 @@ Color hsv_to_rgb(float h, float s, float v);
  */
 Color blend_colors(Color from, Color to, float progress);
 
+/**
+ * @brief Blend two colors with an already eased progress
+ * @param from Source color
+ * @param to Target color
+ * @param eased Eased blend progress [0,1] (see blend_colors)
+ * @return Blended color
+ */
+inline Color blend_colors_eased(Color from, Color to, float eased) {
+  return Color(
+    uint8_t(from.r + (to.r - from.r) * eased),
+    uint8_t(from.g + (to.g - from.g) * eased),
+    uint8_t(from.b + (to.b - from.b) * eased)
+  );
+}
+
+/**
+ * @brief Linear blend of two colors with an 8-bit weight
+ * @param from Source color
+ * @param to Target color
+ * @param amount Weight of the target color [0-255]
+ * @return Blended color
+ */
+inline Color lerp_colors(Color from, Color to, uint8_t amount) {
+  return Color(
+    uint8_t(from.r + ((to.r - from.r) * amount) / 255),
+    uint8_t(from.g + ((to.g - from.g) * amount) / 255),
+    uint8_t(from.b + ((to.b - from.b) * amount) / 255)
+  );
+}
+
 /**
  * @brief Safely get color from a WordClockLight with brightness mapping
  * @param light Pointer to the light (can be nullptr)
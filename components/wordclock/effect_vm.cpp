@@ -0,0 +1,155 @@
+#include "effect_vm.h"
+
+#ifdef USE_WORDCLOCK_EFFECT_VM
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+namespace esphome {
+namespace wordclock {
+
+// ============================================================================
+// Program Text
+// ============================================================================
+//
+// One instruction per line (or separated by ';'), '#' starts a comment:
+//
+//   add s0 x y        # s0 = column + row
+//   mad s0 t 16       # scroll with the effect cycle
+//   mul s0 s0 0.0625
+//   hsv r s0 0.5      # r, g, b = hue s0 at half brightness
+//
+// Destinations are r, g, b or s0..s7; sources may also be x, y, i, n, t
+// or a number.
+
+struct VmOpcodeInfo {
+  const char *name;
+  uint8_t sources;
+};
+
+static constexpr VmOpcodeInfo VM_OPCODES[VM_OPCODE_COUNT] = {
+    {"mov", 1}, {"add", 2}, {"sub", 2}, {"mul", 2}, {"div", 2}, {"mad", 2}, {"min", 2},
+    {"max", 2}, {"lt", 2},  {"abs", 1}, {"fract", 1}, {"sin", 1}, {"hsv", 2},
+};
+
+static constexpr const char *VM_INPUT_NAMES[VM_REG_SCRATCH] = {"x", "y", "i", "n", "t", "r", "g", "b"};
+
+static bool token_is(const char *token, size_t length, const char *name) {
+  return strlen(name) == length && strncmp(token, name, length) == 0;
+}
+
+/// @return Register index of a name, -1 if the token is not a register
+static int parse_register(const char *token, size_t length) {
+  for (int i = 0; i < VM_REG_SCRATCH; i++) {
+    if (token_is(token, length, VM_INPUT_NAMES[i])) return i;
+  }
+  if (length == 2 && token[0] == 's' && token[1] >= '0' && token[1] <= '7') return VM_REG_SCRATCH + (token[1] - '0');
+  return -1;
+}
+
+/// Splits one statement into at most 4 tokens
+static int tokenize(const char *begin, const char *end, const char *tokens[4], size_t lengths[4]) {
+  int count = 0;
+  const char *p = begin;
+  while (p < end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == ',' || *p == '\r')) p++;
+    if (p >= end) break;
+    const char *start = p;
+    while (p < end && *p != ' ' && *p != '\t' && *p != ',' && *p != '\r') p++;
+    if (count == 4) return 5;  // too many operands
+    tokens[count] = start;
+    lengths[count] = size_t(p - start);
+    count++;
+  }
+  return count;
+}
+
+static VmLoadResult fail(int line, const char *error) { return {false, line, error}; }
+
+VmLoadResult EffectVm::stage(int slot, const char *source) {
+  if (slot < 0 || slot >= config::EFFECT_VM_SLOTS) return fail(0, "no such program slot");
+  if (pending_.load(std::memory_order_acquire)) return fail(0, "previous program not applied yet");
+
+  EffectProgram program;
+  uint32_t cycles = 0;
+  int line = 1;
+  const char *p = source != nullptr ? source : "";
+
+  while (*p != '\0') {
+    // One statement: up to ';', newline or a comment
+    const char *begin = p;
+    while (*p != '\0' && *p != '\n' && *p != ';' && *p != '#') p++;
+    const char *end = p;
+    if (*p == '#') {
+      while (*p != '\0' && *p != '\n') p++;
+    }
+    int statement_line = line;
+    if (*p == '\n') line++;
+    if (*p != '\0') p++;
+
+    const char *tokens[4];
+    size_t lengths[4];
+    int count = tokenize(begin, end, tokens, lengths);
+    if (count == 0) continue;
+
+    int op = -1;
+    for (int i = 0; i < VM_OPCODE_COUNT; i++) {
+      if (token_is(tokens[0], lengths[0], VM_OPCODES[i].name)) op = i;
+    }
+    if (op < 0) return fail(statement_line, "unknown instruction");
+    if (count != 2 + VM_OPCODES[op].sources) return fail(statement_line, "wrong number of operands");
+    if (program.size == config::EFFECT_VM_MAX_INSTRUCTIONS) return fail(statement_line, "too many instructions");
+
+    // Inputs x..t are read-only; hsv writes three consecutive registers
+    int dst = parse_register(tokens[1], lengths[1]);
+    int last_dst = op == VM_HSV ? VM_REG_CONST - 3 : VM_REG_CONST - 1;
+    if (dst < VM_REG_R || dst > last_dst) {
+      return fail(statement_line,
+                  op == VM_HSV ? "hsv destination must be r, g, b or s0..s5" : "destination must be r, g, b or s0..s7");
+    }
+
+    uint8_t sources[2];
+    for (int s = 0; s < VM_OPCODES[op].sources; s++) {
+      const char *token = tokens[2 + s];
+      size_t length = lengths[2 + s];
+      int reg = parse_register(token, length);
+      if (reg < 0) {
+        char number[24];
+        if (length >= sizeof(number)) return fail(statement_line, "bad operand");
+        memcpy(number, token, length);
+        number[length] = '\0';
+        char *parsed_end = nullptr;
+        float value = strtof(number, &parsed_end);
+        if (parsed_end != number + length || !std::isfinite(value)) return fail(statement_line, "bad operand");
+
+        // Literals share constant registers
+        int c = 0;
+        while (c < program.constant_count && program.constants[c] != value) c++;
+        if (c == program.constant_count) {
+          if (c == config::EFFECT_VM_MAX_CONSTANTS) return fail(statement_line, "too many constants");
+          program.constants[c] = value;
+          program.constant_count++;
+        }
+        reg = VM_REG_CONST + c;
+      }
+      sources[s] = uint8_t(reg);
+    }
+    if (VM_OPCODES[op].sources == 1) sources[1] = sources[0];
+
+    cycles += VM_OPCODE_CYCLES[op];
+    if (cycles > config::EFFECT_VM_MAX_CYCLES) return fail(statement_line, "cycle budget exceeded");
+    program.code[program.size++] = {uint8_t(op), uint8_t(dst), sources[0], sources[1]};
+  }
+
+  program.cycles = uint16_t(cycles);
+  staged_ = program;
+  staged_slot_ = slot;
+  pending_.store(true, std::memory_order_release);
+  return {true, 0, nullptr};
+}
+
+}  // namespace wordclock
+}  // namespace esphome
+
+#endif  // USE_WORDCLOCK_EFFECT_VM
@@ -0,0 +1,237 @@
+#pragma once
+
+#include "wordclock_config.h"
+
+#ifdef USE_WORDCLOCK_EFFECT_VM
+
+#include "esphome/core/color.h"
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+
+namespace esphome {
+namespace wordclock {
+
+// ============================================================================
+// Effect Programs (effect_programs: in the YAML)
+// ============================================================================
+//
+// User effects run as small register programs, one run per lit LED. The
+// text source is compiled once at load time (effect_vm.cpp) into fixed-size
+// instructions whose operands are register indices, so the renderer only
+// dispatches. There are no jumps: every run executes the whole program, and
+// its cost in VM cycles is known before it is accepted.
+
+enum VmOpcode : uint8_t {
+  VM_MOV = 0,  ///< d = a
+  VM_ADD,      ///< d = a + b
+  VM_SUB,      ///< d = a - b
+  VM_MUL,      ///< d = a * b
+  VM_DIV,      ///< d = a / b (0 when b is 0)
+  VM_MAD,      ///< d = d + a * b
+  VM_MIN,      ///< d = min(a, b)
+  VM_MAX,      ///< d = max(a, b)
+  VM_LT,       ///< d = a < b ? 1 : 0
+  VM_ABS,      ///< d = |a|
+  VM_FRACT,    ///< d = a - floor(a)
+  VM_SIN,      ///< d = sin(2 pi a), a in turns
+  VM_HSV,      ///< d, d+1, d+2 = RGB of hue a, full saturation, value b
+  VM_OPCODE_COUNT
+};
+
+/// Cost of each opcode in VM cycles (relative, 1 = one add)
+static constexpr uint8_t VM_OPCODE_CYCLES[VM_OPCODE_COUNT] = {1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 2, 4, 8};
+
+/// Register file: inputs, then scratch, then the program's literals
+enum VmRegister : uint8_t {
+  VM_REG_X = 0,         ///< LED column [0-15]
+  VM_REG_Y = 1,         ///< LED row [0-15]
+  VM_REG_I = 2,         ///< Ordinal of the LED in its layer
+  VM_REG_N = 3,         ///< Lit LEDs in the layer
+  VM_REG_T = 4,         ///< Effect cycle phase [0-1), follows the effect speed
+  VM_REG_R = 5,         ///< Layer colour in, output colour out [0-1]
+  VM_REG_G = 6,
+  VM_REG_B = 7,
+  VM_REG_SCRATCH = 8,   ///< s0..s7, zero at the start of each run
+  VM_REG_CONST = 16,    ///< Literals, read-only
+  VM_REGISTER_COUNT = VM_REG_CONST + config::EFFECT_VM_MAX_CONSTANTS
+};
+
+/// Pre-decoded instruction: all operands are register indices
+struct VmInstruction {
+  uint8_t op;
+  uint8_t dst;
+  uint8_t a;
+  uint8_t b;
+};
+
+/**
+ * @brief A verified program
+ *
+ * An empty program leaves r, g, b untouched: the layer colour, as with
+ * no effect.
+ */
+struct EffectProgram {
+  std::array<VmInstruction, config::EFFECT_VM_MAX_INSTRUCTIONS> code{};
+  std::array<float, config::EFFECT_VM_MAX_CONSTANTS> constants{};
+  uint8_t size{0};
+  uint8_t constant_count{0};
+  uint16_t cycles{0};  ///< Cost of one run
+};
+
+/// Outcome of a program load; line is 1-based, 0 when not line-specific
+struct VmLoadResult {
+  bool ok;
+  int line;
+  const char *error;
+};
+
+/// Size and cost of a loaded program, kept on the loop thread for dump_config()
+struct EffectProgramInfo {
+  uint8_t size{0};
+  uint16_t cycles{0};
+};
+
+/**
+ * @brief Compiles, verifies and stores the programs of one clock
+ *
+ * Loads come from the ESPHome loop (setup, API services) while the
+ * renderer may be reading the slots, so a load is compiled into a staging
+ * program and moved into its slot by commit() on the renderer side
+ * (CMD_EFFECT_PROGRAM). One load can be in flight at a time.
+ */
+class EffectVm {
+ public:
+  /// Compiles source for a slot into the staging program (loop thread)
+  VmLoadResult stage(int slot, const char *source);
+  /// Moves a staged program into its slot (renderer side)
+  void commit() {
+    if (!pending_.load(std::memory_order_acquire)) return;
+    programs_[staged_slot_] = staged_;
+    pending_.store(false, std::memory_order_release);
+  }
+  /// Drops the staged program when its CMD_EFFECT_PROGRAM was not queued (loop thread)
+  void cancel() { pending_.store(false, std::memory_order_release); }
+
+  const EffectProgram &program(int slot) const { return programs_[slot]; }
+  /// The program stage() compiled, until commit() (loop thread)
+  const EffectProgram &staged() const { return staged_; }
+
+ protected:
+  std::array<EffectProgram, config::EFFECT_VM_SLOTS> programs_{};
+  EffectProgram staged_{};
+  int staged_slot_{0};
+  std::atomic<bool> pending_{false};
+};
+
+/**
+ * @brief Runs one program over one layer for one frame
+ *
+ * begin() loads the per-frame registers and checks the layer's share of
+ * the frame budget (EFFECT_VM_FRAME_CYCLES split across the layers running
+ * a program): if cycles x LEDs exceeds it the program is downgraded to a
+ * single run per frame (x = y = i = 0) and every LED gets that colour.
+ */
+class EffectVmFrame {
+ public:
+  /// @return false if the layer was downgraded to a uniform colour
+  bool begin(const EffectProgram &program, float phase, int count,
+             uint32_t budget = config::EFFECT_VM_FRAME_CYCLES) {
+    program_ = &program;
+    template_.fill(0.0f);
+    for (int i = 0; i < program.constant_count; i++) template_[VM_REG_CONST + i] = program.constants[i];
+    template_[VM_REG_N] = float(count);
+    template_[VM_REG_T] = phase;
+    per_led_ = uint32_t(program.cycles) * uint32_t(count) <= budget;
+    uniform_valid_ = false;
+    return per_led_;
+  }
+
+  /// Colour of one LED with layer colour base (uniform colour when downgraded)
+  Color color(int x, int y, int ordinal, Color base) {
+    if (!per_led_) {
+      if (!uniform_valid_ || uniform_base_ != base) {
+        uniform_ = run(0, 0, 0, base);
+        uniform_base_ = base;
+        uniform_valid_ = true;
+      }
+      return uniform_;
+    }
+    return run(x, y, ordinal, base);
+  }
+
+  /// Executes the program once
+  Color run(int x, int y, int ordinal, Color base) {
+    std::array<float, VM_REGISTER_COUNT> reg = template_;
+    reg[VM_REG_X] = float(x);
+    reg[VM_REG_Y] = float(y);
+    reg[VM_REG_I] = float(ordinal);
+    reg[VM_REG_R] = base.r / 255.0f;
+    reg[VM_REG_G] = base.g / 255.0f;
+    reg[VM_REG_B] = base.b / 255.0f;
+
+    const VmInstruction *ins = program_->code.data();
+    const VmInstruction *end = ins + program_->size;
+    for (; ins != end; ++ins) {
+      float a = reg[ins->a];
+      float b = reg[ins->b];
+      float &d = reg[ins->dst];
+      switch (ins->op) {
+        case VM_MOV: d = a; break;
+        case VM_ADD: d = a + b; break;
+        case VM_SUB: d = a - b; break;
+        case VM_MUL: d = a * b; break;
+        case VM_DIV: d = b != 0.0f ? a / b : 0.0f; break;
+        case VM_MAD: d += a * b; break;
+        case VM_MIN: d = a < b ? a : b; break;
+        case VM_MAX: d = a > b ? a : b; break;
+        case VM_LT: d = a < b ? 1.0f : 0.0f; break;
+        case VM_ABS: d = fabsf(a); break;
+        case VM_FRACT: d = a - floorf(a); break;
+        case VM_SIN: d = sinf(a * 6.2831853f); break;
+        case VM_HSV: hsv(a, b, &reg[ins->dst]); break;
+        default: break;
+      }
+    }
+    return Color(to_channel(reg[VM_REG_R]), to_channel(reg[VM_REG_G]), to_channel(reg[VM_REG_B]));
+  }
+
+ protected:
+  static uint8_t to_channel(float v) {
+    // NaN and infinities from user arithmetic end up black or full
+    if (!(v > 0.0f)) return 0;
+    if (v >= 1.0f) return 255;
+    return uint8_t(v * 255.0f + 0.5f);
+  }
+
+  /// Full-saturation HSV, hue wrapped into [0, 1)
+  static void hsv(float h, float v, float *rgb) {
+    float h6 = (h - floorf(h)) * 6.0f;
+    if (!(h6 >= 0.0f && h6 < 6.0f)) h6 = 0.0f;  // NaN / infinite hue
+    int sector = int(h6);
+    float f = h6 - sector;
+    float q = v * (1.0f - f);
+    float t = v * f;
+    switch (sector) {
+      case 0: rgb[0] = v; rgb[1] = t; rgb[2] = 0; break;
+      case 1: rgb[0] = q; rgb[1] = v; rgb[2] = 0; break;
+      case 2: rgb[0] = 0; rgb[1] = v; rgb[2] = t; break;
+      case 3: rgb[0] = 0; rgb[1] = q; rgb[2] = v; break;
+      case 4: rgb[0] = t; rgb[1] = 0; rgb[2] = v; break;
+      default: rgb[0] = v; rgb[1] = 0; rgb[2] = q; break;
+    }
+  }
+
+  const EffectProgram *program_{nullptr};
+  std::array<float, VM_REGISTER_COUNT> template_{};
+  bool per_led_{true};
+  bool uniform_valid_{false};
+  Color uniform_base_{};
+  Color uniform_{};
+};
+
+}  // namespace wordclock
+}  // namespace esphome
+
+#endif  // USE_WORDCLOCK_EFFECT_VM
@@ -2,73 +2,125 @@
 #include "wordclock_config.h"
 #include "color_utils.h"
 #include "led_utils.h"
+#include "seconds_ring.h"
 #include "string_pool.h"
 #include "light/wordclock_light.h"
 #include <cmath>
 #include <algorithm>
-#include <set>
 #include <string>
 
 namespace esphome {
 namespace wordclock {
 
 // ============================================================================
-// Color Retrieval
+// Render Configuration
 // ============================================================================
 
-LightColors WordClock::get_light_colors() {
-  LightColors colors;
-  colors.hours = get_light_color_safe(hours_light_, HOURS_BRIGHTNESS_RANGE);
-  colors.minutes = get_light_color_safe(minutes_light_, MINUTES_BRIGHTNESS_RANGE);
-  colors.seconds = get_light_color_safe(seconds_light_, SECONDS_BRIGHTNESS_RANGE);
-  colors.background = get_light_color_safe(background_light_, BACKGROUND_BRIGHTNESS_RANGE);
-  return colors;
-}
+/// Whole milliseconds, at least 1 (used as a modulus)
+static uint32_t period_ms(float ms) { return ms >= 1.0f ? uint32_t(ms + 0.5f) : 1; }
 
-EffectParams WordClock::calculate_effect_params() {
-  EffectParams params;
-  uint32_t now_ms = millis();
-  
-  params.now_ms = now_ms;
-  params.cycle_time = config::calculate_effect_cycle_time(effect_speed_);
-  params.pulse_period = config::calculate_effect_period(config::PULSE_PERIOD_BASE_MS, effect_speed_);
-  params.breathe_period = config::calculate_effect_period(config::BREATHE_PERIOD_BASE_MS, effect_speed_);
-  params.color_cycle_period = config::calculate_effect_period(config::COLOR_CYCLE_PERIOD_BASE_MS, effect_speed_);
-  params.words_brightness_mult = words_effect_brightness_ / 100.0f;
-  params.seconds_brightness_mult = seconds_effect_brightness_ / 100.0f;
-  
-  params.hue_time = fmod(1.0f - (float)now_ms / (params.cycle_time * 1000.0f), 1.0f);
-  if (params.hue_time < 0) params.hue_time += 1.0f;
-  params.hue_per_led = (rainbow_spread_ / 100.0f) * config::HUE_SPREAD_FACTOR;
-  
-  return params;
+void WordClock::rebuild_render_config() {
+  // Snapshots are kept current by on_light_changed(); off lights are black
+  auto color_of = [this](LightType type) {
+    return layer_lights_[type].on ? layer_lights_[type].color : Color(0, 0, 0);
+  };
+  RenderConfig cfg;
+  cfg.colors.hours = color_of(LIGHT_HOURS);
+  cfg.colors.minutes = color_of(LIGHT_MINUTES);
+  cfg.colors.seconds = color_of(LIGHT_SECONDS);
+  cfg.colors.background = color_of(LIGHT_BACKGROUND);
+  cfg.word_colors[word_color_index(0, LIGHT_HOURS)] = cfg.colors.hours;
+  cfg.word_colors[word_color_index(0, LIGHT_MINUTES)] = cfg.colors.minutes;
+#ifdef USE_WORDCLOCK_WORD_COLORS
+  // Slot colours follow the on/off state and brightness of the word's layer
+  for (int s = 0; s < word_color_count_; s++) {
+    const Color &c = word_color_slots_[s].color;
+    for (int layer : {LIGHT_HOURS, LIGHT_MINUTES}) {
+      const LayerLight &light = layer_lights_[layer];
+      float k = light.on ? light.brightness : 0.0f;
+      cfg.word_colors[word_color_index(s + 1, layer)] = Color(uint8_t(c.r * k), uint8_t(c.g * k), uint8_t(c.b * k));
+    }
+  }
+#endif
+  for (int layer = 0; layer < EFFECT_LAYER_COUNT; layer++) {
+    const LayerEffect &effect = layer_effects_[layer];
+    LayerRenderConfig &out = cfg.layers[layer];
+    out.effect = effect.effect;
+    out.cycle_ms = period_ms(config::calculate_effect_cycle_time(effect.speed) * 1000.0f);
+    out.pulse_period_ms = period_ms(config::calculate_effect_period(config::PULSE_PERIOD_BASE_MS, effect.speed));
+    out.breathe_period_ms = period_ms(config::calculate_effect_period(config::BREATHE_PERIOD_BASE_MS, effect.speed));
+    out.color_cycle_period_ms =
+        period_ms(config::calculate_effect_period(config::COLOR_CYCLE_PERIOD_BASE_MS, effect.speed));
+    out.brightness_mult = effect.brightness / 100.0f;
+  }
+  cfg.hue_per_led = (rainbow_spread_ / 100.0f) * config::HUE_SPREAD_FACTOR;
+  render_config_ = cfg;
+  static_cache_valid_ = false;
+#ifdef USE_WORDCLOCK_PALETTES
+  update_palette_luts();
+#endif
 }
 
-void WordClock::clear_led_output() {
-  auto output = static_cast<light::AddressableLight *>(strip_->get_output());
-  if (!output) return;
-  for (int i = 0; i < num_leds_; i++) {
-    (*output)[i] = Color(0, 0, 0);
+#ifdef USE_WORDCLOCK_PALETTES
+void WordClock::update_palette_luts() {
+  // Only the palettes in use are expanded, at the brightness they show at
+  auto palette_of = [this](int effect) -> const Palette * {
+    int index = effect_palette_index(effect);
+    return index >= 0 && index < palette_count_ ? &palettes_[index] : nullptr;
+  };
+  for (int layer = 0; layer < EFFECT_LAYER_COUNT; layer++) {
+    const LayerRenderConfig &cfg = render_config_.layers[layer];
+    palette_luts_[layer].update(palette_of(cfg.effect), cfg.brightness_mult);
   }
 }
+#endif
 
-float WordClock::calculate_visual_change_intensity() {
-  auto output = static_cast<light::AddressableLight *>(strip_->get_output());
-  if (!output) return 0.0f;
-  
-  float total_change = 0;
-  int changed_leds = 0;
-  for (int i = 0; i < num_leds_; i++) {
-    if (is_excluded_led(i, num_leds_)) continue;
-    Color current = Color((*output)[i].get_red(), (*output)[i].get_green(), (*output)[i].get_blue());
-    Color previous = prev_led_colors_[i];
-    int diff = abs(current.r - previous.r) + abs(current.g - previous.g) + abs(current.b - previous.b);
-    if (diff > 0) {
-      total_change += diff;
-      changed_leds++;
+/// Position in [0, 1) of now_ms within a period
+static float period_phase(uint32_t now_ms, uint32_t period) { return float(now_ms % period) / float(period); }
+
+#if defined(USE_WORDCLOCK_EFFECT_PULSE) || defined(USE_WORDCLOCK_EFFECT_BREATHE)
+/// Raised sine in [0, 1] over a period
+static float period_wave(uint32_t now_ms, uint32_t period) {
+  return (sinf(period_phase(now_ms, period) * 2.0f * 3.14159f) + 1.0f) / 2.0f;
+}
+#endif
+
+FrameContext WordClock::make_frame_context(uint32_t now_ms) {
+  FrameContext ctx{};
+  ctx.now_ms = now_ms;
+
+  // Phases of the animated layers only; static layers leave theirs at 0
+  for (int layer = 0; layer < EFFECT_LAYER_COUNT; layer++) {
+    const LayerRenderConfig &cfg = render_config_.layers[layer];
+    if (cfg.effect == EFFECT_NONE) continue;
+    LayerPhase &phase = ctx.layers[layer];
+
+    // The rainbow runs backwards through the hue circle
+    float hue_phase = period_phase(now_ms, cfg.cycle_ms);
+    phase.hue_time = hue_phase > 0.0f ? 1.0f - hue_phase : 0.0f;
+    phase.effect_phase = hue_phase;
+
+    // Uniform effect waves: once per frame instead of once per LED
+#ifdef USE_WORDCLOCK_EFFECT_PULSE
+    if (cfg.effect == EFFECT_PULSE) {
+      phase.pulse_wave =
+          config::PULSE_MIN_INTENSITY + period_wave(now_ms, cfg.pulse_period_ms) * config::PULSE_INTENSITY_RANGE;
+    }
+#endif
+#ifdef USE_WORDCLOCK_EFFECT_BREATHE
+    if (cfg.effect == EFFECT_BREATHE) {
+      phase.breathe_wave =
+          config::BREATHE_MIN_INTENSITY + period_wave(now_ms, cfg.breathe_period_ms) * config::BREATHE_INTENSITY_RANGE;
     }
+#endif
+#ifdef USE_WORDCLOCK_EFFECT_COLOR_CYCLE
+    if (cfg.effect == EFFECT_COLOR_CYCLE) phase.color_cycle_hue = period_phase(now_ms, cfg.color_cycle_period_ms);
+#endif
   }
-  return changed_leds > 0 ? (total_change / (changed_leds * 765.0f)) : 0.0f;
+
+  uint32_t second_ms = now_ms - second_start_ms_;
+  ctx.second_phase = second_ms < 1000 ? second_ms / 1000.0f : 0.999f;
+  return ctx;
 }
 
 // ============================================================================
@@ -77,304 +129,497 @@ float WordClock::calculate_visual_change_intensity() {
 
 void WordClock::apply_light_colors() {
   if (!strip_) return;
-  auto output = static_cast<light::AddressableLight *>(strip_->get_output());
-  if (!output) return;
 
-  auto colors = get_light_colors();
-  auto params = calculate_effect_params();
-  clear_led_output();
+  // One timestamp per frame; settings come from the render config snapshot
+  FrameContext ctx = make_frame_context(get_millis());
 
-  bool words_enabled = (hours_light_ && hours_light_->is_on()) || (minutes_light_ && minutes_light_->is_on());
+  bool words_enabled = layer_lights_[LIGHT_HOURS].on || layer_lights_[LIGHT_MINUTES].on;
   if (!words_enabled) {
     typing_in_leds_.clear();
     led_fades_.clear();
   }
 
-  if (words_enabled) {
-    apply_words_with_effects(colors, params);
-  }
-  if (seconds_light_ && seconds_light_->is_on()) {
-    apply_seconds_with_effects(colors, params);
-  }
-  apply_seconds_fades(colors.background, params);
-  apply_word_fades(colors.background);
-  apply_background(colors.background);
-
-  float change = calculate_visual_change_intensity();
+#ifdef USE_WORDCLOCK_THROTTLE
+  // Frame cost, for the render time a throttled frame saves
+  uint32_t start_us = micros();
+  float change = compose_frame(ctx, words_enabled);
+  throttle_.record_frame_us(micros() - start_us);
+#else
+  float change = compose_frame(ctx, words_enabled);
+#endif
   adaptive_fps_.register_visual_change(change);
 
-  output->schedule_show();
+  present_frame();
 }
 
+#ifdef USE_WORDCLOCK_EFFECT_VM
 // ============================================================================
-// Words Rendering with Effects
+// Effect Programs
 // ============================================================================
 
-void WordClock::apply_words_with_effects(const LightColors& colors, const EffectParams& params) {
-  auto output = static_cast<light::AddressableLight *>(strip_->get_output());
-  if (!output) return;
+static const char *const TAG = "wordclock.effects";
 
-  bool has_effect = (words_effect_ != EFFECT_NONE);
-  
-  std::vector<int> words_leds;
-  if (hours_light_ && hours_light_->is_on()) {
-    words_leds.insert(words_leds.end(), active_hours_leds_.begin(), active_hours_leds_.end());
+void WordClock::begin_effect_program(EffectVmFrame &program, int effect, int count, const FrameContext &ctx,
+                                     int layer, uint32_t budget) {
+  int slot = effect_program_slot(effect);
+  const EffectProgram &code = effect_vm_.program(slot);
+  bool per_led = program.begin(code, ctx.layers[layer].effect_phase, count, budget);
+
+  // Logged on change only: the lit LED count moves with the time
+  if (per_led == !program_downgraded_[layer]) return;
+  program_downgraded_[layer] = !per_led;
+  if (per_led) {
+    ESP_LOGD(TAG, "Effect program %d back to per-LED colours", slot);
+  } else {
+    ESP_LOGW(TAG, "Effect program %d: %u cycles x %d LEDs over its %u-cycle share of the frame budget, "
+             "one colour per frame", slot, (unsigned) code.cycles, count, (unsigned) budget);
   }
-  if (minutes_light_ && minutes_light_->is_on()) {
-    words_leds.insert(words_leds.end(), active_minutes_leds_.begin(), active_minutes_leds_.end());
+}
+#endif
+
+// ============================================================================
+// Layer Colors
+// ============================================================================
+
+Color WordClock::seconds_effect_color(const FrameContext& ctx) {
+  const LayerRenderConfig &cfg = render_config_.layers[LIGHT_SECONDS];
+  const LayerPhase &phase = ctx.layers[LIGHT_SECONDS];
+  const Color &seconds = render_config_.colors.seconds;
+  // Seconds effects are uniform over the ring: one color per frame
+  switch (cfg.effect) {
+#ifdef USE_WORDCLOCK_EFFECT_RAINBOW
+    case EFFECT_RAINBOW:
+      return hsv_to_rgb(phase.hue_time, 1.0f, cfg.brightness_mult);
+#endif
+#ifdef USE_WORDCLOCK_EFFECT_PULSE
+    case EFFECT_PULSE: {
+      float pulse = phase.pulse_wave * cfg.brightness_mult * 2.0f;
+      if (pulse > 1.0f) pulse = 1.0f;
+      return Color(uint8_t(seconds.r * pulse), uint8_t(seconds.g * pulse), uint8_t(seconds.b * pulse));
+    }
+#endif
+#ifdef USE_WORDCLOCK_EFFECT_BREATHE
+    case EFFECT_BREATHE: {
+      float breathe = phase.breathe_wave * cfg.brightness_mult * 2.0f;
+      if (breathe > 1.0f) breathe = 1.0f;
+      return Color(uint8_t(seconds.r * breathe), uint8_t(seconds.g * breathe), uint8_t(seconds.b * breathe));
+    }
+#endif
+#ifdef USE_WORDCLOCK_EFFECT_COLOR_CYCLE
+    case EFFECT_COLOR_CYCLE:
+      return hsv_to_rgb(phase.color_cycle_hue, 1.0f, cfg.brightness_mult);
+#endif
+    default:
+#ifdef USE_WORDCLOCK_PALETTES
+      if (effect_palette_index(cfg.effect) >= 0) {
+        // One sample per frame, at the rainbow's ring hue
+        bool loaded = effect_palette_index(cfg.effect) < palette_count_;
+        return loaded ? palette_luts_[LIGHT_SECONDS].sample(palette_index(phase.hue_time)) : seconds;
+      }
+#endif
+#ifdef USE_WORDCLOCK_EFFECT_VM
+      // Hand and trail colour: one run at x = y = i = 0
+      if (effect_program_slot(cfg.effect) >= 0) {
+        EffectVmFrame program;
+        program.begin(effect_vm_.program(effect_program_slot(cfg.effect)), phase.effect_phase, 1);
+        return program.run(0, 0, 0, seconds);
+      }
+#endif
+      return seconds;
   }
+}
+
+Color WordClock::seconds_trail_color(const FrameContext& ctx) {
+  // The trail starts from the hand colour of rainbow and palette effects,
+  // from the plain seconds colour otherwise
+  const LayerRenderConfig &cfg = render_config_.layers[LIGHT_SECONDS];
+#ifdef USE_WORDCLOCK_EFFECT_RAINBOW
+  if (cfg.effect == EFFECT_RAINBOW) {
+    return hsv_to_rgb(ctx.layers[LIGHT_SECONDS].hue_time, 1.0f, cfg.brightness_mult);
+  }
+#endif
+#ifdef USE_WORDCLOCK_PALETTES
+  if (effect_palette_index(cfg.effect) >= 0) return seconds_effect_color(ctx);
+#endif
+  return render_config_.colors.seconds;
+}
+
+// ============================================================================
+// Frame Composition
+// ============================================================================
+//
+// One pass over the strip. Each LED is painted from its composition state
+// (led_compose_) in layer order - words, seconds or sweep, seconds trail,
+// word fade-out, background - a later layer replacing an earlier one, and
+// written to the framebuffer once. Layer values that are the same for every
+// LED (effect phases, the hand colour, the trail table) are set up before
+// the pass.
+
+float WordClock::compose_frame(const FrameContext& ctx, bool words_enabled) {
+  auto &frame = this->frame();
+  const RenderConfig &cfg = render_config_;
+  const LightColors &colors = cfg.colors;
+  const Color black(0, 0, 0);
+  constexpr uint8_t none = LedComposeState::NO_POSITION;
+
+  // Words: hours then minutes; the rainbow hue follows the position in this
+  // order, counting only the layers that are on. Each LED takes the effect
+  // of its own layer (minutes when it is in both)
+  bool hours_on = layer_lights_[LIGHT_HOURS].on;
+  bool minutes_on = layer_lights_[LIGHT_MINUTES].on;
+  bool words_effect = words_enabled && (cfg.layers[LIGHT_HOURS].effect != EFFECT_NONE ||
+                                        cfg.layers[LIGHT_MINUTES].effect != EFFECT_NONE);
+  int minutes_offset = hours_on ? int(active_hours_leds_.size()) : 0;
 
   auto get_fade_in_progress = [&](int led) -> float {
-    auto it = typing_in_leds_.find(led);
-    if (it == typing_in_leds_.end()) return 1.0f;
-    uint32_t start_time = it->second.first;
-    int seq = it->second.second;
+    auto *typing = typing_in_leds_.find(led);
+    if (typing == nullptr) return 1.0f;
+    uint32_t start_time = typing->first;
+    int seq = typing->second;
     float delay = seq * typing_delay_;
-    float elapsed = (params.now_ms - start_time) / 1000.0f - delay;
+    float elapsed = (ctx.now_ms - start_time) / 1000.0f - delay;
     // FIX H2: Return -1 for LEDs still waiting for their typing delay
     // This signals to skip rendering entirely (not even background)
     if (elapsed < 0) return -1.0f;
     if (words_fade_in_duration_ <= 0) {
-      typing_in_leds_.erase(it);
+      typing_in_leds_.erase(led);
       return 1.0f;
     }
     float progress = elapsed / words_fade_in_duration_;
     if (progress >= 1.0f) {
-      typing_in_leds_.erase(it);
+      typing_in_leds_.erase(led);
       return 1.0f;
     }
     // Ensure minimum visible progress to avoid flash
     return std::max(0.01f, progress);
   };
 
-  if (has_effect) {
-    for (size_t i = 0; i < words_leds.size(); i++) {
-      int led = words_leds[i];
-      if (is_excluded_led(led, num_leds_)) continue;
-      float fade_progress = get_fade_in_progress(led);
-      // FIX H2: Skip LED entirely if waiting for typing delay (-1)
-      // Don't write anything, preserving previous state
-      if (fade_progress < 0.0f) {
-        continue;
-      }
-      Color base_color = (std::find(active_hours_leds_.begin(), active_hours_leds_.end(), led) != active_hours_leds_.end()) ? colors.hours : colors.minutes;
-      Color color;
-      switch (words_effect_) {
-        case EFFECT_RAINBOW: {
-          float hue = fmod(i * params.hue_per_led + params.hue_time, 1.0f);
-          color = hsv_to_rgb(hue, 1.0f, params.words_brightness_mult);
-          break;
-        }
-        case EFFECT_PULSE: {
-          float phase = fmod((float)params.now_ms, params.pulse_period) / params.pulse_period;
-          float pulse = (sinf(phase * 2.0f * 3.14159f) + 1.0f) / 2.0f;
-          pulse = config::PULSE_MIN_INTENSITY + pulse * config::PULSE_INTENSITY_RANGE;
-          pulse *= params.words_brightness_mult * 2.0f;
-          if (pulse > 1.0f) pulse = 1.0f;
-          color = Color(uint8_t(base_color.r * pulse), uint8_t(base_color.g * pulse), uint8_t(base_color.b * pulse));
-          break;
-        }
-        case EFFECT_BREATHE: {
-          float phase = fmod((float)params.now_ms, params.breathe_period) / params.breathe_period;
-          float breathe = (sinf(phase * 2.0f * 3.14159f) + 1.0f) / 2.0f;
-          breathe = config::BREATHE_MIN_INTENSITY + breathe * config::BREATHE_INTENSITY_RANGE;
-          breathe *= params.words_brightness_mult * 2.0f;
-          if (breathe > 1.0f) breathe = 1.0f;
-          color = Color(uint8_t(base_color.r * breathe), uint8_t(base_color.g * breathe), uint8_t(base_color.b * breathe));
-          break;
-        }
-        case EFFECT_COLOR_CYCLE: {
-          float t_cycle = fmod((float)params.now_ms, params.color_cycle_period) / params.color_cycle_period;
-          color = hsv_to_rgb(t_cycle, 1.0f, params.words_brightness_mult);
-          break;
-        }
-        default:
-          color = base_color;
-          break;
-      }
-      if (fade_progress < 1.0f) {
-        color = blend_colors(colors.background, color, fade_progress);
-      }
-      (*output)[led] = color;
-      prev_led_colors_[led] = color;
-    }
-  } else {
-    for (int led : active_hours_leds_) {
-      if (is_excluded_led(led, num_leds_)) continue;
-      float fade_progress = get_fade_in_progress(led);
-      // FIX H2: Skip LED entirely if waiting for typing delay
-      if (fade_progress < 0.0f) {
-        continue;
-      }
-      Color color = (fade_progress < 1.0f) ? blend_colors(colors.background, colors.hours, fade_progress) : colors.hours;
-      (*output)[led] = color;
-      prev_led_colors_[led] = color;
-    }
-    for (int led : active_minutes_leds_) {
-      if (is_excluded_led(led, num_leds_)) continue;
-      float fade_progress = get_fade_in_progress(led);
-      // FIX H2: Skip LED entirely if waiting for typing delay
-      if (fade_progress < 0.0f) {
-        continue;
-      }
-      Color color = (fade_progress < 1.0f) ? blend_colors(colors.background, colors.minutes, fade_progress) : colors.minutes;
-      (*output)[led] = color;
-      prev_led_colors_[led] = color;
+#ifdef USE_WORDCLOCK_EFFECT_VM
+  // Layers that are on and run a program share EFFECT_VM_FRAME_CYCLES
+  std::array<EffectVmFrame, EFFECT_LAYER_COUNT> programs;
+  std::array<bool, EFFECT_LAYER_COUNT> runs_program = {
+      words_effect && hours_on, words_effect && minutes_on,
+      layer_lights_[LIGHT_SECONDS].on && seconds_mode_ != SECONDS_SWEEP, layer_lights_[LIGHT_BACKGROUND].on};
+  int program_layers = 0;
+  for (int layer = 0; layer < EFFECT_LAYER_COUNT; layer++) {
+    runs_program[layer] = runs_program[layer] && effect_program_slot(cfg.layers[layer].effect) >= 0;
+    program_layers += runs_program[layer];
+  }
+  uint32_t program_budget = config::EFFECT_VM_FRAME_CYCLES / uint32_t(std::max(program_layers, 1));
+  // Hours and minutes programs see the words count, as one layer did
+  int words_count = (hours_on ? int(active_hours_leds_.size()) : 0) + (minutes_on ? int(active_minutes_leds_.size()) : 0);
+  for (int layer : {LIGHT_HOURS, LIGHT_MINUTES}) {
+    if (runs_program[layer]) {
+      begin_effect_program(programs[layer], cfg.layers[layer].effect, words_count, ctx, layer, program_budget);
     }
   }
-}
-
-// ============================================================================
-// Seconds Rendering with Effects
-// ============================================================================
-
-void WordClock::apply_seconds_with_effects(const LightColors& colors, const EffectParams& params) {
-  auto output = static_cast<light::AddressableLight *>(strip_->get_output());
-  if (!output) return;
-
-  for (int led : active_seconds_leds_) {
-    if (is_excluded_led(led, num_leds_)) continue;
-    Color color = colors.seconds;
-    switch (seconds_effect_) {
-      case EFFECT_RAINBOW:
-        color = hsv_to_rgb(params.hue_time, 1.0f, params.seconds_brightness_mult);
-        break;
+#endif
+
+#ifdef USE_WORDCLOCK_PALETTES
+  // Rainbow phase in 16.16 fixed point: one add per LED, top byte indexes the LUT
+  std::array<bool, EFFECT_LAYER_COUNT> layer_palette{};
+  std::array<uint32_t, EFFECT_LAYER_COUNT> palette_base{};
+  for (int layer = 0; layer < EFFECT_LAYER_COUNT; layer++) {
+    int palette = effect_palette_index(cfg.layers[layer].effect);
+    layer_palette[layer] = palette >= 0 && palette < palette_count_;
+    palette_base[layer] = uint32_t(ctx.layers[layer].hue_time * 65536.0f);
+  }
+  uint32_t palette_step = uint32_t(cfg.hue_per_led * 65536.0f);
+#endif
+
+  // Effect colour of a word or background LED; index is its rainbow position
+  auto layer_effect_color = [&](int layer, int led, int index, Color base_color) -> Color {
+    const LayerRenderConfig &layer_cfg = cfg.layers[layer];
+    const LayerPhase &phase = ctx.layers[layer];
+    switch (layer_cfg.effect) {
+      case EFFECT_NONE:
+        return base_color;
+#ifdef USE_WORDCLOCK_EFFECT_RAINBOW
+      case EFFECT_RAINBOW: {
+        float hue = fmod(index * cfg.hue_per_led + phase.hue_time, 1.0f);
+        return hsv_to_rgb(hue, 1.0f, layer_cfg.brightness_mult);
+      }
+#endif
+#ifdef USE_WORDCLOCK_EFFECT_PULSE
       case EFFECT_PULSE: {
-        float phase = fmod((float)params.now_ms, params.pulse_period) / params.pulse_period;
-        float pulse = (sinf(phase * 2.0f * 3.14159f) + 1.0f) / 2.0f;
-        pulse = config::PULSE_MIN_INTENSITY + pulse * config::PULSE_INTENSITY_RANGE;
-        pulse *= params.seconds_brightness_mult * 2.0f;
+        float pulse = phase.pulse_wave * layer_cfg.brightness_mult * 2.0f;
         if (pulse > 1.0f) pulse = 1.0f;
-        color = Color(uint8_t(colors.seconds.r * pulse), uint8_t(colors.seconds.g * pulse), uint8_t(colors.seconds.b * pulse));
-        break;
+        return Color(uint8_t(base_color.r * pulse), uint8_t(base_color.g * pulse), uint8_t(base_color.b * pulse));
       }
+#endif
+#ifdef USE_WORDCLOCK_EFFECT_BREATHE
       case EFFECT_BREATHE: {
-        float phase = fmod((float)params.now_ms, params.breathe_period) / params.breathe_period;
-        float breathe = (sinf(phase * 2.0f * 3.14159f) + 1.0f) / 2.0f;
-        breathe = config::BREATHE_MIN_INTENSITY + breathe * config::BREATHE_INTENSITY_RANGE;
-        breathe *= params.seconds_brightness_mult * 2.0f;
+        float breathe = phase.breathe_wave * layer_cfg.brightness_mult * 2.0f;
         if (breathe > 1.0f) breathe = 1.0f;
-        color = Color(uint8_t(colors.seconds.r * breathe), uint8_t(colors.seconds.g * breathe), uint8_t(colors.seconds.b * breathe));
-        break;
-      }
-      case EFFECT_COLOR_CYCLE: {
-        float t_cycle = fmod((float)params.now_ms, params.color_cycle_period) / params.color_cycle_period;
-        color = hsv_to_rgb(t_cycle, 1.0f, params.seconds_brightness_mult);
-        break;
+        return Color(uint8_t(base_color.r * breathe), uint8_t(base_color.g * breathe),
+                     uint8_t(base_color.b * breathe));
       }
+#endif
+#ifdef USE_WORDCLOCK_EFFECT_COLOR_CYCLE
+      case EFFECT_COLOR_CYCLE:
+        return hsv_to_rgb(phase.color_cycle_hue, 1.0f, layer_cfg.brightness_mult);
+#endif
       default:
-        break;
+#ifdef USE_WORDCLOCK_PALETTES
+        if (layer_palette[layer]) {
+          return palette_luts_[layer].sample(uint8_t((palette_base[layer] + uint32_t(index) * palette_step) >> 8));
+        }
+#endif
+#ifdef USE_WORDCLOCK_EFFECT_VM
+        if (effect_program_slot(layer_cfg.effect) >= 0) {
+          return programs[layer].color(get_led_x(led), led / 16, index, base_color);
+        }
+#endif
+        return base_color;
     }
-    (*output)[led] = color;
-    prev_led_colors_[led] = color;
-  }
-}
-
-// ============================================================================
-// Fade Effects - Using array-based seconds access
-// ============================================================================
+  };
 
-void WordClock::apply_seconds_fades(Color background_color, const EffectParams& params) {
-  auto output = static_cast<light::AddressableLight *>(strip_->get_output());
-  if (!output) return;
+  // Seconds: one colour per frame, or per LED for effect programs
+  bool seconds_on = layer_lights_[LIGHT_SECONDS].on;
+  bool sweep = seconds_mode_ == SECONDS_SWEEP;
+  bool paint_seconds = seconds_on && !sweep;
+  bool paint_sweep = seconds_on && sweep;
+  Color seconds_color = black;
+#ifdef USE_WORDCLOCK_EFFECT_VM
+  int seconds_effect = cfg.layers[LIGHT_SECONDS].effect;
+  bool seconds_per_led = runs_program[LIGHT_SECONDS];
+  if (seconds_per_led) {
+    begin_effect_program(programs[LIGHT_SECONDS], seconds_effect, int(active_seconds_leds_.size()), ctx,
+                         LIGHT_SECONDS, program_budget);
+  }
+#endif
+  if (paint_seconds || paint_sweep) {
+#ifdef USE_WORDCLOCK_EFFECT_VM
+    if (!seconds_per_led) seconds_color = seconds_effect_color(ctx);
+#else
+    seconds_color = seconds_effect_color(ctx);
+#endif
+  }
+  // Sweep: fractional hand position, the hand shared between the two ring
+  // LEDs around it and a trail decaying at frame rate
+  float sweep_position = last_seconds_ + ctx.second_phase;
+
+  // Trail of the seconds that went out: eased progress per whole-second age
+  bool paint_trail = false;
+  Color trail_color = black;
+  const std::array<float, 60> *trail = nullptr;
+  int trail_end = 1;  ///< Ages 1 .. trail_end - 1 are drawn
+  if (!sweep) {
+    if (!seconds_on || seconds_fade_out_duration_ <= 0) {
+      seconds_fades_.clear();
+    } else {
+      paint_trail = true;
+      trail_color = seconds_trail_color(ctx);
+      trail = &seconds_ring_.trail_progress(seconds_fade_out_duration_);
+      int fade_seconds = int(seconds_fade_out_duration_);
+      while (trail_end <= fade_seconds && trail_end < 60 && (*trail)[trail_end] >= 0.0f) trail_end++;
+    }
+  }
 
-  if (!(seconds_light_ && seconds_light_->is_on()) || seconds_fade_out_duration_ <= 0) {
-    seconds_fades_.clear();
-    return;
+  // Background: its effect runs along the grid diagonals. Fades, the sweep
+  // and the trail blend towards it, so it is computed on first use per LED
+  bool background_on = layer_lights_[LIGHT_BACKGROUND].on;
+  bool background_effect = background_on && cfg.layers[LIGHT_BACKGROUND].effect != EFFECT_NONE;
+#ifdef USE_WORDCLOCK_EFFECT_VM
+  if (runs_program[LIGHT_BACKGROUND]) {
+    begin_effect_program(programs[LIGHT_BACKGROUND], cfg.layers[LIGHT_BACKGROUND].effect,
+                         int(active_background_leds_.size()), ctx, LIGHT_BACKGROUND, program_budget);
+  }
+#endif
+
+  // Fades only end during the pass, so empty maps stay empty
+  bool word_fades = !led_fades_.empty();
+  bool typing = !typing_in_leds_.empty();
+
+  // Static layers: an LED whose layers are all without effect keeps its
+  // colour (prev_led_colors_) until the cache is invalidated, i.e. until the
+  // active LEDs or a control change. Typing and word fades bypass the cache
+  // for the frame; trail, sweep and fading seconds LEDs are never cached
+  if (!static_cache_valid_) {
+    static_leds_.clear();
+    static_written_.clear();
+    static_cache_valid_ = true;
+  }
+  bool use_cache = !typing && !word_fades;
+  uint8_t animated_layers = 0;
+  for (int layer = 0; layer < EFFECT_LAYER_COUNT; layer++) {
+    if (cfg.layers[layer].effect != EFFECT_NONE) animated_layers |= uint8_t(1u << layer);
   }
 
-  int current_second = last_seconds_;
-  int fade_seconds = (int)seconds_fade_out_duration_;
-  
-  for (int s = 1; s <= fade_seconds && s < 60; s++) {
-    int past_second = current_second - s;
-    if (past_second <= 0) past_second += 60;
-    if (past_second == config::SECONDS_RING_GAP) continue;
-    
-    const auto& leds = get_second_leds(past_second);
-    if (leds.empty()) continue;
-    int led = leds[0];
-    
-    bool is_active = std::find(active_seconds_leds_.begin(), active_seconds_leds_.end(), led) != active_seconds_leds_.end();
-    if (is_active) continue;
-    
-    float progress = (float)s / seconds_fade_out_duration_;
-    if (progress < 1.0f) {
-      Color from_color = (seconds_effect_ == EFFECT_RAINBOW) 
-                         ? hsv_to_rgb(params.hue_time, 1.0f, params.seconds_brightness_mult)
-                         : get_light_color_safe(seconds_light_, SECONDS_BRIGHTNESS_RANGE);
-      Color blended = blend_colors(from_color, background_color, progress);
-      (*output)[led] = blended;
-      prev_led_colors_[led] = blended;
-    }
+#ifdef USE_WORDCLOCK_MARQUEE
+  // Marquee: the letter grid shows the lit glyph pixels of the window
+  // instead of the clock (frame only, like the overlays)
+  LedSet marquee_lit;
+  bool marquee_on = marquee_.render(ctx.now_ms, marquee_lit);
+#endif
+
+#ifdef USE_WORDCLOCK_OVERLAYS
+  // Overlays: weights per frame, composited over the clock colour of their
+  // LEDs in the frame only (prev_led_colors_ keeps the clock colour)
+  overlays_.expire(ctx.now_ms);
+  int overlay_count = overlays_.size();
+  std::array<uint8_t, config::OVERLAY_SLOTS> overlay_levels{};
+  for (int i = 0; i < overlay_count; i++) {
+    const OverlayEntry &entry = overlays_[i];
+    overlay_levels[i] = overlay_level(ctx.now_ms - entry.start_ms, entry.duration_ms,
+                                      overlay_presets_[entry.preset].flash_ms);
   }
-}
+#endif
+
+  auto background_color = [&](int led) -> Color {
+    if (!background_effect) return colors.background;
+    return layer_effect_color(LIGHT_BACKGROUND, led, get_led_x(led) + led / 16, colors.background);
+  };
 
-void WordClock::apply_word_fades(Color background_color) {
-  auto output = static_cast<light::AddressableLight *>(strip_->get_output());
-  if (!output) return;
-  uint32_t now_ms = millis();
-
-  for (auto it = led_fades_.begin(); it != led_fades_.end(); ) {
-    int led = it->first;
-    LedFadeState &fade = it->second;
-    
-    // Use O(1) led_type_index_ instead of O(n) find
-    LightType current_type = get_led_type(led);
-    bool is_active = (current_type == LIGHT_HOURS || current_type == LIGHT_MINUTES || current_type == LIGHT_SECONDS);
-    if (is_active) {
-      it = led_fades_.erase(it);
+  float total_change = 0;
+  int changed_leds = 0;
+  for (int led = 0; led < num_leds_; led++) {
+    const LedComposeState &state = led_compose_[led];
+    if (state.excluded) {
+      frame[led] = black;
       continue;
     }
-    
-    float delay = fade.sequence_index * typing_delay_;
-    float elapsed = (now_ms - fade.fade_start) / 1000.0f - delay;
-    
-    if (elapsed < 0) {
-      (*output)[led] = fade.from_color;
-      prev_led_colors_[led] = fade.from_color;
-      ++it;
+    Color color = black;
+    bool written = false;
+    bool cached = use_cache && static_leds_.contains(led);
+    if (cached) {
+      written = static_written_.contains(led);
+      if (written) color = prev_led_colors_[led];
     } else {
-      float progress = elapsed / fade.fade_duration;
-      if (progress >= 1.0f) {
-        (*output)[led] = background_color;
-        prev_led_colors_[led] = background_color;
-        it = led_fades_.erase(it);
-      } else {
-        Color blended = blend_colors(fade.from_color, background_color, progress);
-        (*output)[led] = blended;
-        prev_led_colors_[led] = blended;
-        ++it;
+
+      // Words
+      if (words_enabled && (state.hours != none || state.minutes != none)) {
+        int index = -1;
+        int layer = LIGHT_HOURS;
+        if (!words_effect) {
+          index = 0;
+        } else if (minutes_on && state.minutes != none) {
+          index = minutes_offset + state.minutes;
+          layer = LIGHT_MINUTES;
+        } else if (hours_on && state.hours != none) {
+          index = state.hours;
+        }
+        // FIX H2: LEDs waiting for their typing delay are left unpainted
+        float fade_progress = index < 0 ? -1.0f : typing ? get_fade_in_progress(led) : 1.0f;
+        if (fade_progress >= 0.0f) {
+          Color base_color = cfg.word_colors[led_color_index_[led]];
+          color = words_effect ? layer_effect_color(layer, led, index, base_color) : base_color;
+          if (fade_progress < 1.0f) {
+            color = blend_colors(background_color(led), color, fade_progress);
+          }
+          written = true;
+        }
       }
-    }
-  }
-}
 
-void WordClock::apply_background(Color background_color) {
-  auto output = static_cast<light::AddressableLight *>(strip_->get_output());
-  if (!output) return;
-  if (!(background_light_ && background_light_->is_on())) return;
+      // Seconds, or the sweep hand and its trail
+      if (paint_seconds && state.seconds != none) {
+#ifdef USE_WORDCLOCK_EFFECT_VM
+        color = seconds_per_led
+                    ? programs[LIGHT_SECONDS].color(get_led_x(led), led / 16, state.seconds, colors.seconds)
+                    : seconds_color;
+#else
+        color = seconds_color;
+#endif
+        written = true;
+      } else if (paint_sweep && state.ring != 0) {
+        float age = sweep_position - state.ring;  // > 0: behind the hand
+        if (age < -1.0f) age += 60.0f;            // wrapped round the ring
+        float head = age < 0.0f ? 1.0f + age : 1.0f - age;
+        uint8_t level = head > 0.0f ? uint8_t(head * 255.0f + 0.5f) : 0;
+        level = std::max(level, seconds_trail_level(age, seconds_fade_out_duration_));
+        if (level != 0) {
+          color = lerp_colors(background_color(led), seconds_color, level);
+          written = true;
+        }
+      }
 
-  for (int led : active_background_leds_) {
-    if (is_excluded_led(led, num_leds_)) continue;
-    if (led_fades_.find(led) != led_fades_.end()) continue;
-    if (seconds_fades_.find(led) != seconds_fades_.end()) continue;
-    Color current = Color((*output)[led].get_red(), (*output)[led].get_green(), (*output)[led].get_blue());
-    if (current.r > 0 || current.g > 0 || current.b > 0) continue;
-    (*output)[led] = background_color;
-    prev_led_colors_[led] = background_color;
+      // Seconds trail
+      if (paint_trail && state.ring != 0 && !(active_seconds_mask_ & (1ULL << state.ring))) {
+        int age = (last_seconds_ - state.ring + 60) % 60;
+        if (age >= 1 && age < trail_end) {
+          color = blend_colors_eased(trail_color, background_color(led), (*trail)[age]);
+          written = true;
+        }
+      }
+
+      // Word fade-out
+      if (LedFadeState *fade = word_fades ? led_fades_.find(led) : nullptr) {
+        // Use O(1) led_type_index_ instead of O(n) find
+        LightType current_type = get_led_type(led);
+        if (current_type == LIGHT_HOURS || current_type == LIGHT_MINUTES || current_type == LIGHT_SECONDS) {
+          led_fades_.erase(led);
+        } else {
+          float delay = fade->sequence_index * typing_delay_;
+          float elapsed = (ctx.now_ms - fade->fade_start) / 1000.0f - delay;
+          if (elapsed < 0) {
+            color = fade->from_color;
+          } else {
+            float progress = elapsed / fade->fade_duration;
+            if (progress >= 1.0f) {
+              color = background_color(led);
+              led_fades_.erase(led);
+            } else {
+              color = blend_colors(fade->from_color, background_color(led), progress);
+            }
+          }
+          written = true;
+        }
+      }
+
+      // Background, under whatever left the LED black
+      if (background_on && state.background && color.r == 0 && color.g == 0 && color.b == 0 &&
+          !(word_fades && led_fades_.contains(led)) && !seconds_fades_.contains(led)) {
+        color = background_color(led);
+        written = true;
+      }
+
+      uint8_t layers = (state.hours != none ? 1u << LIGHT_HOURS : 0u) | (state.minutes != none ? 1u << LIGHT_MINUTES : 0u) |
+                       (state.seconds != none ? 1u << LIGHT_SECONDS : 0u) |
+                       (state.background ? 1u << LIGHT_BACKGROUND : 0u);
+      bool ring_animated = state.ring != 0 && (paint_trail || paint_sweep);
+      if (use_cache && (layers & animated_layers) == 0 && !ring_animated && !seconds_fades_.contains(led)) {
+        static_leds_.insert(led);
+        if (written) static_written_.insert(led);
+      }
+    }
+
+    Color shown = color;
+#ifdef USE_WORDCLOCK_MARQUEE
+    if (marquee_on && marquee_.grid().contains(led)) {
+      shown = marquee_lit.contains(led) ? marquee_.color() : black;
+    }
+#endif
+#ifdef USE_WORDCLOCK_OVERLAYS
+    for (int i = 0; i < overlay_count; i++) {
+      const OverlayPreset &preset = overlay_presets_[overlays_[i].preset];
+      if (overlay_levels[i] != 0 && preset.leds.contains(led)) {
+        shown = overlay_blend(shown, preset.color, overlay_levels[i], preset.blend);
+      }
+    }
+#endif
+    frame[led] = shown;
+    if (written) {
+      prev_led_colors_[led] = color;
+    } else {
+      // Visual change: only unpainted LEDs can differ from their last colour
+      const Color &previous = prev_led_colors_[led];
+      int diff = previous.r + previous.g + previous.b;
+      if (diff > 0) {
+        total_change += diff;
+        changed_leds++;
+      }
+    }
   }
+  return changed_leds > 0 ? (total_change / (changed_leds * 765.0f)) : 0.0f;
 }
 
 // ============================================================================
 // LED Change Detection
 // ============================================================================
 
-void WordClock::detect_led_changes() {
-  uint32_t now_ms = millis();
-  
-  std::set<int> current_words_set;
-  std::set<int> current_seconds_set;
+void WordClock::detect_led_changes(uint32_t now_ms) {
+  LedSet current_words_set;
+  LedSet current_seconds_set;
   for (int led : active_hours_leds_) current_words_set.insert(led);
   for (int led : active_minutes_leds_) current_words_set.insert(led);
   for (int led : active_seconds_leds_) current_seconds_set.insert(led);
@@ -382,63 +627,44 @@ void WordClock::detect_led_changes() {
   if (words_fade_in_duration_ > 0 || typing_delay_ > 0) {
     // Use typing_sequence_ which preserves the order words were added
     // This respects language-specific word order (FR: hours then minutes, EN: minutes then hours)
-    std::vector<int> new_words;
+    int seq = 0;
     for (int led : typing_sequence_) {
       if (prev_led_types_[led] == LIGHT_BACKGROUND) {
-        new_words.push_back(led);
+        typing_in_leds_.set(led, {now_ms, seq++});
       }
     }
-    
-    for (size_t seq = 0; seq < new_words.size(); seq++) {
-      typing_in_leds_[new_words[seq]] = {now_ms, (int)seq};
-    }
-  }
-  
-  std::vector<int> words_fade_out_sequence;
-  for (int led : prev_active_words_) {
-    if (current_words_set.find(led) == current_words_set.end() &&
-        current_seconds_set.find(led) == current_seconds_set.end()) {
-      words_fade_out_sequence.push_back(led);
-    }
-  }
-  std::reverse(words_fade_out_sequence.begin(), words_fade_out_sequence.end());
-  
-  prev_active_words_.clear();
-  prev_active_words_.insert(prev_active_words_.end(), active_hours_leds_.begin(), active_hours_leds_.end());
-  prev_active_words_.insert(prev_active_words_.end(), active_minutes_leds_.begin(), active_minutes_leds_.end());
-  
-  std::vector<int> seconds_fade_out;
-  for (int i = 0; i < num_leds_; i++) {
-    if (is_excluded_led(i, num_leds_)) continue;
-    if (prev_led_types_[i] == LIGHT_SECONDS && current_seconds_set.find(i) == current_seconds_set.end()) {
-      seconds_fade_out.push_back(i);
-    }
   }
   
+  // Words that went out fade in reverse typing order
   if (words_fade_out_duration_ > 0 || typing_delay_ > 0) {
-    for (size_t seq = 0; seq < words_fade_out_sequence.size(); seq++) {
-      int led = words_fade_out_sequence[seq];
-      if (led_fades_.find(led) == led_fades_.end()) {
+    int seq = 0;
+    for (auto it = prev_active_words_.rbegin(); it != prev_active_words_.rend(); ++it) {
+      int led = *it;
+      if (current_words_set.contains(led) || current_seconds_set.contains(led)) continue;
+      int sequence_index = seq++;
+      if (!led_fades_.contains(led)) {
         LedFadeState fade;
         fade.from_color = prev_led_colors_[led];
         fade.fade_start = now_ms;
         fade.fade_duration = words_fade_out_duration_ > 0 ? words_fade_out_duration_ : 0.01f;
-        fade.sequence_index = seq;
+        fade.sequence_index = sequence_index;
         fade.from_type = prev_led_types_[led];
-        led_fades_[led] = fade;
+        led_fades_.set(led, fade);
       }
     }
   }
   
-  if (seconds_fade_out_duration_ > 0) {
-    for (int led : seconds_fade_out) {
-      LedFadeState fade;
-      fade.from_color = prev_led_colors_[led];
-      fade.fade_start = now_ms;
-      fade.fade_duration = seconds_fade_out_duration_;
-      fade.sequence_index = last_seconds_;
-      fade.from_type = LIGHT_SECONDS;
-      seconds_fades_[led] = fade;
+  prev_active_words_.clear();
+  prev_active_words_.insert(prev_active_words_.end(), active_hours_leds_.begin(), active_hours_leds_.end());
+  prev_active_words_.insert(prev_active_words_.end(), active_minutes_leds_.begin(), active_minutes_leds_.end());
+  
+  // The sweep mode draws its own trail from the hand position
+  if (seconds_fade_out_duration_ > 0 && seconds_mode_ != SECONDS_SWEEP) {
+    for (int i = 0; i < num_leds_; i++) {
+      if (is_excluded_led(i, num_leds_)) continue;
+      if (prev_led_types_[i] == LIGHT_SECONDS && !current_seconds_set.contains(i)) {
+        seconds_fades_.insert(i);
+      }
     }
   }
   
@@ -452,107 +678,73 @@ void WordClock::detect_led_changes() {
 // Boot Transition
 // ============================================================================
 
+#ifdef USE_WORDCLOCK_BOOT_ANIMATION
 void WordClock::apply_boot_transition() {
+  // Crossfade "42" -> time in one pass over the framebuffer: per-frame
+  // weights in 8 bits, LED spans precomputed, no heap traffic
   if (!strip_ || !power_on_) return;
-  auto output = static_cast<light::AddressableLight *>(strip_->get_output());
-  if (!output) return;
+  auto &frame = this->frame();
 
-  uint32_t now_ms = millis();
+  uint32_t now_ms = get_millis();
   float elapsed = (now_ms - boot_transition_start_) / 1000.0f;
   float progress = elapsed / words_fade_out_duration_;
   if (progress > 1.0f) progress = 1.0f;
+  float eased_progress = progress * progress * (3.0f - 2.0f * progress);
+  uint8_t fade_in = uint8_t(eased_progress * 255.0f + 0.5f);
+  uint8_t ring_fade = uint8_t((1.0f - progress) * 255.0f + 0.5f);
 
+  Color black(0, 0, 0);
+  Color background_color = render_config_.colors.background;
   for (int i = 0; i < num_leds_; i++) {
-    (*output)[i] = Color(0, 0, 0);
+    frame[i] = is_excluded_led(i, num_leds_) ? black : background_color;
   }
 
-  Color background_color = get_light_color_safe(background_light_, BACKGROUND_BRIGHTNESS_RANGE);
-
-  // Get "42" LEDs using StringPool
-  size_t key_idx = StringPool::instance().intern("42");
-  auto it = ledsarray_misc_.find(key_idx);
-  
   float t = fmod(1.0f - (float)now_ms / (config::BOOT_CYCLE_TIME_S * 1000.0f), 1.0f);
   if (t < 0) t += 1.0f;
-  float hue_per_led = (config::BOOT_RAINBOW_SPREAD / 100.0f) * config::HUE_SPREAD_FACTOR;
 
-  std::map<int, Color> boot_colors;
-  if (it != ledsarray_misc_.end()) {
-    const auto& boot_leds = it->second;
-    for (size_t i = 0; i < boot_leds.size(); i++) {
-      int led = boot_leds[i];
-      if (!is_excluded_led(led, num_leds_)) {
-        float hue = fmod(i * hue_per_led + t, 1.0f);
-        Color color = hsv_to_rgb(hue, 1.0f, config::BOOT_BRIGHTNESS_MULT);
-        color = blend_colors(color, Color(0, 0, 0), progress);
-        boot_colors[led] = color;
-      }
-    }
-  }
-
-  std::vector<int> time_words_leds;
-  time_words_leds.insert(time_words_leds.end(), active_hours_leds_.begin(), active_hours_leds_.end());
-  time_words_leds.insert(time_words_leds.end(), active_minutes_leds_.begin(), active_minutes_leds_.end());
-  
-  float time_hue_per_led = (rainbow_spread_ / 100.0f) * config::HUE_SPREAD_FACTOR;
-  float time_words_brightness_mult = words_effect_brightness_ / 100.0f;
-
-  std::map<int, Color> time_colors;
-  for (size_t i = 0; i < time_words_leds.size(); i++) {
-    int led = time_words_leds[i];
-    if (!is_excluded_led(led, num_leds_)) {
-      float hue = fmod(i * time_hue_per_led + t, 1.0f);
-      Color color = hsv_to_rgb(hue, 1.0f, time_words_brightness_mult);
-      color = blend_colors(Color(0, 0, 0), color, progress);
-      time_colors[led] = color;
-    }
+  // "42" fading out
+  float hue_per_led = (config::BOOT_RAINBOW_SPREAD / 100.0f) * config::HUE_SPREAD_FACTOR;
+  for (int i = 0; i < boot_animation_.matrix_count(); i++) {
+    int led = boot_animation_.matrix_led(i);
+    if (is_excluded_led(led, num_leds_)) continue;
+    float hue = fmod(i * hue_per_led + t, 1.0f);
+    frame[led] = lerp_colors(hsv_to_rgb(hue, 1.0f, config::BOOT_BRIGHTNESS_MULT), black, fade_in);
   }
 
-  for (int i = 0; i < num_leds_; i++) {
-    if (is_excluded_led(i, num_leds_)) continue;
-    Color final_color = background_color;
-    if (boot_colors.find(i) != boot_colors.end()) {
-      final_color = boot_colors[i];
-    }
-    if (time_colors.find(i) != time_colors.end()) {
-      final_color = blend_colors(final_color, time_colors[i], progress);
-    }
-    (*output)[i] = final_color;
+  // Time words fading in over it, rainbow-indexed in hours+minutes order.
+  // Walked backwards so an LED shared by two words keeps the later color.
+  float time_hue_per_led = render_config_.hue_per_led;
+  float hours_brightness_mult = render_config_.layers[LIGHT_HOURS].brightness_mult;
+  float minutes_brightness_mult = render_config_.layers[LIGHT_MINUTES].brightness_mult;
+  size_t hours_count = active_hours_leds_.size();
+  size_t words_count = hours_count + active_minutes_leds_.size();
+  std::array<uint64_t, 4> written{};
+  for (size_t i = words_count; i-- > 0;) {
+    int led = i < hours_count ? active_hours_leds_[i] : active_minutes_leds_[i - hours_count];
+    if (is_excluded_led(led, num_leds_)) continue;
+    uint64_t bit = 1ULL << (led & 63);
+    if (written[led >> 6] & bit) continue;
+    written[led >> 6] |= bit;
+    float hue = fmod(i * time_hue_per_led + t, 1.0f);
+    float brightness_mult = i < hours_count ? hours_brightness_mult : minutes_brightness_mult;
+    Color time_color = lerp_colors(black, hsv_to_rgb(hue, 1.0f, brightness_mult), fade_in);
+    frame[led] = lerp_colors(frame[led], time_color, fade_in);
   }
 
-  // Ring fade out using array access
-  Color ring_color = Color(0, 255, 0);
-  int ring_position = (now_ms / config::BOOT_RING_ROTATION_MS) % config::SECONDS_RING_SIZE;
-
-  for (int i = 1; i <= 59; i++) {
-    if (i == config::SECONDS_RING_GAP) continue;
-    const auto& leds = get_second_leds(i);
-    if (leds.empty()) continue;
-    int led = leds[0];
-    int idx = (i <= 29) ? (i - 1) : (i - 2);
-    int distance = idx - ring_position;
-    if (distance < 0) distance += config::SECONDS_RING_SIZE;
-    
-    if (distance < config::BOOT_RING_TRAIL_LENGTH) {
-      float brightness = 1.0f - (float)distance / (float)config::BOOT_RING_TRAIL_LENGTH;
-      brightness = brightness * brightness;
-      brightness *= (1.0f - progress);
-      Color ring_led_color = Color(
-        uint8_t(ring_color.r * brightness * config::BOOT_BRIGHTNESS_MULT),
-        uint8_t(ring_color.g * brightness * config::BOOT_BRIGHTNESS_MULT),
-        uint8_t(ring_color.b * brightness * config::BOOT_BRIGHTNESS_MULT)
-      );
-      Color existing = Color((*output)[led].get_red(), (*output)[led].get_green(), (*output)[led].get_blue());
-      (*output)[led] = Color(
-        std::min(255, existing.r + ring_led_color.r),
-        std::min(255, existing.g + ring_led_color.g),
-        std::min(255, existing.b + ring_led_color.b)
-      );
-    }
+  // Green status ring fading out, added on top
+  int ring_position = BootAnimation::ring_position(now_ms);
+  for (int s = 1; s <= 59; s++) {
+    if (s == config::SECONDS_RING_GAP) continue;
+    int led = seconds_ring_.led(s);
+    if (led < 0) continue;
+    uint8_t level = uint8_t(BootAnimation::ring_level(s, ring_position) * ring_fade / 255);
+    Color existing = frame[led];
+    frame[led] = Color(existing.r, std::min(255, existing.g + level), existing.b);
   }
 
-  output->schedule_show();
+  present_frame();
 }
+#endif  // USE_WORDCLOCK_BOOT_ANIMATION
 
 }  // namespace wordclock
 }  // namespace esphome
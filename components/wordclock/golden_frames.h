@@ -0,0 +1,211 @@
+#pragma once
+
+#include "wordclock.h"
+#include "led_utils.h"
+#include "golden_frames_data.h"
+#include "esphome/core/log.h"
+#include <array>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace wordclock {
+namespace golden {
+
+static const char *const TAG_GOLDEN = "wordclock.golden";
+
+static constexpr int SECONDS_PER_DAY = 24 * 60 * 60;
+
+/// 256-bit LED set, order-insensitive
+using LedBitmap = std::array<uint64_t, 4>;
+
+inline void add_to_bitmap(LedBitmap &bitmap, const std::vector<int> &leds) {
+  for (int led : leds) {
+    if (led >= 0 && led < 256) bitmap[led >> 6] |= (1ULL << (led & 63));
+  }
+}
+
+/// FNV-1a over one or more LED bitmaps, folded to 16 bits
+inline uint16_t digest_bitmaps(const LedBitmap *bitmaps, size_t count) {
+  uint32_t hash = 2166136261UL;
+  for (size_t b = 0; b < count; b++) {
+    for (uint64_t word : bitmaps[b]) {
+      for (int i = 0; i < 8; i++) {
+        hash ^= (word >> (i * 8)) & 0xFF;
+        hash *= 16777619UL;
+      }
+    }
+  }
+  return uint16_t(hash ^ (hash >> 16));
+}
+
+/// Digest of the hours and minutes layers (depends on h:m only)
+inline uint16_t words_digest(WordClock *clock) {
+  LedBitmap layers[2] = {};
+  add_to_bitmap(layers[0], clock->get_active_hours_leds());
+  add_to_bitmap(layers[1], clock->get_active_minutes_leds());
+  return digest_bitmaps(layers, 2);
+}
+
+/// Digest of the seconds layer (depends on seconds and SecondsMode only)
+inline uint16_t seconds_digest(WordClock *clock) {
+  LedBitmap layer = {};
+  add_to_bitmap(layer, clock->get_active_seconds_leds());
+  return digest_bitmaps(&layer, 1);
+}
+
+/// Background must be exactly the visible LEDs not used by another layer
+inline bool background_is_complement(WordClock *clock, int num_leds) {
+  LedBitmap used = {}, background = {}, expected = {};
+  add_to_bitmap(used, clock->get_active_hours_leds());
+  add_to_bitmap(used, clock->get_active_minutes_leds());
+  add_to_bitmap(used, clock->get_active_seconds_leds());
+  add_to_bitmap(background, clock->get_active_background_leds());
+  for (int led = 0; led < num_leds; led++) {
+    if (is_excluded_led(led, num_leds)) continue;
+    if (!(used[led >> 6] & (1ULL << (led & 63)))) expected[led >> 6] |= (1ULL << (led & 63));
+  }
+  return background == expected;
+}
+
+struct GoldenReport {
+  uint32_t checked{0};   ///< (language, mode, second) frames evaluated
+  uint32_t failures{0};  ///< Frames whose digest differs from the golden data
+  bool refused{false};   ///< Not run: the render task owns the display state
+
+  bool passed() const { return !refused && checked > 0 && failures == 0; }
+};
+
+/**
+ * @brief Enumerates every second of the day for every language and
+ * SecondsMode and compares the active LED sets with the golden digests.
+ *
+ * Failing frames are logged with the phrase spelled from the faceplate.
+ * Requires the seconds light to be on (the seconds layer is empty
+ * otherwise). Mutates the live display state: intended for host replay,
+ * and refused while the render task runs (set_language() and
+ * set_seconds_mode() would only be queued for it).
+ */
+inline GoldenReport verify_golden_frames(WordClock *clock, uint16_t num_leds = 256, uint32_t max_reports = 10) {
+  GoldenReport report;
+  if (clock->is_render_task_running()) {
+    ESP_LOGE(TAG_GOLDEN, "Render task running, golden frames need the display state on this thread");
+    report.refused = true;
+    return report;
+  }
+  if (GOLDEN_SECONDS_MODE_COUNT != SECONDS_MODE_COUNT) {
+    ESP_LOGW(TAG_GOLDEN, "Golden data covers %d of %d seconds modes, regenerate it",
+             GOLDEN_SECONDS_MODE_COUNT, SECONDS_MODE_COUNT);
+  }
+  int saved_language = clock->get_language();
+  int saved_mode = clock->get_seconds_mode();
+
+  for (int lang = 0; lang < GOLDEN_LANGUAGE_COUNT; lang++) {
+    if (!WordClock::has_language(lang)) continue;  // not compiled in (languages:)
+    clock->set_language(lang);
+    for (int mode = 0; mode < GOLDEN_SECONDS_MODE_COUNT; mode++) {
+      clock->set_seconds_mode(mode);
+      for (int t = 0; t < SECONDS_PER_DAY; t++) {
+        int h = t / 3600, m = (t / 60) % 60, s = t % 60;
+        clock->evaluate_time(h, m, s);
+        report.checked++;
+
+        uint16_t words = words_digest(clock);
+        uint16_t seconds = seconds_digest(clock);
+        uint16_t expected_words = GOLDEN_WORDS_DIGESTS[lang][h * 60 + m];
+        uint16_t expected_seconds = GOLDEN_SECONDS_DIGESTS[lang][mode][s];
+        bool background_ok = background_is_complement(clock, num_leds);
+        if (words == expected_words && seconds == expected_seconds && background_ok) continue;
+
+        report.failures++;
+        if (report.failures <= max_reports) {
+          ESP_LOGE(TAG_GOLDEN, "lang %d mode %d %02d:%02d:%02d \"%s\" words %04x/%04x seconds %04x/%04x%s",
+                   lang, mode, h, m, s, clock->describe_active_words().c_str(),
+                   words, expected_words, seconds, expected_seconds,
+                   background_ok ? "" : " background mismatch");
+        }
+      }
+    }
+  }
+
+  clock->set_language(saved_language);
+  clock->set_seconds_mode(saved_mode);
+  ESP_LOGI(TAG_GOLDEN, "Golden frames: %u checked, %u failures", report.checked, report.failures);
+  return report;
+}
+
+/**
+ * @brief Regenerates golden_frames_data.h from the current rules
+ *
+ * Only run this after an intentional change of the displayed phrases,
+ * in a build with every language compiled in and without render task.
+ */
+inline std::string generate_golden_frames(WordClock *clock) {
+  if (clock->is_render_task_running()) {
+    ESP_LOGE(TAG_GOLDEN, "Render task running, golden frames need the display state on this thread");
+    return "";
+  }
+  for (int lang = 0; lang < GOLDEN_LANGUAGE_COUNT; lang++) {
+    if (!WordClock::has_language(lang)) {
+      ESP_LOGE(TAG_GOLDEN, "Language %d not compiled in, golden data needs every language", lang);
+      return "";
+    }
+  }
+  int saved_language = clock->get_language();
+  int saved_mode = clock->get_seconds_mode();
+  char buf[16];
+
+  std::string out = "#pragma once\n\n#include <cstdint>\n\n"
+                    "// Generated by golden::generate_golden_frames() - do not edit by hand\n\n"
+                    "namespace esphome {\nnamespace wordclock {\nnamespace golden {\n\n";
+  snprintf(buf, sizeof(buf), "%d", GOLDEN_LANGUAGE_COUNT);
+  out += std::string("static constexpr int GOLDEN_LANGUAGE_COUNT = ") + buf + ";\n";
+  snprintf(buf, sizeof(buf), "%d", SECONDS_MODE_COUNT);
+  out += std::string("static constexpr int GOLDEN_SECONDS_MODE_COUNT = ") + buf + ";\n\n";
+
+  out += "/// Hours+minutes digest per language and minute of the day\n";
+  out += "static const uint16_t GOLDEN_WORDS_DIGESTS[GOLDEN_LANGUAGE_COUNT][1440] = {\n";
+  for (int lang = 0; lang < GOLDEN_LANGUAGE_COUNT; lang++) {
+    clock->set_language(lang);
+    out += "  {\n";
+    for (int minute = 0; minute < 1440; minute++) {
+      clock->evaluate_time(minute / 60, minute % 60, 0);
+      snprintf(buf, sizeof(buf), "0x%04x,", words_digest(clock));
+      out += (minute % 12 == 0) ? "    " : " ";
+      out += buf;
+      if (minute % 12 == 11) out += "\n";
+    }
+    out += "  },\n";
+  }
+  out += "};\n\n";
+
+  out += "/// Seconds layer digest per language, SecondsMode and second\n";
+  out += "static const uint16_t GOLDEN_SECONDS_DIGESTS[GOLDEN_LANGUAGE_COUNT][GOLDEN_SECONDS_MODE_COUNT][60] = {\n";
+  for (int lang = 0; lang < GOLDEN_LANGUAGE_COUNT; lang++) {
+    clock->set_language(lang);
+    out += "  {\n";
+    for (int mode = 0; mode < SECONDS_MODE_COUNT; mode++) {
+      clock->set_seconds_mode(mode);
+      out += "    {\n";
+      for (int s = 0; s < 60; s++) {
+        clock->evaluate_time(0, 0, s);
+        snprintf(buf, sizeof(buf), "0x%04x,", seconds_digest(clock));
+        out += (s % 12 == 0) ? "      " : " ";
+        out += buf;
+        if (s % 12 == 11) out += "\n";
+      }
+      out += "    },\n";
+    }
+    out += "  },\n";
+  }
+  out += "};\n\n}  // namespace golden\n}  // namespace wordclock\n}  // namespace esphome\n";
+
+  clock->set_language(saved_language);
+  clock->set_seconds_mode(saved_mode);
+  return out;
+}
+
+}  // namespace golden
+}  // namespace wordclock
+}  // namespace esphome
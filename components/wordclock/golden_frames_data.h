@@ -0,0 +1,328 @@
+#pragma once
+
+#include <cstdint>
+
+// Generated by golden::generate_golden_frames() - do not edit by hand
+
+namespace esphome {
+namespace wordclock {
+namespace golden {
+
+static constexpr int GOLDEN_LANGUAGE_COUNT = 2;
+static constexpr int GOLDEN_SECONDS_MODE_COUNT = 4;
+
+/// Hours+minutes digest per language and minute of the day
+static const uint16_t GOLDEN_WORDS_DIGESTS[GOLDEN_LANGUAGE_COUNT][1440] = {
+  {
+    0xe712, 0xb66d, 0x3c3e, 0x9c29, 0x73c0, 0x5547, 0xb6d5, 0x062e, 0x855f, 0x02d2, 0x6f98, 0x46f4,
+    0x2583, 0xe7a1, 0x1c22, 0xcff1, 0x25af, 0x12b0, 0xab36, 0x8444, 0xd051, 0x23da, 0x991b, 0x2e65,
+    0x9ec2, 0xcb9e, 0x8d9c, 0xdef1, 0xce9c, 0x148c, 0xd7b6, 0x31bc, 0xf034, 0xd38e, 0xd725, 0xc568,
+    0xf2c9, 0x26c8, 0xbb57, 0x736c, 0x439e, 0xa452, 0x2765, 0x3bbe, 0x7e1e, 0xc671, 0x1c54, 0xb784,
+    0x0269, 0xbce7, 0xdaf5, 0x5271, 0x9901, 0x4391, 0xd367, 0x0c97, 0x222b, 0x981b, 0x5cbc, 0x58a3,
+    0xdbb1, 0x38c2, 0xa241, 0x8e34, 0xe6e5, 0x57f1, 0x9818, 0xf899, 0x2ae3, 0x18bc, 0x4af7, 0xb8c3,
+    0x11d0, 0x5d06, 0x1045, 0x1420, 0xf4dd, 0x5d53, 0x9594, 0x450e, 0x5881, 0xce6a, 0x168c, 0x6b2e,
+    0xa1ad, 0x9bda, 0xfb84, 0x3a49, 0xa372, 0x0b1f, 0xace2, 0x118f, 0xbdce, 0x6f10, 0xbc54, 0x8cc6,
+    0x6a87, 0xb1b1, 0x5b6c, 0x4fa1, 0x2e57, 0x1be3, 0xb86b, 0x3374, 0xcfca, 0x946f, 0x358e, 0xac6d,
+    0x96ed, 0xd316, 0xecf0, 0xa0a3, 0xd40c, 0x8058, 0xfc54, 0xd688, 0x21a1, 0xc29d, 0x534e, 0x1724,
+    0x8977, 0x3dd8, 0xe25a, 0xa4f8, 0x9741, 0xd8ba, 0xe13c, 0x9c3a, 0x1945, 0x0c3e, 0x6f36, 0x519d,
+    0x2061, 0xc68b, 0xc27d, 0x8dd6, 0xc3dc, 0xe0b0, 0xb298, 0x0a6e, 0xb4c7, 0xab1b, 0x7146, 0x3d05,
+    0x8bd0, 0xe79d, 0x17ef, 0x3f9b, 0x10bf, 0x5f8e, 0x3eb6, 0x9987, 0x5bdb, 0xf80e, 0x9933, 0x7b59,
+    0x9abe, 0x1213, 0x92f8, 0x8099, 0xb4a9, 0xedc9, 0x7b89, 0xdd19, 0xb1ef, 0x53fd, 0x0592, 0xa883,
+    0xf434, 0x392b, 0x78a0, 0x162c, 0xcf3c, 0x15d3, 0x230f, 0x263e, 0x19a9, 0x72d1, 0x11ff, 0x335f,
+    0xbf9f, 0xdcc8, 0x06a4, 0x878c, 0xf38b, 0x7e43, 0x0f97, 0xa086, 0x6765, 0x7310, 0x055c, 0xe399,
+    0x7d19, 0x9a22, 0x3170, 0x99f8, 0xab63, 0x7468, 0xc7cc, 0x8161, 0x1f3e, 0xf3cc, 0xd1d4, 0x4fe9,
+    0xe806, 0x1f7d, 0xdcb5, 0x6327, 0x2b1c, 0x6936, 0xa7f6, 0xa21f, 0x4845, 0x2218, 0x41d3, 0x1d6a,
+    0xc1e3, 0x399f, 0xcea2, 0xc6d2, 0xdd31, 0xd9cd, 0x282b, 0x868f, 0xe734, 0xc4a4, 0xfe21, 0xb9cd,
+    0x403f, 0x3091, 0x104f, 0x362f, 0xf9f6, 0x2fc0, 0xb8fc, 0x4a15, 0xdccf, 0x3cef, 0x48c7, 0xe309,
+    0xe7ca, 0xa2fa, 0x304b, 0x1000, 0xbeb2, 0xa687, 0x06b9, 0x4016, 0x381f, 0x2fd3, 0x3e21, 0x93a8,
+    0xa9cb, 0xe8e1, 0x0823, 0x58f1, 0x2e64, 0xd14b, 0x420f, 0xe0f4, 0xfb6a, 0x9e80, 0x3eb2, 0xa9f5,
+    0xbba6, 0x37bb, 0xa823, 0x4dc7, 0xbcec, 0x2d42, 0x09d7, 0xb36e, 0xf82d, 0x15bd, 0xecb2, 0xa4f0,
+    0x7137, 0x2fe7, 0x8698, 0x1626, 0xc9aa, 0x7e98, 0xbc7e, 0x571c, 0x362c, 0x3aef, 0xc52b, 0x522e,
+    0x4c02, 0x6c7a, 0xb77e, 0xaf27, 0x2d73, 0x087b, 0x28c5, 0xd671, 0xe692, 0x8ee3, 0x9e3b, 0xbb64,
+    0x1b24, 0xf2f7, 0x0e63, 0x5ec9, 0x12db, 0x91ec, 0xce27, 0xcbe5, 0x449d, 0xba78, 0xe402, 0x668a,
+    0x9aaa, 0xe7c9, 0x9bec, 0x4065, 0x0c3f, 0x27c9, 0x6109, 0x8d3b, 0x51b5, 0x6004, 0x68b7, 0xe481,
+    0x289c, 0xdffc, 0x153a, 0xd04d, 0xf03b, 0x892e, 0xab6c, 0x34d1, 0x111c, 0x28f9, 0xe158, 0xaa2c,
+    0x3920, 0x0350, 0x2645, 0xe651, 0x0443, 0x9098, 0xea75, 0xe0a6, 0x4c1d, 0xb3b2, 0x064c, 0xcf26,
+    0x9440, 0x8bfd, 0xbf14, 0x0a75, 0x8156, 0x297e, 0x6ec7, 0xe4b3, 0xa195, 0x84c2, 0x6755, 0x96da,
+    0x6489, 0x82b7, 0x4ce7, 0x56ba, 0x7ca8, 0x3d0e, 0x0c82, 0xf39c, 0x8058, 0xa33c, 0xab23, 0x2ec6,
+    0x920f, 0xf904, 0x5034, 0xf769, 0xc01d, 0x41c1, 0x6ba6, 0x6352, 0x5aba, 0xfd9c, 0x72cb, 0x2b5d,
+    0x7cc7, 0x9976, 0x27b7, 0xe05b, 0x1c75, 0xf02a, 0x84f0, 0xca09, 0x98a8, 0x8369, 0x53ca, 0xe775,
+    0x50c5, 0x2046, 0xd41e, 0x6c19, 0x263f, 0xcb2e, 0xd95a, 0xed03, 0xb35a, 0xe54f, 0xe8c9, 0x8a8d,
+    0xd5e5, 0xcfa9, 0xb10b, 0xbf5f, 0xe2bc, 0x793d, 0xc020, 0xd0d6, 0xd156, 0x9e35, 0xaba5, 0x3dbd,
+    0x3fea, 0x5725, 0xc526, 0x1f4e, 0x3191, 0x7dbc, 0xe6e3, 0xc192, 0x3d63, 0xf2d2, 0x678c, 0xa7bd,
+    0xfa1b, 0x7075, 0x579b, 0xf6e7, 0x9dff, 0x5391, 0xb0f3, 0x4d48, 0x1c8b, 0xab46, 0x0887, 0x6464,
+    0x28e0, 0x1e48, 0x4fda, 0x057b, 0x7cc6, 0x94b1, 0x95af, 0xf178, 0xb19c, 0x191d, 0xa573, 0x5af6,
+    0x0f36, 0x3dd2, 0x4b85, 0xf23d, 0x97bb, 0x3196, 0x2983, 0x9b78, 0xc9ce, 0x443e, 0xd084, 0x6005,
+    0xddcc, 0x572f, 0x3f81, 0x64c3, 0x485e, 0xb76d, 0x3a05, 0xedbf, 0xe200, 0x9782, 0x67c7, 0xb776,
+    0xfc0e, 0x0639, 0xcf38, 0x8a71, 0xefe9, 0xbd19, 0xacfd, 0xc47e, 0x57c5, 0x4987, 0x6252, 0x17a0,
+    0xeaa4, 0x8a77, 0x47f1, 0xda21, 0x2aa5, 0x16cb, 0x0e68, 0x8fe2, 0xd92f, 0x3fdf, 0xe260, 0x0594,
+    0xf82e, 0x6357, 0x9c2e, 0xefdf, 0x1c3f, 0x4dd6, 0x174a, 0x20ea, 0x8919, 0xc948, 0x2ee7, 0xa190,
+    0xe11c, 0x8b02, 0xfda7, 0x3c6c, 0xdeb0, 0x7679, 0x3c62, 0x32f9, 0xc749, 0x0d68, 0x25d2, 0x5dc9,
+    0x6f32, 0x878e, 0xc19a, 0xe2df, 0x0074, 0x365a, 0x1999, 0xb94c, 0x7560, 0x6bf6, 0x172d, 0xa6f9,
+    0xc968, 0x65de, 0x0ba6, 0x09c4, 0x9517, 0x0a43, 0x76be, 0x49a1, 0xc6dc, 0xb3f4, 0x0849, 0x3652,
+    0x584e, 0x6260, 0x5aa5, 0x5314, 0x9a32, 0xfab9, 0x6063, 0xb402, 0x6aa6, 0x7e21, 0xeaf0, 0x5cc6,
+    0x73cd, 0xabe9, 0xafc9, 0xafed, 0x1dc1, 0x2a6f, 0x9c75, 0x645e, 0x95c7, 0x8a5a, 0xa7dd, 0xcc0a,
+    0x9db7, 0x346a, 0x6657, 0xd38f, 0x4993, 0x0389, 0x4f4e, 0xa535, 0x48e7, 0xca73, 0xf919, 0x989a,
+    0xc8e1, 0x457e, 0x9ea6, 0xfb41, 0xd1e3, 0xea64, 0x5728, 0x4aa7, 0x26b8, 0x7722, 0xa0ae, 0xebc8,
+    0x4541, 0xf8cf, 0xb654, 0x1062, 0x0828, 0xc995, 0x896c, 0x4d89, 0x1b64, 0x248b, 0x0fa1, 0x5a78,
+    0xf066, 0xc97f, 0x6a80, 0x0920, 0x78ed, 0x1e61, 0xcc27, 0x06b4, 0x1af0, 0x0c1e, 0x7aa6, 0xaf6f,
+    0xfd57, 0x5db3, 0x6f95, 0x37d9, 0xb110, 0xb75b, 0xf345, 0x49fd, 0x39d0, 0x7da1, 0x82cf, 0x7e0d,
+    0x54e7, 0x50a8, 0x45ab, 0xa9c2, 0xbd1d, 0xa4f3, 0xfad9, 0x5d16, 0xb859, 0xaf19, 0x6f5c, 0x9b85,
+    0x6ff1, 0x4ed5, 0x75b6, 0x4468, 0x5782, 0xf56e, 0x8ca4, 0xef3d, 0x3cf5, 0x8da1, 0xd703, 0x2b93,
+    0x0722, 0x51d4, 0x98cb, 0x5517, 0x9e56, 0x3a9b, 0x2027, 0x1479, 0xa53d, 0x0f73, 0xf0c5, 0x40ab,
+    0x6528, 0xae5e, 0xac3e, 0x1850, 0x8808, 0xafe7, 0x5200, 0x52d0, 0x84bb, 0xef19, 0x8448, 0xddde,
+    0x5c19, 0xdbe4, 0x59b4, 0x92dc, 0xd1ca, 0x0aca, 0x169f, 0xb4a0, 0x1c97, 0x661c, 0x8f0b, 0x7c4d,
+    0xd473, 0x84e8, 0x5f0d, 0x69c8, 0x3ae2, 0x90f8, 0x5384, 0xd749, 0xd1b6, 0xb0f1, 0xa773, 0x80fb,
+    0x233f, 0x33fe, 0xdd8b, 0xd4ac, 0xaba0, 0x2621, 0x9807, 0x47a5, 0x2cfb, 0x1f26, 0x69ba, 0x1c49,
+    0x4680, 0x17f1, 0x848d, 0x832f, 0xf9ac, 0x33db, 0x2385, 0x4048, 0xdb73, 0xdffd, 0x1eea, 0x79ba,
+    0x702e, 0xc989, 0x6162, 0xabe9, 0x1c2a, 0x6e59, 0xe2c4, 0x5643, 0x4cf9, 0xbbf8, 0xeea3, 0x80f5,
+    0x2fc1, 0x6b8b, 0x0bf4, 0xb390, 0xb9f3, 0x3a13, 0xec4e, 0x1b90, 0x8509, 0x8200, 0xd850, 0xc568,
+    0xb6f9, 0x4cd0, 0x7209, 0xf0b6, 0x439e, 0xd67f, 0xdad4, 0xc21f, 0x3422, 0xc671, 0x406e, 0x1064,
+    0x6776, 0x6661, 0xdaf5, 0x886a, 0x8314, 0xa9d1, 0x5f13, 0x0c97, 0x97ad, 0xe61f, 0x7343, 0xeeff,
+    0xdbb1, 0x38c2, 0xa241, 0x8e34, 0xe6e5, 0x57f1, 0x9818, 0xf899, 0x2ae3, 0x18bc, 0x4af7, 0xb8c3,
+    0x11d0, 0x5d06, 0x1045, 0x1420, 0xf4dd, 0x5d53, 0x9594, 0x450e, 0x5881, 0xce6a, 0x168c, 0x6b2e,
+    0xa1ad, 0x9bda, 0xfb84, 0x3a49, 0xa372, 0x0b1f, 0xace2, 0x118f, 0xbdce, 0x6f10, 0xbc54, 0x8cc6,
+    0x6a87, 0xb1b1, 0x5b6c, 0x4fa1, 0x2e57, 0x1be3, 0xb86b, 0x3374, 0xcfca, 0x946f, 0x358e, 0xac6d,
+    0x96ed, 0xd316, 0xecf0, 0xa0a3, 0xd40c, 0x8058, 0xfc54, 0xd688, 0x21a1, 0xc29d, 0x534e, 0x1724,
+    0x8977, 0x3dd8, 0xe25a, 0xa4f8, 0x9741, 0xd8ba, 0xe13c, 0x9c3a, 0x1945, 0x0c3e, 0x6f36, 0x519d,
+    0x2061, 0xc68b, 0xc27d, 0x8dd6, 0xc3dc, 0xe0b0, 0xb298, 0x0a6e, 0xb4c7, 0xab1b, 0x7146, 0x3d05,
+    0x8bd0, 0xe79d, 0x17ef, 0x3f9b, 0x10bf, 0x5f8e, 0x3eb6, 0x9987, 0x5bdb, 0xf80e, 0x9933, 0x7b59,
+    0x9abe, 0x1213, 0x92f8, 0x8099, 0xb4a9, 0xedc9, 0x7b89, 0xdd19, 0xb1ef, 0x53fd, 0x0592, 0xa883,
+    0xf434, 0x392b, 0x78a0, 0x162c, 0xcf3c, 0x15d3, 0x230f, 0x263e, 0x19a9, 0x72d1, 0x11ff, 0x335f,
+    0xbf9f, 0xdcc8, 0x06a4, 0x878c, 0xf38b, 0x7e43, 0x0f97, 0xa086, 0x6765, 0x7310, 0x055c, 0xe399,
+    0x7d19, 0x9a22, 0x3170, 0x99f8, 0xab63, 0x7468, 0xc7cc, 0x8161, 0x1f3e, 0xf3cc, 0xd1d4, 0x4fe9,
+    0xe806, 0x1f7d, 0xdcb5, 0x6327, 0x2b1c, 0x6936, 0xa7f6, 0xa21f, 0x4845, 0x2218, 0x41d3, 0x1d6a,
+    0xc1e3, 0x399f, 0xcea2, 0xc6d2, 0xdd31, 0xd9cd, 0x282b, 0x868f, 0xe734, 0xc4a4, 0xfe21, 0xb9cd,
+    0x403f, 0x3091, 0x104f, 0x362f, 0xf9f6, 0x2fc0, 0xb8fc, 0x4a15, 0xdccf, 0x3cef, 0x48c7, 0xe309,
+    0xe7ca, 0xa2fa, 0x304b, 0x1000, 0xbeb2, 0xa687, 0x06b9, 0x4016, 0x381f, 0x2fd3, 0x3e21, 0x93a8,
+    0xa9cb, 0xe8e1, 0x0823, 0x58f1, 0x2e64, 0xd14b, 0x420f, 0xe0f4, 0xfb6a, 0x9e80, 0x3eb2, 0xa9f5,
+    0xbba6, 0x37bb, 0xa823, 0x4dc7, 0xbcec, 0x2d42, 0x09d7, 0xb36e, 0xf82d, 0x15bd, 0xecb2, 0xa4f0,
+    0x7137, 0x2fe7, 0x8698, 0x1626, 0xc9aa, 0x7e98, 0xbc7e, 0x571c, 0x362c, 0x3aef, 0xc52b, 0x522e,
+    0x4c02, 0x6c7a, 0xb77e, 0xaf27, 0x2d73, 0x087b, 0x28c5, 0xd671, 0xe692, 0x8ee3, 0x9e3b, 0xbb64,
+    0x1b24, 0xf2f7, 0x0e63, 0x5ec9, 0x12db, 0x91ec, 0xce27, 0xcbe5, 0x449d, 0xba78, 0xe402, 0x668a,
+    0x9aaa, 0xe7c9, 0x9bec, 0x4065, 0x0c3f, 0x27c9, 0x6109, 0x8d3b, 0x51b5, 0x6004, 0x68b7, 0xe481,
+    0x289c, 0xdffc, 0x153a, 0xd04d, 0xf03b, 0x892e, 0xab6c, 0x34d1, 0x111c, 0x28f9, 0xe158, 0xaa2c,
+    0x3920, 0x0350, 0x2645, 0xe651, 0x0443, 0x9098, 0xea75, 0xe0a6, 0x4c1d, 0xb3b2, 0x064c, 0xcf26,
+    0x9440, 0x8bfd, 0xbf14, 0x0a75, 0x8156, 0x297e, 0x6ec7, 0xe4b3, 0xa195, 0x84c2, 0x6755, 0x96da,
+    0x6489, 0x82b7, 0x4ce7, 0x56ba, 0x7ca8, 0x3d0e, 0x0c82, 0xf39c, 0x8058, 0xa33c, 0xab23, 0x2ec6,
+    0x920f, 0xf904, 0x5034, 0xf769, 0xc01d, 0x41c1, 0x6ba6, 0x6352, 0x5aba, 0xfd9c, 0x72cb, 0x2b5d,
+    0x7cc7, 0x9976, 0x27b7, 0xe05b, 0x1c75, 0xf02a, 0x84f0, 0xca09, 0x98a8, 0x8369, 0x53ca, 0xe775,
+    0x50c5, 0x2046, 0xd41e, 0x6c19, 0x263f, 0xcb2e, 0xd95a, 0xed03, 0xb35a, 0xe54f, 0xe8c9, 0x8a8d,
+    0xd5e5, 0xcfa9, 0xb10b, 0xbf5f, 0xe2bc, 0x793d, 0xc020, 0xd0d6, 0xd156, 0x9e35, 0xaba5, 0x3dbd,
+    0x3fea, 0x5725, 0xc526, 0x1f4e, 0x3191, 0x7dbc, 0xe6e3, 0xc192, 0x3d63, 0xf2d2, 0x678c, 0xa7bd,
+    0xfa1b, 0x7075, 0x579b, 0xf6e7, 0x9dff, 0x5391, 0xb0f3, 0x4d48, 0x1c8b, 0xab46, 0x0887, 0x6464,
+    0x28e0, 0x1e48, 0x4fda, 0x057b, 0x7cc6, 0x94b1, 0x95af, 0xf178, 0xb19c, 0x191d, 0xa573, 0x5af6,
+    0x0f36, 0x3dd2, 0x4b85, 0xf23d, 0x97bb, 0x3196, 0x2983, 0x9b78, 0xc9ce, 0x443e, 0xd084, 0x6005,
+    0xddcc, 0x572f, 0x3f81, 0x64c3, 0x485e, 0xb76d, 0x3a05, 0xedbf, 0xe200, 0x9782, 0x67c7, 0xb776,
+    0xfc0e, 0x0639, 0xcf38, 0x8a71, 0xefe9, 0xbd19, 0xacfd, 0xc47e, 0x57c5, 0x4987, 0x6252, 0x17a0,
+    0xeaa4, 0x8a77, 0x47f1, 0xda21, 0x2aa5, 0x16cb, 0x0e68, 0x8fe2, 0xd92f, 0x3fdf, 0xe260, 0x0594,
+    0xf82e, 0x6357, 0x9c2e, 0xefdf, 0x1c3f, 0x4dd6, 0x174a, 0x20ea, 0x8919, 0xc948, 0x2ee7, 0xa190,
+    0xe11c, 0x8b02, 0xfda7, 0x3c6c, 0xdeb0, 0x7679, 0x3c62, 0x32f9, 0xc749, 0x0d68, 0x25d2, 0x5dc9,
+    0x6f32, 0x878e, 0xc19a, 0xe2df, 0x0074, 0x365a, 0x1999, 0xb94c, 0x7560, 0x6bf6, 0x172d, 0xa6f9,
+    0xc968, 0x65de, 0x0ba6, 0x09c4, 0x9517, 0x0a43, 0x76be, 0x49a1, 0xc6dc, 0xb3f4, 0x0849, 0x3652,
+    0x584e, 0x6260, 0x5aa5, 0x5314, 0x9a32, 0xfab9, 0x6063, 0xb402, 0x6aa6, 0x7e21, 0xeaf0, 0x5cc6,
+    0x73cd, 0xabe9, 0xafc9, 0xafed, 0x1dc1, 0x2a6f, 0x9c75, 0x645e, 0x95c7, 0x8a5a, 0xa7dd, 0xcc0a,
+    0x9db7, 0x346a, 0x6657, 0xd38f, 0x4993, 0x0389, 0x4f4e, 0xa535, 0x48e7, 0xca73, 0xf919, 0x989a,
+    0xc8e1, 0x457e, 0x9ea6, 0xfb41, 0xd1e3, 0xea64, 0x5728, 0x4aa7, 0x26b8, 0x7722, 0xa0ae, 0xebc8,
+    0x4541, 0xf8cf, 0xb654, 0x1062, 0x0828, 0xc995, 0x896c, 0x4d89, 0x1b64, 0x248b, 0x0fa1, 0x5a78,
+    0xf066, 0xc97f, 0x6a80, 0x0920, 0x78ed, 0x1e61, 0xcc27, 0x06b4, 0x1af0, 0x0c1e, 0x7aa6, 0xaf6f,
+    0xfd57, 0x5db3, 0x6f95, 0x37d9, 0xb110, 0xb75b, 0xf345, 0x49fd, 0x39d0, 0x7da1, 0x82cf, 0x7e0d,
+    0x54e7, 0x50a8, 0x45ab, 0xa9c2, 0xbd1d, 0xa4f3, 0xfad9, 0x5d16, 0xb859, 0xaf19, 0x6f5c, 0x9b85,
+    0x6ff1, 0x4ed5, 0x75b6, 0x4468, 0x5782, 0xf56e, 0x8ca4, 0xef3d, 0x3cf5, 0x8da1, 0xd703, 0x2b93,
+    0x0722, 0x51d4, 0x98cb, 0x5517, 0x9e56, 0x3a9b, 0x2027, 0x1479, 0xa53d, 0x0f73, 0xf0c5, 0x40ab,
+    0x6528, 0xae5e, 0xac3e, 0x1850, 0x8808, 0xafe7, 0x5200, 0x52d0, 0x84bb, 0xef19, 0x8448, 0xddde,
+    0x5c19, 0xdbe4, 0x59b4, 0x92dc, 0xd1ca, 0x0aca, 0x169f, 0xb4a0, 0x1c97, 0x661c, 0x8f0b, 0x1c92,
+    0xd473, 0x84e8, 0x5f0d, 0x69c8, 0x1ba5, 0x90f8, 0x5384, 0xd749, 0xd1b6, 0xc88e, 0xa773, 0x80fb,
+    0x233f, 0x33fe, 0x2013, 0xd4ac, 0xaba0, 0x2621, 0x9807, 0xb813, 0x2cfb, 0x1f26, 0x69ba, 0x1c49,
+  },
+  {
+    0xea62, 0x090d, 0xe8bd, 0x5921, 0x0028, 0xa8bc, 0x115a, 0x2ef7, 0xad6d, 0x5b3d, 0xf8e3, 0xafaf,
+    0x6b10, 0xa7e1, 0x077b, 0x337a, 0xf92c, 0x3ec5, 0x0864, 0xb413, 0x5412, 0xca4a, 0xf284, 0xda5e,
+    0x8fb8, 0xb161, 0x96ed, 0xca5b, 0xaba6, 0xd567, 0xf048, 0xb749, 0x6984, 0x0f7c, 0x9fb3, 0x733d,
+    0x6b38, 0x6789, 0xc8ce, 0xb114, 0x442c, 0xa6b3, 0xcc77, 0x60c2, 0xb3c8, 0xf2de, 0x8a12, 0xf684,
+    0x057f, 0x2253, 0x4268, 0x70fa, 0xfa82, 0xae0c, 0x3328, 0xddad, 0xd57a, 0x5d3b, 0x86fa, 0x1840,
+    0x5f26, 0x163f, 0xc792, 0x6993, 0x0661, 0xecc1, 0x80ce, 0x39ea, 0xe681, 0x3705, 0x25e1, 0xc9a9,
+    0x747d, 0x0c9b, 0xd913, 0xe899, 0x8fff, 0x7ec3, 0xb3be, 0x928a, 0x1a0f, 0x1f7b, 0x552b, 0x71ce,
+    0x03fd, 0x34f1, 0xd245, 0x9f93, 0xf1a6, 0x43b4, 0xd953, 0x6de5, 0x165a, 0x7391, 0xdc8e, 0x0695,
+    0x8b3b, 0x7244, 0xeabe, 0xff46, 0x8e75, 0x6e63, 0xb74f, 0xb819, 0x6150, 0xf6a2, 0x929e, 0x6c86,
+    0x83ce, 0x994b, 0x808c, 0xaf3a, 0x11be, 0xad64, 0x95a8, 0x49ee, 0xc950, 0x5c0e, 0xd3d5, 0x39b0,
+    0x1aa4, 0x59ad, 0x380d, 0x4a23, 0x1bc6, 0xce6a, 0x458b, 0xca96, 0x187f, 0x6ec5, 0x28f2, 0xe4ed,
+    0x2528, 0xae4e, 0x9ca1, 0xc802, 0xa3b5, 0x2644, 0x47ec, 0x2b2a, 0xa372, 0x7f25, 0x8d7f, 0xf469,
+    0x1954, 0x947c, 0xbd0c, 0xfbac, 0xb837, 0xc85a, 0xdb4f, 0xa131, 0xbcd0, 0x8cbe, 0x1a98, 0xc4d4,
+    0x6d8c, 0xfc57, 0xe8f0, 0xd1a1, 0xa30d, 0x420c, 0x69b9, 0xb2e0, 0xb497, 0x1271, 0x6877, 0x613d,
+    0x916e, 0xa163, 0xc94a, 0x0179, 0x685d, 0x6d2d, 0xbda8, 0x88d4, 0x0c37, 0x1608, 0x41ab, 0x9604,
+    0x9505, 0xa4c0, 0xe3cd, 0xd455, 0xba04, 0x3b62, 0x1f2e, 0xa859, 0x6e05, 0xf93a, 0x8202, 0xeec8,
+    0x1dc3, 0xaebd, 0x22e3, 0xe76e, 0xc960, 0xed73, 0xf7df, 0x584d, 0xa1a9, 0x3dbe, 0x12ef, 0xda61,
+    0xbe20, 0xa66d, 0xc934, 0xecc0, 0x8ff4, 0xafc1, 0x6288, 0xa8f4, 0xd2d0, 0x0082, 0x556c, 0xee06,
+    0xbc52, 0x0bc0, 0xcc10, 0x0dc6, 0xf4b5, 0x4200, 0xd3b5, 0x9f9a, 0x4fb7, 0xa696, 0x3b82, 0x1cdd,
+    0x3656, 0x2cec, 0x9bc0, 0x13bb, 0xb359, 0x345e, 0x7479, 0xf9c0, 0x4983, 0xba85, 0x419d, 0x47dc,
+    0x2520, 0x5732, 0xcb42, 0x90d5, 0x1b09, 0xab2c, 0xf6de, 0x5bb0, 0x15c3, 0xba21, 0x43bf, 0x9f36,
+    0xb9fc, 0x1a82, 0x6962, 0x7485, 0xafc8, 0x4f3a, 0x8943, 0x7cc3, 0x6668, 0x7bb0, 0xbefc, 0xce83,
+    0x5da8, 0xd9f6, 0x4683, 0x66fd, 0xe6d3, 0x6db0, 0x03d1, 0xe614, 0xa8dd, 0x8b85, 0xe93a, 0xd543,
+    0x71cc, 0x8600, 0xc7a7, 0x133c, 0x29e3, 0x1d1b, 0x4a88, 0x0203, 0x22de, 0x71fc, 0x7853, 0xd51e,
+    0x9f9a, 0x1ccf, 0x0ac8, 0x9022, 0x6843, 0x384e, 0x7279, 0x334d, 0x4938, 0x6b5a, 0x3cfc, 0xfcdf,
+    0x72a1, 0x7e9e, 0x6d90, 0x2532, 0x20a2, 0xf360, 0x4010, 0x2b28, 0x5b42, 0xad6d, 0xb842, 0xb2cd,
+    0x3a00, 0xe2e1, 0x4d50, 0x877c, 0x1ec1, 0xed00, 0x0dbc, 0xede2, 0x3041, 0x8353, 0xb6d0, 0x94b0,
+    0xf66e, 0x1a3b, 0x97dc, 0x02eb, 0xce9e, 0x910f, 0x3632, 0x608e, 0x9e4c, 0xcff6, 0xe00c, 0xfa0a,
+    0xd2ff, 0xda64, 0x26b7, 0x08b4, 0x46ce, 0xfc4b, 0x1cb7, 0x1f62, 0x23ad, 0xafe9, 0xe18b, 0xf03a,
+    0x3abc, 0x6ed0, 0x1c05, 0xd588, 0xb09a, 0xe9aa, 0xc984, 0x42bb, 0x9ba5, 0x93ff, 0x30b7, 0x28be,
+    0xf3e1, 0x0f41, 0xea7f, 0xd51f, 0xa798, 0x0768, 0x4f34, 0x9a4c, 0x6960, 0xf72c, 0x1220, 0x4aca,
+    0x0ea7, 0x9d2d, 0x1a10, 0x1f00, 0x752b, 0x4a63, 0x4e47, 0x0f72, 0xf4ed, 0x0603, 0xf540, 0xf58d,
+    0x08bd, 0xb743, 0x4a53, 0xcd62, 0x5c6e, 0x8c95, 0xc796, 0xaf99, 0xd9f3, 0x9fa4, 0x5ab2, 0xffaf,
+    0xa6d8, 0xd4b6, 0xc273, 0x70a1, 0x6865, 0xf565, 0xb5ab, 0xc322, 0xf915, 0xce3a, 0xa955, 0xfc8a,
+    0xa6d2, 0xaafb, 0x5326, 0x5186, 0x3142, 0x7f29, 0x1551, 0x7f76, 0x137d, 0xa21c, 0x2eb3, 0x3223,
+    0x2e18, 0x4de4, 0xd053, 0xe4f0, 0xe478, 0x9168, 0x3681, 0x3aed, 0xaabc, 0x74f6, 0xc552, 0xf0e5,
+    0x74cc, 0xafa7, 0x8e84, 0x619c, 0xc926, 0xf5bd, 0x3711, 0x8c77, 0x35d4, 0xa288, 0x3b4a, 0xaead,
+    0x75ab, 0x122d, 0x1fca, 0xef97, 0x0c9c, 0x7c76, 0x18a0, 0xc09f, 0x4a0b, 0xd57c, 0x1652, 0x71c3,
+    0x8249, 0x6f02, 0x662e, 0xd07b, 0xf96f, 0xf471, 0x9124, 0x47ab, 0x8dad, 0x4243, 0x9e7d, 0xb1aa,
+    0xd525, 0x613c, 0xf5c6, 0xfdfb, 0x5fb5, 0x4fc3, 0x1b1f, 0x749c, 0x5b1b, 0x878d, 0x729b, 0x5a25,
+    0xba6f, 0xe8df, 0x1061, 0xe117, 0xc0df, 0xaadc, 0x4604, 0x3c59, 0x390a, 0x0f9d, 0x03f4, 0x77bd,
+    0xc3b5, 0x81b9, 0xb963, 0x046b, 0x632f, 0xa52d, 0xf6d8, 0xab82, 0x9474, 0xbe41, 0x1003, 0x6f76,
+    0x6c17, 0x866e, 0xf3c8, 0x2d81, 0xd96d, 0xec86, 0xd86a, 0x416b, 0xc3e6, 0x4fcf, 0x4666, 0xc64e,
+    0x62ab, 0xdd17, 0x121d, 0x6879, 0xb60c, 0xade9, 0x50b6, 0x1bf7, 0xe1c9, 0xde10, 0x743a, 0xe3d6,
+    0x392c, 0x27b6, 0x311b, 0xa891, 0x7282, 0x7cfc, 0x0f6b, 0x7058, 0xc86d, 0xbf5f, 0x1d90, 0x1fac,
+    0x4dab, 0xc143, 0xd94d, 0x2e39, 0xb296, 0xe987, 0xf814, 0xadd0, 0x1ca8, 0x177b, 0xd17a, 0xe4c2,
+    0x53d5, 0xbac0, 0x5a10, 0x3ca6, 0x978e, 0xb35a, 0x8ae8, 0xf906, 0xf541, 0x477f, 0x41e0, 0x280e,
+    0xa993, 0x782d, 0x092f, 0x3bf8, 0xfeae, 0x75c1, 0x1120, 0x29ed, 0x32ce, 0xf99a, 0x9664, 0xf2f2,
+    0x1077, 0xf647, 0x8f89, 0xfb6b, 0x299f, 0xa02a, 0x19a2, 0x2225, 0x08f6, 0x7f31, 0x2f42, 0x85c1,
+    0xdbad, 0x2f19, 0x4942, 0x2732, 0x386e, 0x7921, 0xff02, 0x1266, 0x60ec, 0xd6af, 0xc08b, 0xbdcf,
+    0xa1d0, 0x5fcd, 0xf1a6, 0xc7ab, 0xfab3, 0xa034, 0x2ce2, 0x043c, 0x85c8, 0xd6ae, 0x225c, 0x0ec4,
+    0x1bf0, 0xe67b, 0xb9b4, 0xbc7c, 0x3634, 0x80b3, 0x07b1, 0xc2e0, 0x9319, 0x888b, 0x424d, 0x14a7,
+    0xe7c3, 0x211f, 0xf476, 0x887a, 0x488a, 0x05b0, 0x7347, 0xc0a0, 0x7466, 0x2297, 0x374e, 0xb7ae,
+    0xd43d, 0xc3fe, 0xfe2a, 0xa9aa, 0x1726, 0xf96a, 0xcd71, 0x4767, 0xd663, 0x2c35, 0xc4d2, 0xc630,
+    0x9c22, 0xc30e, 0x5197, 0x732c, 0x0655, 0x3f6d, 0xcf96, 0x71c1, 0x3cba, 0x833c, 0x058a, 0xdbfe,
+    0x2a11, 0xef85, 0x79a1, 0x98c7, 0xbe65, 0x256a, 0x8cde, 0x9e6f, 0x60e3, 0x48ac, 0x05ee, 0x6668,
+    0x9e1d, 0x20f2, 0x6b64, 0x66f1, 0x54c2, 0x28b8, 0xcce1, 0x6ce0, 0x7bd9, 0x6175, 0xaf8a, 0x029e,
+    0xc6d3, 0x8112, 0xa14c, 0xec5e, 0x2609, 0x6a9f, 0x640d, 0x237b, 0x8aae, 0xc04b, 0x0a6a, 0x7e5f,
+    0xf007, 0xba81, 0x1006, 0x87df, 0xb770, 0x3d3e, 0xe1c3, 0xaff7, 0x6057, 0x449f, 0x6ecd, 0x9480,
+    0xfb51, 0x0bfa, 0xc309, 0x08f6, 0xf3df, 0x112a, 0xdf29, 0xb82b, 0x26de, 0x218f, 0x1597, 0xe76e,
+    0xb0a8, 0xa227, 0xd6a9, 0x4670, 0xd473, 0x82f2, 0xfcaf, 0xd47b, 0xca24, 0xfe5c, 0x864e, 0x057f,
+    0xabfa, 0x8230, 0x4c15, 0x6b68, 0x7aeb, 0x7f5a, 0x4735, 0x1fa2, 0xf45c, 0xebc8, 0x4990, 0xd884,
+    0xbbcf, 0x8cf5, 0x471a, 0xfb4c, 0xd7f6, 0x92d1, 0x0ebc, 0xb749, 0x6984, 0x0f7c, 0x9fb3, 0x733d,
+    0x6b38, 0x6789, 0xc8ce, 0xb114, 0x442c, 0xa6b3, 0xcc77, 0x60c2, 0xb3c8, 0xf2de, 0x8a12, 0xf684,
+    0x057f, 0x2253, 0x4268, 0x70fa, 0xfa82, 0xae0c, 0x3328, 0xddad, 0xd57a, 0x5d3b, 0x86fa, 0x1840,
+    0x5f26, 0x163f, 0xc792, 0x6993, 0x0661, 0xecc1, 0x80ce, 0x39ea, 0xe681, 0x3705, 0x25e1, 0xc9a9,
+    0x747d, 0x0c9b, 0xd913, 0xe899, 0x8fff, 0x7ec3, 0xb3be, 0x928a, 0x1a0f, 0x1f7b, 0x552b, 0x71ce,
+    0x03fd, 0x34f1, 0xd245, 0x9f93, 0xf1a6, 0x43b4, 0xd953, 0x6de5, 0x165a, 0x7391, 0xdc8e, 0x0695,
+    0x8b3b, 0x7244, 0xeabe, 0xff46, 0x8e75, 0x6e63, 0xb74f, 0xb819, 0x6150, 0xf6a2, 0x929e, 0x6c86,
+    0x83ce, 0x994b, 0x808c, 0xaf3a, 0x11be, 0xad64, 0x95a8, 0x49ee, 0xc950, 0x5c0e, 0xd3d5, 0x39b0,
+    0x1aa4, 0x59ad, 0x380d, 0x4a23, 0x1bc6, 0xce6a, 0x458b, 0xca96, 0x187f, 0x6ec5, 0x28f2, 0xe4ed,
+    0x2528, 0xae4e, 0x9ca1, 0xc802, 0xa3b5, 0x2644, 0x47ec, 0x2b2a, 0xa372, 0x7f25, 0x8d7f, 0xf469,
+    0x1954, 0x947c, 0xbd0c, 0xfbac, 0xb837, 0xc85a, 0xdb4f, 0xa131, 0xbcd0, 0x8cbe, 0x1a98, 0xc4d4,
+    0x6d8c, 0xfc57, 0xe8f0, 0xd1a1, 0xa30d, 0x420c, 0x69b9, 0xb2e0, 0xb497, 0x1271, 0x6877, 0x613d,
+    0x916e, 0xa163, 0xc94a, 0x0179, 0x685d, 0x6d2d, 0xbda8, 0x88d4, 0x0c37, 0x1608, 0x41ab, 0x9604,
+    0x9505, 0xa4c0, 0xe3cd, 0xd455, 0xba04, 0x3b62, 0x1f2e, 0xa859, 0x6e05, 0xf93a, 0x8202, 0xeec8,
+    0x1dc3, 0xaebd, 0x22e3, 0xe76e, 0xc960, 0xed73, 0xf7df, 0x584d, 0xa1a9, 0x3dbe, 0x12ef, 0xda61,
+    0xbe20, 0xa66d, 0xc934, 0xecc0, 0x8ff4, 0xafc1, 0x6288, 0xa8f4, 0xd2d0, 0x0082, 0x556c, 0xee06,
+    0xbc52, 0x0bc0, 0xcc10, 0x0dc6, 0xf4b5, 0x4200, 0xd3b5, 0x9f9a, 0x4fb7, 0xa696, 0x3b82, 0x1cdd,
+    0x3656, 0x2cec, 0x9bc0, 0x13bb, 0xb359, 0x345e, 0x7479, 0xf9c0, 0x4983, 0xba85, 0x419d, 0x47dc,
+    0x2520, 0x5732, 0xcb42, 0x90d5, 0x1b09, 0xab2c, 0xf6de, 0x5bb0, 0x15c3, 0xba21, 0x43bf, 0x9f36,
+    0xb9fc, 0x1a82, 0x6962, 0x7485, 0xafc8, 0x4f3a, 0x8943, 0x7cc3, 0x6668, 0x7bb0, 0xbefc, 0xce83,
+    0x5da8, 0xd9f6, 0x4683, 0x66fd, 0xe6d3, 0x6db0, 0x03d1, 0xe614, 0xa8dd, 0x8b85, 0xe93a, 0xd543,
+    0x71cc, 0x8600, 0xc7a7, 0x133c, 0x29e3, 0x1d1b, 0x4a88, 0x0203, 0x22de, 0x71fc, 0x7853, 0xd51e,
+    0x9f9a, 0x1ccf, 0x0ac8, 0x9022, 0x6843, 0x384e, 0x7279, 0x334d, 0x4938, 0x6b5a, 0x3cfc, 0xfcdf,
+    0x72a1, 0x7e9e, 0x6d90, 0x2532, 0x20a2, 0xf360, 0x4010, 0x2b28, 0x5b42, 0xad6d, 0xb842, 0xb2cd,
+    0x3a00, 0xe2e1, 0x4d50, 0x877c, 0x1ec1, 0xed00, 0x0dbc, 0xede2, 0x3041, 0x8353, 0xb6d0, 0x94b0,
+    0xf66e, 0x1a3b, 0x97dc, 0x02eb, 0xce9e, 0x910f, 0x3632, 0x608e, 0x9e4c, 0xcff6, 0xe00c, 0xfa0a,
+    0xd2ff, 0xda64, 0x26b7, 0x08b4, 0x46ce, 0xfc4b, 0x1cb7, 0x1f62, 0x23ad, 0xafe9, 0xe18b, 0xf03a,
+    0x3abc, 0x6ed0, 0x1c05, 0xd588, 0xb09a, 0xe9aa, 0xc984, 0x42bb, 0x9ba5, 0x93ff, 0x30b7, 0x28be,
+    0xf3e1, 0x0f41, 0xea7f, 0xd51f, 0xa798, 0x0768, 0x4f34, 0x9a4c, 0x6960, 0xf72c, 0x1220, 0x4aca,
+    0x0ea7, 0x9d2d, 0x1a10, 0x1f00, 0x752b, 0x4a63, 0x4e47, 0x0f72, 0xf4ed, 0x0603, 0xf540, 0xf58d,
+    0x08bd, 0xb743, 0x4a53, 0xcd62, 0x5c6e, 0x8c95, 0xc796, 0xaf99, 0xd9f3, 0x9fa4, 0x5ab2, 0xffaf,
+    0xa6d8, 0xd4b6, 0xc273, 0x70a1, 0x6865, 0xf565, 0xb5ab, 0xc322, 0xf915, 0xce3a, 0xa955, 0xfc8a,
+    0xa6d2, 0xaafb, 0x5326, 0x5186, 0x3142, 0x7f29, 0x1551, 0x7f76, 0x137d, 0xa21c, 0x2eb3, 0x3223,
+    0x2e18, 0x4de4, 0xd053, 0xe4f0, 0xe478, 0x9168, 0x3681, 0x3aed, 0xaabc, 0x74f6, 0xc552, 0xf0e5,
+    0x74cc, 0xafa7, 0x8e84, 0x619c, 0xc926, 0xf5bd, 0x3711, 0x8c77, 0x35d4, 0xa288, 0x3b4a, 0xaead,
+    0x75ab, 0x122d, 0x1fca, 0xef97, 0x0c9c, 0x7c76, 0x18a0, 0xc09f, 0x4a0b, 0xd57c, 0x1652, 0x71c3,
+    0x8249, 0x6f02, 0x662e, 0xd07b, 0xf96f, 0xf471, 0x9124, 0x47ab, 0x8dad, 0x4243, 0x9e7d, 0xb1aa,
+    0xd525, 0x613c, 0xf5c6, 0xfdfb, 0x5fb5, 0x4fc3, 0x1b1f, 0x749c, 0x5b1b, 0x878d, 0x729b, 0x5a25,
+    0xba6f, 0xe8df, 0x1061, 0xe117, 0xc0df, 0xaadc, 0x4604, 0x3c59, 0x390a, 0x0f9d, 0x03f4, 0x77bd,
+    0xc3b5, 0x81b9, 0xb963, 0x046b, 0x632f, 0xa52d, 0xf6d8, 0xab82, 0x9474, 0xbe41, 0x1003, 0x6f76,
+    0x6c17, 0x866e, 0xf3c8, 0x2d81, 0xd96d, 0xec86, 0xd86a, 0x416b, 0xc3e6, 0x4fcf, 0x4666, 0xc64e,
+    0x62ab, 0xdd17, 0x121d, 0x6879, 0xb60c, 0xade9, 0x50b6, 0x1bf7, 0xe1c9, 0xde10, 0x743a, 0xe3d6,
+    0x392c, 0x27b6, 0x311b, 0xa891, 0x7282, 0x7cfc, 0x0f6b, 0x7058, 0xc86d, 0xbf5f, 0x1d90, 0x1fac,
+    0x4dab, 0xc143, 0xd94d, 0x2e39, 0xb296, 0xe987, 0xf814, 0xadd0, 0x1ca8, 0x177b, 0xd17a, 0xe4c2,
+    0x53d5, 0xbac0, 0x5a10, 0x3ca6, 0x978e, 0xb35a, 0x8ae8, 0xf906, 0xf541, 0x477f, 0x41e0, 0x280e,
+    0xa993, 0x782d, 0x092f, 0x3bf8, 0xfeae, 0x75c1, 0x1120, 0x29ed, 0x32ce, 0xf99a, 0x9664, 0xf2f2,
+    0x1077, 0xf647, 0x8f89, 0xfb6b, 0x299f, 0xa02a, 0x19a2, 0x2225, 0x08f6, 0x7f31, 0x2f42, 0x85c1,
+    0xdbad, 0x2f19, 0x4942, 0x2732, 0x386e, 0x7921, 0xff02, 0x1266, 0x60ec, 0xd6af, 0xc08b, 0xbdcf,
+    0xa1d0, 0x5fcd, 0xf1a6, 0xc7ab, 0xfab3, 0xa034, 0x2ce2, 0x043c, 0x85c8, 0xd6ae, 0x225c, 0x0ec4,
+    0x1bf0, 0xe67b, 0xb9b4, 0xbc7c, 0x3634, 0x80b3, 0x07b1, 0xc2e0, 0x9319, 0x888b, 0x424d, 0x14a7,
+    0xe7c3, 0x211f, 0xf476, 0x887a, 0x488a, 0x05b0, 0x7347, 0xc0a0, 0x7466, 0x2297, 0x374e, 0xb7ae,
+    0xd43d, 0xc3fe, 0xfe2a, 0xa9aa, 0x1726, 0xf96a, 0xcd71, 0x4767, 0xd663, 0x2c35, 0xc4d2, 0xc630,
+    0x9c22, 0xc30e, 0x5197, 0x732c, 0x0655, 0x3f6d, 0xcf96, 0x71c1, 0x3cba, 0x833c, 0x058a, 0xdbfe,
+    0x2a11, 0xef85, 0x79a1, 0x98c7, 0xbe65, 0x256a, 0x8cde, 0x9e6f, 0x60e3, 0x48ac, 0x05ee, 0x6668,
+    0x9e1d, 0x20f2, 0x6b64, 0x66f1, 0x54c2, 0x28b8, 0xcce1, 0x6ce0, 0x7bd9, 0x6175, 0xaf8a, 0x029e,
+    0xc6d3, 0x8112, 0xa14c, 0xec5e, 0x2609, 0x6a9f, 0x640d, 0xe88a, 0xd66f, 0xec18, 0xc5a8, 0xd87b,
+    0x7957, 0x2d47, 0x9f16, 0xcb8e, 0xa1e6, 0x2910, 0x3246, 0x189a, 0x290f, 0x3edc, 0x7694, 0xe670,
+    0x946d, 0xbbb8, 0xb548, 0x0991, 0xb27a, 0x13bf, 0x3b1e, 0xb683, 0x7535, 0x1de5, 0x1b59, 0x4cc9,
+  },
+};
+
+/// Seconds layer digest per language, SecondsMode and second
+static const uint16_t GOLDEN_SECONDS_DIGESTS[GOLDEN_LANGUAGE_COUNT][GOLDEN_SECONDS_MODE_COUNT][60] = {
+  {
+    {
+      0xef6f, 0x5cd6, 0x6ee5, 0x2820, 0xeec8, 0x7eb9, 0xa746, 0x6b7b, 0x9964, 0x3450, 0x6464, 0xd186,
+      0xd3b7, 0xdcff, 0x4121, 0xb7a8, 0x9b26, 0xdd86, 0x76e4, 0x1f7f, 0x676a, 0x92dd, 0xc9e4, 0xb4af,
+      0x3d8e, 0xe65f, 0xe3f7, 0xdad3, 0xe835, 0xe898, 0xef6f, 0x14ad, 0xc089, 0xddfe, 0x96b6, 0xcbea,
+      0x8981, 0x8e38, 0x8cf4, 0xa914, 0xe298, 0x86b9, 0x971f, 0xbc77, 0xb49b, 0x8a5f, 0x3691, 0xb819,
+      0xebeb, 0xfa67, 0xe242, 0xdb01, 0xb4d8, 0xd344, 0x7dd3, 0xb6a5, 0x0ad5, 0x7ad8, 0xa1a9, 0x42c2,
+    },
+    {
+      0xef6f, 0x5cd6, 0xd95b, 0xd886, 0xf8e5, 0x48aa, 0x58b3, 0x08be, 0xa8b9, 0x8e0e, 0xb0c4, 0x88dd,
+      0xf11a, 0xcf0a, 0xbd07, 0x944a, 0x2891, 0xa439, 0xbeb3, 0xafc3, 0xa8be, 0x2e50, 0xcc0b, 0xa8ca,
+      0x5a6b, 0x73bb, 0x7703, 0x7d77, 0x7691, 0x73e2, 0x73e2, 0x8120, 0x2200, 0x01b2, 0x31c9, 0xb9f6,
+      0x0e5f, 0x892a, 0x48b6, 0xe0da, 0x8c1e, 0x3da6, 0xfbbd, 0xc455, 0xe4c6, 0xa3f2, 0xae79, 0x39c0,
+      0x1809, 0x436c, 0x407d, 0x0f4c, 0xbfbe, 0xf7af, 0xbfac, 0x727e, 0xd4c1, 0x80d1, 0x9947, 0x2b69,
+    },
+    {
+      0x2b69, 0x5fd9, 0xdfc8, 0x8c5f, 0xeb0d, 0x0281, 0x335c, 0x6eb6, 0xe78b, 0x162b, 0xc292, 0x5520,
+      0x2bb3, 0x2b58, 0xae91, 0xa8b1, 0x0180, 0x5821, 0x8b01, 0xa350, 0x0889, 0x1fec, 0x99c2, 0x06a9,
+      0xfdc8, 0x6239, 0x66c1, 0x5915, 0x2c83, 0x56da, 0x2b69, 0x0836, 0x7c8b, 0x5d19, 0xf711, 0xb33d,
+      0x9e0f, 0x1b31, 0xe9ef, 0x96dd, 0xe400, 0x15d5, 0x876c, 0xc81a, 0xaac2, 0x15e1, 0xce8c, 0x3402,
+      0x7416, 0x0c5b, 0x79ed, 0xd139, 0x68ba, 0x3b29, 0x39ef, 0x82f2, 0x0365, 0x19b7, 0xeda5, 0x9947,
+    },
+    {
+      0xef6f, 0x5cd6, 0x6ee5, 0x2820, 0xeec8, 0x7eb9, 0xa746, 0x6b7b, 0x9964, 0x3450, 0x6464, 0xd186,
+      0xd3b7, 0xdcff, 0x4121, 0xb7a8, 0x9b26, 0xdd86, 0x76e4, 0x1f7f, 0x676a, 0x92dd, 0xc9e4, 0xb4af,
+      0x3d8e, 0xe65f, 0xe3f7, 0xdad3, 0xe835, 0xe898, 0xef6f, 0x14ad, 0xc089, 0xddfe, 0x96b6, 0xcbea,
+      0x8981, 0x8e38, 0x8cf4, 0xa914, 0xe298, 0x86b9, 0x971f, 0xbc77, 0xb49b, 0x8a5f, 0x3691, 0xb819,
+      0xebeb, 0xfa67, 0xe242, 0xdb01, 0xb4d8, 0xd344, 0x7dd3, 0xb6a5, 0x0ad5, 0x7ad8, 0xa1a9, 0x42c2,
+    },
+  },
+  {
+    {
+      0xef6f, 0x5cd6, 0x6ee5, 0x2820, 0xeec8, 0x7eb9, 0xa746, 0x6b7b, 0x9964, 0x3450, 0x6464, 0xd186,
+      0xd3b7, 0xdcff, 0x4121, 0xb7a8, 0x9b26, 0xdd86, 0x76e4, 0x1f7f, 0x676a, 0x92dd, 0xc9e4, 0xb4af,
+      0x3d8e, 0xe65f, 0xe3f7, 0xdad3, 0xe835, 0xe898, 0xef6f, 0x14ad, 0xc089, 0xddfe, 0x96b6, 0xcbea,
+      0x8981, 0x8e38, 0x8cf4, 0xa914, 0xe298, 0x86b9, 0x971f, 0xbc77, 0xb49b, 0x8a5f, 0x3691, 0xb819,
+      0xebeb, 0xfa67, 0xe242, 0xdb01, 0xb4d8, 0xd344, 0x7dd3, 0xb6a5, 0x0ad5, 0x7ad8, 0xa1a9, 0x42c2,
+    },
+    {
+      0xef6f, 0x5cd6, 0xd95b, 0xd886, 0xf8e5, 0x48aa, 0x58b3, 0x08be, 0xa8b9, 0x8e0e, 0xb0c4, 0x88dd,
+      0xf11a, 0xcf0a, 0xbd07, 0x944a, 0x2891, 0xa439, 0xbeb3, 0xafc3, 0xa8be, 0x2e50, 0xcc0b, 0xa8ca,
+      0x5a6b, 0x73bb, 0x7703, 0x7d77, 0x7691, 0x73e2, 0x73e2, 0x8120, 0x2200, 0x01b2, 0x31c9, 0xb9f6,
+      0x0e5f, 0x892a, 0x48b6, 0xe0da, 0x8c1e, 0x3da6, 0xfbbd, 0xc455, 0xe4c6, 0xa3f2, 0xae79, 0x39c0,
+      0x1809, 0x436c, 0x407d, 0x0f4c, 0xbfbe, 0xf7af, 0xbfac, 0x727e, 0xd4c1, 0x80d1, 0x9947, 0x2b69,
+    },
+    {
+      0x2b69, 0x5fd9, 0xdfc8, 0x8c5f, 0xeb0d, 0x0281, 0x335c, 0x6eb6, 0xe78b, 0x162b, 0xc292, 0x5520,
+      0x2bb3, 0x2b58, 0xae91, 0xa8b1, 0x0180, 0x5821, 0x8b01, 0xa350, 0x0889, 0x1fec, 0x99c2, 0x06a9,
+      0xfdc8, 0x6239, 0x66c1, 0x5915, 0x2c83, 0x56da, 0x2b69, 0x0836, 0x7c8b, 0x5d19, 0xf711, 0xb33d,
+      0x9e0f, 0x1b31, 0xe9ef, 0x96dd, 0xe400, 0x15d5, 0x876c, 0xc81a, 0xaac2, 0x15e1, 0xce8c, 0x3402,
+      0x7416, 0x0c5b, 0x79ed, 0xd139, 0x68ba, 0x3b29, 0x39ef, 0x82f2, 0x0365, 0x19b7, 0xeda5, 0x9947,
+    },
+    {
+      0xef6f, 0x5cd6, 0x6ee5, 0x2820, 0xeec8, 0x7eb9, 0xa746, 0x6b7b, 0x9964, 0x3450, 0x6464, 0xd186,
+      0xd3b7, 0xdcff, 0x4121, 0xb7a8, 0x9b26, 0xdd86, 0x76e4, 0x1f7f, 0x676a, 0x92dd, 0xc9e4, 0xb4af,
+      0x3d8e, 0xe65f, 0xe3f7, 0xdad3, 0xe835, 0xe898, 0xef6f, 0x14ad, 0xc089, 0xddfe, 0x96b6, 0xcbea,
+      0x8981, 0x8e38, 0x8cf4, 0xa914, 0xe298, 0x86b9, 0x971f, 0xbc77, 0xb49b, 0x8a5f, 0x3691, 0xb819,
+      0xebeb, 0xfa67, 0xe242, 0xdb01, 0xb4d8, 0xd344, 0x7dd3, 0xb6a5, 0x0ad5, 0x7ad8, 0xa1a9, 0x42c2,
+    },
+  },
+};
+
+}  // namespace golden
+}  // namespace wordclock
+}  // namespace esphome
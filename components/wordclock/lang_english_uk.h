@@ -11,17 +11,122 @@ namespace wordclock {
 
 static const char *const TAG_LANG_UK = "wordclock.lang.en_uk";
 
+/// English UK faceplate (row 0 at the top)
+static const char *const ENGLISH_UK_LETTER_GRID[GRID_ROWS] = {
+  "ITRISYTWENTYK",
+  "VTWONEBTHREEC",
+  "AFOURSIXTEENE",
+  "NSEVENINETEEN",
+  "CEIGHTHIRTEEN",
+  "FIVETENELEVEN",
+  "HTWELVEIHALFJ",
+  "LIFEKQUARTERM",
+  "MINUTESWPASTO",
+  "THREEFOURFIVE",
+  "NSIXOSEVENOON",
+  "PNINEIGHTWONE",
+  "QMIDNIGHTENET",
+  "ELEVENLOCLOCK",
+};
+
+/// Word IDs of the English UK phrase program (index ENGLISH_UK_WORDS)
+enum EnglishUKWord : uint8_t {
+  EN_IT,
+  EN_IS,
+  EN_HOUR_0,                   ///< + 1..12
+  EN_NOON = EN_HOUR_0 + 13,
+  EN_MIDNIGHT,
+  EN_OCLOCK,
+  EN_MIN_0,                    ///< + 1..20 (no 15: "quarter")
+  EN_HALF = EN_MIN_0 + 21,
+  EN_QUARTER,
+  EN_MINUTE,
+  EN_MINUTES,
+  EN_PAST,
+  EN_TO,
+  EN_WORD_COUNT
+};
+
+static constexpr PhraseWord ENGLISH_UK_WORDS[EN_WORD_COUNT] = {
+  {"it", LIGHT_HOURS}, {"is", LIGHT_HOURS},
+  // EN_HOUR_0 + h
+  {nullptr, LIGHT_HOURS}, {"1", LIGHT_HOURS}, {"2", LIGHT_HOURS}, {"3", LIGHT_HOURS},
+  {"4", LIGHT_HOURS}, {"5", LIGHT_HOURS}, {"6", LIGHT_HOURS}, {"7", LIGHT_HOURS},
+  {"8", LIGHT_HOURS}, {"9", LIGHT_HOURS}, {"10", LIGHT_HOURS}, {"11", LIGHT_HOURS},
+  {"12", LIGHT_HOURS},
+  {"noon", LIGHT_HOURS}, {"midnight", LIGHT_HOURS}, {"oclock", LIGHT_HOURS},
+  // EN_MIN_0 + m
+  {nullptr, LIGHT_MINUTES}, {"1", LIGHT_MINUTES}, {"2", LIGHT_MINUTES}, {"3", LIGHT_MINUTES},
+  {"4", LIGHT_MINUTES}, {"5", LIGHT_MINUTES}, {"6", LIGHT_MINUTES}, {"7", LIGHT_MINUTES},
+  {"8", LIGHT_MINUTES}, {"9", LIGHT_MINUTES}, {"10", LIGHT_MINUTES}, {"11", LIGHT_MINUTES},
+  {"12", LIGHT_MINUTES}, {"13", LIGHT_MINUTES}, {"14", LIGHT_MINUTES}, {nullptr, LIGHT_MINUTES},
+  {"16", LIGHT_MINUTES}, {"17", LIGHT_MINUTES}, {"18", LIGHT_MINUTES}, {"19", LIGHT_MINUTES},
+  {"20", LIGHT_MINUTES},
+  {"half", LIGHT_MINUTES}, {"quarter", LIGHT_MINUTES}, {"minute", LIGHT_MINUTES},
+  {"minutes", LIGHT_MINUTES}, {"past", LIGHT_MINUTES}, {"to", LIGHT_MINUTES},
+};
+
+/**
+ * English UK phrase: "it is" + "<hour> o'clock", or minutes + past/to + hour.
+ *
+ * After :30 the minutes count down to the next hour. A is the minutes
+ * said, B the hour named (0 = midnight, 12 = noon).
+ */
+static constexpr PhraseOp ENGLISH_UK_PHRASE_OPS[] = {
+  ph_emit(EN_IT), ph_emit(EN_IS),
+
+  ph_if(REG_M, CMP_EQ, 0),
+    ph_if(REG_H, CMP_EQ, 0), ph_emit(EN_MIDNIGHT),
+    ph_elif(REG_H, CMP_EQ, 12), ph_emit(EN_NOON),
+    ph_else(),
+      ph_copy(REG_B, REG_H),
+      ph_if(REG_B, CMP_GT, 12), ph_sub(REG_B, 12), ph_endif(),
+      ph_emit_r(REG_B, EN_HOUR_0), ph_emit(EN_OCLOCK),
+    ph_endif(),
+  ph_else(),
+    ph_copy(REG_A, REG_M), ph_copy(REG_B, REG_H),
+    ph_if(REG_M, CMP_GT, 30), ph_rsub(REG_A, 60), ph_add(REG_B, 1), ph_mod(REG_B, 24), ph_endif(),
+
+    ph_if(REG_A, CMP_EQ, 15), ph_emit(EN_QUARTER),
+    ph_elif(REG_A, CMP_EQ, 30), ph_emit(EN_HALF),
+    ph_elif(REG_A, CMP_EQ, 25), ph_emit(EN_MIN_0 + 20), ph_emit(EN_MIN_0 + 5),
+    ph_elif(REG_A, CMP_DIV, 5), ph_emit_r(REG_A, EN_MIN_0),
+    ph_elif(REG_A, CMP_EQ, 1), ph_emit(EN_MIN_0 + 1), ph_emit(EN_MINUTE),
+    ph_elif(REG_A, CMP_LT, 20), ph_emit_r(REG_A, EN_MIN_0), ph_emit(EN_MINUTES),
+    ph_else(),
+      ph_emit(EN_MIN_0 + 20), ph_mod(REG_A, 10), ph_emit_r(REG_A, EN_MIN_0), ph_emit(EN_MINUTES),
+    ph_endif(),
+
+    ph_if(REG_M, CMP_GT, 30), ph_emit(EN_TO),
+    ph_else(), ph_emit(EN_PAST),
+    ph_endif(),
+
+    ph_if(REG_B, CMP_EQ, 0), ph_emit(EN_MIDNIGHT),
+    ph_elif(REG_B, CMP_EQ, 12), ph_emit(EN_NOON),
+    ph_else(),
+      ph_if(REG_B, CMP_GT, 12), ph_sub(REG_B, 12), ph_endif(),
+      ph_emit_r(REG_B, EN_HOUR_0),
+    ph_endif(),
+  ph_endif(),
+};
+
+static constexpr PhraseProgram ENGLISH_UK_PHRASE = make_phrase_program(ENGLISH_UK_PHRASE_OPS, ENGLISH_UK_WORDS);
+static_assert(ENGLISH_UK_PHRASE.check(), "English UK phrase program emits an unknown word");
+#ifdef USE_WORDCLOCK_PHRASE_TABLE
+static constexpr PhraseTable<phrase_table_size(ENGLISH_UK_PHRASE)> ENGLISH_UK_PHRASE_TABLE =
+    make_phrase_table<phrase_table_size(ENGLISH_UK_PHRASE)>(ENGLISH_UK_PHRASE);
+#endif
+
 class LanguageEnglishUK : public LanguageBase {
  public:
   void init_leds_arrays(
+    StringPool& pool,
     IndexedLedMap& ledsarray_start,
     IndexedLedMap& ledsarray_hours,
     IndexedLedMap& ledsarray_minutes,
     std::array<std::vector<int>, 60>& seconds_ring_leds,
     IndexedLedMap& ledsarray_misc
-  ) override {
-    auto& pool = StringPool::instance();
-    
+  ) const override {
     ledsarray_start.clear();
     ledsarray_hours.clear();
     ledsarray_minutes.clear();
@@ -89,92 +194,13 @@ class LanguageEnglishUK : public LanguageBase {
     ESP_LOGCONFIG(TAG_LANG_UK, "LED arrays initialized (English UK), StringPool size: %d", pool.size());
   }
 
-  void compute_active_leds(int hours, int minutes, int seconds, WordClock* clock) override {
-    int time_hours = hours;
-    int time_minutes = minutes;
-    int time_seconds = seconds;
-
-    clock->add_word_from_map("it", LIGHT_HOURS);
-    clock->add_word_from_map("is", LIGHT_HOURS);
-
-    bool use_to = (time_minutes > 30);
-    int display_minutes = use_to ? (60 - time_minutes) : time_minutes;
-    
-    int display_hour = time_hours;
-    if (use_to) {
-      display_hour = (time_hours + 1) % 24;
-    }
-    
-    bool is_midnight = (display_hour == 0 || display_hour == 24);
-    bool is_noon = (display_hour == 12);
-    int hour_12 = display_hour;
-    if (hour_12 > 12) hour_12 -= 12;
-    if (hour_12 == 0) hour_12 = 12;
-
-    if (time_minutes == 0) {
-      if (time_hours == 0 || time_hours == 24) {
-        clock->add_word_from_map("midnight", LIGHT_HOURS);
-      } else if (time_hours == 12) {
-        clock->add_word_from_map("noon", LIGHT_HOURS);
-      } else {
-        int h = time_hours > 12 ? time_hours - 12 : time_hours;
-        clock->add_word_from_map(std::to_string(h), LIGHT_HOURS);
-        clock->add_word_from_map("oclock", LIGHT_HOURS);
-      }
-    } else {
-      if (display_minutes == 15) {
-        clock->add_word_from_map("quarter", LIGHT_MINUTES);
-      } else if (display_minutes == 30) {
-        clock->add_word_from_map("half", LIGHT_MINUTES);
-      } else if (display_minutes % 5 == 0) {
-        if (display_minutes == 5) {
-          clock->add_word_from_map("5", LIGHT_MINUTES);
-        } else if (display_minutes == 10) {
-          clock->add_word_from_map("10", LIGHT_MINUTES);
-        } else if (display_minutes == 20) {
-          clock->add_word_from_map("20", LIGHT_MINUTES);
-        } else if (display_minutes == 25) {
-          clock->add_word_from_map("20", LIGHT_MINUTES);
-          clock->add_word_from_map("5", LIGHT_MINUTES);
-        }
-      } else {
-        if (display_minutes == 1) {
-          clock->add_word_from_map("1", LIGHT_MINUTES);
-          clock->add_word_from_map("minute", LIGHT_MINUTES);
-        } else if (display_minutes >= 2 && display_minutes <= 9) {
-          clock->add_word_from_map(std::to_string(display_minutes), LIGHT_MINUTES);
-          clock->add_word_from_map("minutes", LIGHT_MINUTES);
-        } else if (display_minutes >= 11 && display_minutes <= 19) {
-          clock->add_word_from_map(std::to_string(display_minutes), LIGHT_MINUTES);
-          clock->add_word_from_map("minutes", LIGHT_MINUTES);
-        } else if (display_minutes >= 21 && display_minutes <= 29) {
-          clock->add_word_from_map("20", LIGHT_MINUTES);
-          int unit = display_minutes % 10;
-          clock->add_word_from_map(std::to_string(unit), LIGHT_MINUTES);
-          clock->add_word_from_map("minutes", LIGHT_MINUTES);
-        }
-      }
-
-      if (use_to) {
-        clock->add_word_from_map("to", LIGHT_MINUTES);
-      } else {
-        clock->add_word_from_map("past", LIGHT_MINUTES);
-      }
-
-      if (is_midnight) {
-        clock->add_word_from_map("midnight", LIGHT_HOURS);
-      } else if (is_noon) {
-        clock->add_word_from_map("noon", LIGHT_HOURS);
-      } else {
-        clock->add_word_from_map(std::to_string(hour_12), LIGHT_HOURS);
-      }
-    }
-
-    clock->compute_seconds_leds(time_seconds);
-    clock->compute_background_leds();
-  }
+  PhraseProgram get_phrase_program() const override { return ENGLISH_UK_PHRASE; }
+#ifdef USE_WORDCLOCK_PHRASE_TABLE
+  PhraseTableView get_phrase_table() const override { return make_phrase_table_view(ENGLISH_UK_PHRASE_TABLE); }
+#endif
 
   const char* get_name() const override { return "English UK"; }
+  const char *const *get_letter_grid() const override { return ENGLISH_UK_LETTER_GRID; }
   const char* get_code() const override { return "en_uk"; }
 };
 
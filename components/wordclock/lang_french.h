@@ -11,17 +11,122 @@ namespace wordclock {
 
 static const char *const TAG_LANG_FR = "wordclock.lang.fr";
 
+/// French faceplate (row 0 at the top)
+static const char *const FRENCH_LETTER_GRID[GRID_ROWS] = {
+  "ILTESTDMINUIT",
+  "UNESEPTROISIX",
+  "CINQUATREDEUX",
+  "HUITNEUFJONZE",
+  "DIXMIDIHEURES",
+  "ETMOINSTRENTE",
+  "FLEVINGTQUART",
+  "CINQUANTEONZE",
+  "QUARANTEDEMIE",
+  "DIXSEIZEDOUZE",
+  "QUATORZETROIS",
+  "QUATREIZEDEUX",
+  "ETFUNEMGSEPTL",
+  "THUITPNEUFSIX",
+};
+
+/// Word IDs of the French phrase program (index FRENCH_WORDS)
+enum FrenchWord : uint8_t {
+  FR_IL,
+  FR_EST,
+  FR_HOUR_0,                   ///< + 1..11 ("une" .. "onze")
+  FR_MINUIT = FR_HOUR_0 + 12,
+  FR_MIDI,
+  FR_HEURE,
+  FR_S,
+  FR_ET,
+  FR_MOINS,
+  FR_LE,
+  FR_QUART,
+  FR_DEMIE,
+  FR_ET_MINUTES,
+  FR_MIN_0,                    ///< + 1..16 (no 15: "et quart")
+  FR_TENS_0 = FR_MIN_0 + 17,   ///< + 1..5 ("dix" .. "cinquante")
+  FR_WORD_COUNT = FR_TENS_0 + 6
+};
+
+static constexpr PhraseWord FRENCH_WORDS[FR_WORD_COUNT] = {
+  {"il", LIGHT_HOURS}, {"est", LIGHT_HOURS},
+  // FR_HOUR_0 + h
+  {nullptr, LIGHT_HOURS}, {"1", LIGHT_HOURS}, {"2", LIGHT_HOURS}, {"3", LIGHT_HOURS},
+  {"4", LIGHT_HOURS}, {"5", LIGHT_HOURS}, {"6", LIGHT_HOURS}, {"7", LIGHT_HOURS},
+  {"8", LIGHT_HOURS}, {"9", LIGHT_HOURS}, {"10", LIGHT_HOURS}, {"11", LIGHT_HOURS},
+  {"minuit", LIGHT_HOURS}, {"midi", LIGHT_HOURS}, {"heure", LIGHT_HOURS}, {"s", LIGHT_HOURS},
+  {"et", LIGHT_MINUTES}, {"moins", LIGHT_MINUTES}, {"le", LIGHT_MINUTES}, {"quart", LIGHT_MINUTES},
+  {"demie", LIGHT_MINUTES}, {"et_minutes", LIGHT_MINUTES},
+  // FR_MIN_0 + m
+  {nullptr, LIGHT_MINUTES}, {"1", LIGHT_MINUTES}, {"2", LIGHT_MINUTES}, {"3", LIGHT_MINUTES},
+  {"4", LIGHT_MINUTES}, {"5", LIGHT_MINUTES}, {"6", LIGHT_MINUTES}, {"7", LIGHT_MINUTES},
+  {"8", LIGHT_MINUTES}, {"9", LIGHT_MINUTES}, {"10", LIGHT_MINUTES}, {"11", LIGHT_MINUTES},
+  {"12", LIGHT_MINUTES}, {"13", LIGHT_MINUTES}, {"14", LIGHT_MINUTES}, {nullptr, LIGHT_MINUTES},
+  {"16", LIGHT_MINUTES},
+  // FR_TENS_0 + tens
+  {nullptr, LIGHT_MINUTES}, {"10", LIGHT_MINUTES}, {"20", LIGHT_MINUTES}, {"30", LIGHT_MINUTES},
+  {"40", LIGHT_MINUTES}, {"50", LIGHT_MINUTES},
+};
+
+/**
+ * French phrase: "il est" + hour + minutes.
+ *
+ * From :35 on, multiples of 5 are said "moins ..." the next hour (F = 1).
+ * B is the hour named (0 = minuit, 12 = midi), A the minutes digits.
+ */
+static constexpr PhraseOp FRENCH_PHRASE_OPS[] = {
+  ph_emit(FR_IL), ph_emit(FR_EST),
+
+  ph_copy(REG_B, REG_H),
+  ph_if(REG_M, CMP_GT, 30),
+    ph_if(REG_M, CMP_DIV, 5), ph_set(REG_F, 1), ph_add(REG_B, 1), ph_endif(),
+  ph_endif(),
+  ph_mod(REG_B, 24),
+  ph_if(REG_B, CMP_EQ, 0), ph_emit(FR_MINUIT),
+  ph_elif(REG_B, CMP_EQ, 12), ph_emit(FR_MIDI),
+  ph_else(),
+    ph_mod(REG_B, 12), ph_emit_r(REG_B, FR_HOUR_0), ph_emit(FR_HEURE),
+    ph_if(REG_B, CMP_GT, 1), ph_emit(FR_S), ph_endif(),
+  ph_endif(),
+
+  ph_if(REG_F, CMP_EQ, 1),
+    ph_emit(FR_MOINS),
+    ph_if(REG_M, CMP_EQ, 45), ph_emit(FR_LE), ph_emit(FR_QUART),
+    ph_elif(REG_M, CMP_EQ, 35), ph_emit(FR_TENS_0 + 2), ph_emit(FR_MIN_0 + 5),
+    ph_elif(REG_M, CMP_EQ, 40), ph_emit(FR_TENS_0 + 2),
+    ph_elif(REG_M, CMP_EQ, 50), ph_emit(FR_MIN_0 + 10),
+    ph_else(), ph_emit(FR_MIN_0 + 5),
+    ph_endif(),
+  ph_elif(REG_M, CMP_EQ, 30), ph_emit(FR_ET), ph_emit(FR_DEMIE),
+  ph_elif(REG_M, CMP_EQ, 15), ph_emit(FR_ET), ph_emit(FR_QUART),
+  ph_elif(REG_M, CMP_EQ, 0),
+  ph_elif(REG_M, CMP_LE, 16), ph_emit_r(REG_M, FR_MIN_0),
+  ph_else(),
+    ph_copy(REG_A, REG_M), ph_div(REG_A, 10), ph_emit_r(REG_A, FR_TENS_0),
+    ph_copy(REG_A, REG_M), ph_mod(REG_A, 10),
+    ph_if(REG_A, CMP_EQ, 1), ph_emit(FR_ET_MINUTES), ph_endif(),
+    ph_if(REG_A, CMP_NE, 0), ph_emit_r(REG_A, FR_MIN_0), ph_endif(),
+  ph_endif(),
+};
+
+static constexpr PhraseProgram FRENCH_PHRASE = make_phrase_program(FRENCH_PHRASE_OPS, FRENCH_WORDS);
+static_assert(FRENCH_PHRASE.check(), "French phrase program emits an unknown word");
+#ifdef USE_WORDCLOCK_PHRASE_TABLE
+static constexpr PhraseTable<phrase_table_size(FRENCH_PHRASE)> FRENCH_PHRASE_TABLE =
+    make_phrase_table<phrase_table_size(FRENCH_PHRASE)>(FRENCH_PHRASE);
+#endif
+
 class LanguageFrench : public LanguageBase {
  public:
   void init_leds_arrays(
+    StringPool& pool,
     IndexedLedMap& ledsarray_start,
     IndexedLedMap& ledsarray_hours,
     IndexedLedMap& ledsarray_minutes,
     std::array<std::vector<int>, 60>& seconds_ring_leds,
     IndexedLedMap& ledsarray_misc
-  ) override {
-    auto& pool = StringPool::instance();
-    
+  ) const override {
     ledsarray_start.clear();
     ledsarray_hours.clear();
     ledsarray_minutes.clear();
@@ -87,80 +192,13 @@ class LanguageFrench : public LanguageBase {
     ESP_LOGCONFIG(TAG_LANG_FR, "LED arrays initialized (French), StringPool size: %d", pool.size());
   }
 
-  void compute_active_leds(int hours, int minutes, int seconds, WordClock* clock) override {
-    int time_hours = hours;
-    int time_minutes = minutes;
-    int time_seconds = seconds;
-    bool morning = true;
-
-    clock->add_word_from_map("il", LIGHT_HOURS);
-    clock->add_word_from_map("est", LIGHT_HOURS);
-
-    if (time_hours == 0) morning = false;
-    if (time_hours > 12) {
-      time_hours -= 12;
-      morning = false;
-    }
-
-    bool use_moins = (time_minutes > 30 && time_minutes % 5 == 0);
-    if (use_moins) {
-      time_hours += 1;
-      if (time_hours == 13) time_hours = 1;
-    }
-
-    if (time_hours > 0 && time_hours != 12) {
-      clock->add_word_from_map(std::to_string(time_hours), LIGHT_HOURS);
-      clock->add_word_from_map("heure", LIGHT_HOURS);
-      if (time_hours > 1) {
-        clock->add_word_from_map("s", LIGHT_HOURS);
-      }
-    } else if (morning == false) {
-      clock->add_word_from_map("minuit", LIGHT_HOURS);
-    } else {
-      clock->add_word_from_map("midi", LIGHT_HOURS);
-    }
-
-    if (use_moins) {
-      clock->add_word_from_map("moins", LIGHT_MINUTES);
-      if (time_minutes == 45) {
-        clock->add_word_from_map("le", LIGHT_MINUTES);
-        clock->add_word_from_map("quart", LIGHT_MINUTES);
-      } else if (time_minutes == 35) {
-        clock->add_word_from_map("20", LIGHT_MINUTES);
-        clock->add_word_from_map("5", LIGHT_MINUTES);
-      } else if (time_minutes == 40) {
-        clock->add_word_from_map("20", LIGHT_MINUTES);
-      } else if (time_minutes == 50) {
-        clock->add_word_from_map("10", LIGHT_MINUTES);
-      } else {
-        clock->add_word_from_map("5", LIGHT_MINUTES);
-      }
-    } else if (time_minutes == 30) {
-      clock->add_word_from_map("et", LIGHT_MINUTES);
-      clock->add_word_from_map("demie", LIGHT_MINUTES);
-    } else if (time_minutes == 15) {
-      clock->add_word_from_map("et", LIGHT_MINUTES);
-      clock->add_word_from_map("quart", LIGHT_MINUTES);
-    } else if (time_minutes > 0) {
-      if (time_minutes % 10 == 0 || time_minutes <= 16) {
-        clock->add_word_from_map(std::to_string(time_minutes), LIGHT_MINUTES);
-      } else {
-        int minutes_unit = time_minutes % 10;
-        int minutes_tens = time_minutes - minutes_unit;
-        
-        clock->add_word_from_map(std::to_string(minutes_tens), LIGHT_MINUTES);
-        if (minutes_unit == 1) {
-          clock->add_word_from_map("et_minutes", LIGHT_MINUTES);
-        }
-        clock->add_word_from_map(std::to_string(minutes_unit), LIGHT_MINUTES);
-      }
-    }
-
-    clock->compute_seconds_leds(time_seconds);
-    clock->compute_background_leds();
-  }
+  PhraseProgram get_phrase_program() const override { return FRENCH_PHRASE; }
+#ifdef USE_WORDCLOCK_PHRASE_TABLE
+  PhraseTableView get_phrase_table() const override { return make_phrase_table_view(FRENCH_PHRASE_TABLE); }
+#endif
 
   const char* get_name() const override { return "Français"; }
+  const char *const *get_letter_grid() const override { return FRENCH_LETTER_GRID; }
   const char* get_code() const override { return "fr"; }
 };
 
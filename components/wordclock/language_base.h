@@ -1,5 +1,6 @@
 #pragma once
 
+#include "phrase_rules.h"
 #include <map>
 #include <array>
 #include <vector>
@@ -10,6 +11,7 @@ namespace esphome {
 namespace wordclock {
 
 class WordClock;
+class StringPool;
 
 /// Type for LED maps using StringPool indices
 using IndexedLedMap = std::unordered_map<size_t, std::vector<int>>;
@@ -19,13 +21,16 @@ using IndexedLedMap = std::unordered_map<size_t, std::vector<int>>;
  * 
  * Each language must implement this interface to define:
  * - Word to LED index mappings for the matrix
- * - Time to words conversion logic
+ * - Time to words conversion, as a phrase program (see phrase_rules.h)
  * 
  * To add a new language:
  * 1. Create a derived class (e.g., LanguageSpanish)
  * 2. Implement init_leds_arrays() with your matrix mappings
- * 3. Implement compute_active_leds() with language-specific logic
- * 4. Register in LanguageManager during setup()
+ * 3. Return the phrase program and its word table from get_phrase_program()
+ * 4. Add it to LanguageManager::get_language()
+ *
+ * Language objects are shared read-only by all WordClock instances: they
+ * must not hold mutable state (all methods are const).
  * 
  * @see LanguageFrench, LanguageEnglishUK for implementation examples
  */
@@ -39,6 +44,7 @@ class LanguageBase {
    * Uses IndexedLedMap with StringPool to save memory.
    * Seconds use a fixed 60-entry array for O(1) access.
    * 
+   * @param pool String pool of the calling WordClock (map keys)
    * @param ledsarray_start Map for start words ("il", "est", "it", "is")
    * @param ledsarray_hours Map for hours ("1"-"12", "midi", "minuit", etc.)
    * @param ledsarray_minutes Map for minutes and modifiers
@@ -46,26 +52,52 @@ class LanguageBase {
    * @param ledsarray_misc Map for special content ("42" for boot)
    */
   virtual void init_leds_arrays(
+    StringPool& pool,
     IndexedLedMap& ledsarray_start,
     IndexedLedMap& ledsarray_hours,
     IndexedLedMap& ledsarray_minutes,
     std::array<std::vector<int>, 60>& seconds_ring_leds,
     IndexedLedMap& ledsarray_misc
-  ) = 0;
+  ) const = 0;
+
+  /**
+   * @brief Returns the time-phrase program of this language
+   *
+   * The program emits word IDs indexing its PhraseWord table; each word's
+   * key must exist in the LED maps built by init_leds_arrays().
+   */
+  virtual PhraseProgram get_phrase_program() const = 0;
+
+  /**
+   * @brief Returns the program expanded into a table (phrase_engine: table)
+   * @return Empty view unless the language compiles one in
+   */
+  virtual PhraseTableView get_phrase_table() const { return {}; }
+
+  /**
+   * @brief Word IDs of the phrase for a given time
+   *
+   * Looks the phrase up in the table for PHRASE_ENGINE_TABLE (if compiled
+   * in), runs the program otherwise. Defined in wordclock.cpp.
+   */
+  PhraseWords evaluate_phrase(int hours, int minutes, PhraseEngine engine) const;
 
   /**
    * @brief Computes active LEDs for a given time
    * 
-   * This method must call clock->add_word_from_map() for each
-   * word to display, then clock->compute_seconds_leds() and 
+   * Evaluates the phrase with the clock's engine (evaluate_phrase()) and
+   * adds each word through clock->add_phrase_word(), or
+   * clock->add_phrase_key() for PHRASE_ENGINE_STRING_KEYS (typing order =
+   * emission order), then calls clock->compute_seconds_leds() and
    * clock->compute_background_leds().
+   * Defined in wordclock.cpp.
    * 
    * @param hours Current hour (0-23)
    * @param minutes Current minutes (0-59)
    * @param seconds Current seconds (0-59)
    * @param clock Pointer to parent WordClock component
    */
-  virtual void compute_active_leds(int hours, int minutes, int seconds, WordClock* clock) = 0;
+  void compute_active_leds(int hours, int minutes, int seconds, WordClock* clock) const;
 
   /**
    * @brief Returns the full language name
@@ -73,6 +105,12 @@ class LanguageBase {
    */
   virtual const char* get_name() const = 0;
 
+  /**
+   * @brief Returns the printed letter grid of this language's faceplate
+   * @return GRID_ROWS strings of GRID_COLS letters (see led_utils.h)
+   */
+  virtual const char *const *get_letter_grid() const = 0;
+
   /**
    * @brief Returns the short language code
    * @return ISO code or abbreviation (e.g., "fr", "en_uk")
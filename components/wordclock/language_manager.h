@@ -1,47 +1,44 @@
 #pragma once
 
+#include "wordclock_config.h"
 #include "language_base.h"
-#include <map>
+#ifdef USE_WORDCLOCK_LANG_FRENCH
+#include "lang_french.h"
+#endif
+#ifdef USE_WORDCLOCK_LANG_ENGLISH_UK
+#include "lang_english_uk.h"
+#endif
 
 namespace esphome {
 namespace wordclock {
 
 /**
- * Singleton manager for language implementations
+ * Registry of the built-in language implementations
+ *
+ * Languages hold no mutable state, so one immutable instance of each is
+ * shared by every WordClock on the device. Per-clock data (string pool,
+ * LED maps) lives in the WordClock itself. Only the languages selected
+ * with the languages: option are compiled in; others return nullptr.
  */
 class LanguageManager {
  public:
-  static LanguageManager& get_instance() {
-    static LanguageManager instance;
-    return instance;
-  }
-
-  void register_language(int lang_id, LanguageBase* lang) {
-    if (languages_.count(lang_id)) {
-      delete languages_[lang_id];
-    }
-    languages_[lang_id] = lang;
-  }
-
-  LanguageBase* get_language(int lang_id) {
-    if (languages_.count(lang_id)) {
-      return languages_[lang_id];
+  static const LanguageBase* get_language(int lang_id) {
+    switch (lang_id) {
+#ifdef USE_WORDCLOCK_LANG_FRENCH
+      case LANG_FRENCH: {
+        static const LanguageFrench french;
+        return &french;
+      }
+#endif
+#ifdef USE_WORDCLOCK_LANG_ENGLISH_UK
+      case LANG_ENGLISH_UK: {
+        static const LanguageEnglishUK english_uk;
+        return &english_uk;
+      }
+#endif
+      default: return nullptr;
     }
-    return nullptr;
   }
-
-  ~LanguageManager() {
-    for (auto& pair : languages_) {
-      delete pair.second;
-    }
-  }
-
- private:
-  LanguageManager() = default;
-  LanguageManager(const LanguageManager&) = delete;
-  LanguageManager& operator=(const LanguageManager&) = delete;
-
-  std::map<int, LanguageBase*> languages_;
 };
 
 }  // namespace wordclock
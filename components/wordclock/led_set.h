@@ -0,0 +1,90 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace wordclock {
+
+/// Upper bound of strip LEDs (num_leds is validated to 1-256)
+static constexpr int LED_SET_SIZE = 256;
+
+// ============================================================================
+// Fixed LED Containers
+// ============================================================================
+
+/**
+ * @brief 256-bit set of LED indices
+ *
+ * Used for per-frame LED membership in the render path: no heap, O(1)
+ * membership, iteration in ascending LED order.
+ * Out-of-range indices are ignored.
+ */
+class LedSet {
+ public:
+  static bool in_range(int led) { return led >= 0 && led < LED_SET_SIZE; }
+
+  bool contains(int led) const { return in_range(led) && (bits_[led >> 6] & (1ULL << (led & 63))); }
+  void insert(int led) {
+    if (in_range(led)) bits_[led >> 6] |= (1ULL << (led & 63));
+  }
+  void erase(int led) {
+    if (in_range(led)) bits_[led >> 6] &= ~(1ULL << (led & 63));
+  }
+  void clear() { bits_.fill(0); }
+
+  bool empty() const { return (bits_[0] | bits_[1] | bits_[2] | bits_[3]) == 0; }
+  size_t size() const {
+    size_t count = 0;
+    for (uint64_t word : bits_) count += __builtin_popcountll(word);
+    return count;
+  }
+
+  /// Calls fn(led) in ascending order; fn may erase the current LED
+  template<typename F> void for_each(F &&fn) const {
+    for (int w = 0; w < 4; w++) {
+      for (uint64_t word = bits_[w]; word != 0; word &= word - 1) {
+        fn(w * 64 + __builtin_ctzll(word));
+      }
+    }
+  }
+
+ protected:
+  std::array<uint64_t, 4> bits_{};
+};
+
+/**
+ * @brief Per-LED value slots with a presence set
+ *
+ * Holds the fade bookkeeping keyed by LED: one preallocated slot per
+ * LED, so starting and ending fades never touch the heap.
+ */
+template<typename T> class LedSlots {
+ public:
+  bool contains(int led) const { return present_.contains(led); }
+  /// Slot of a present LED, nullptr otherwise
+  T *find(int led) { return present_.contains(led) ? &slots_[led] : nullptr; }
+  void set(int led, const T &value) {
+    if (!LedSet::in_range(led)) return;
+    slots_[led] = value;
+    present_.insert(led);
+  }
+  void erase(int led) { present_.erase(led); }
+  void clear() { present_.clear(); }
+
+  bool empty() const { return present_.empty(); }
+  size_t size() const { return present_.size(); }
+
+  /// Calls fn(led, value) in ascending LED order; fn may erase the current LED
+  template<typename F> void for_each(F &&fn) {
+    present_.for_each([&](int led) { fn(led, slots_[led]); });
+  }
+
+ protected:
+  LedSet present_;
+  std::array<T, LED_SET_SIZE> slots_{};
+};
+
+}  // namespace wordclock
+}  // namespace esphome
@@ -3,6 +3,10 @@
 namespace esphome {
 namespace wordclock {
 
+/// Letter matrix dimensions (the seconds ring surrounds it)
+static const int GRID_ROWS = 14;
+static const int GRID_COLS = 13;
+
 // LEDs to exclude from display (corners)
 static const int EXCLUDED_LEDS[] = {0, 31, 32, 63, 64, 95, 96, 127, 128, 159, 160, 191, 192, 223, 224, 255};
 static const int EXCLUDED_LEDS_COUNT = 16;
@@ -38,5 +42,46 @@ inline int get_led_x(int led_index) {
   return (row % 2 == 0) ? col : (15 - col);
 }
 
+/**
+ * Get the LED at a 16x16 position (inverse of get_led_x, serpentine)
+ * @param x Column [0-15]
+ * @param y Strip row [0-15]
+ * @return LED index [0-255]
+ */
+inline int get_led_index(int x, int y) {
+  return y * 16 + ((y % 2 == 0) ? x : (15 - x));
+}
+
+/**
+ * Get the letter grid position of a matrix LED (serpentine, 16 LEDs per strip row)
+ * Strip row r+1 holds grid row r: even rows run L->R in LEDs 1-13,
+ * odd rows run R->L in LEDs 2-14 (see DEVELOPER_GUIDE "Physical LED Wiring").
+ * @param led_index LED index [0-255]
+ * @param row Output grid row [0-13]
+ * @param col Output grid column [0-12]
+ * @return false if the LED is not part of the letter matrix (ring, corners)
+ */
+inline bool get_led_grid_pos(int led_index, int *row, int *col) {
+  int strip_row = led_index / 16;
+  int pos = led_index % 16;
+  if (strip_row < 1 || strip_row > GRID_ROWS) return false;
+  int r = strip_row - 1;
+  int c = (r % 2 == 0) ? (pos - 1) : (GRID_COLS + 1 - pos);
+  if (c < 0 || c >= GRID_COLS) return false;
+  *row = r;
+  *col = c;
+  return true;
+}
+
+/**
+ * Get the LED of a letter grid position (inverse of get_led_grid_pos)
+ * @param row Grid row [0-13]
+ * @param col Grid column [0-12]
+ * @return LED index [17-238]
+ */
+constexpr int get_grid_led(int row, int col) {
+  return (row + 1) * 16 + ((row % 2 == 0) ? (col + 1) : (GRID_COLS + 1 - col));
+}
+
 }  // namespace wordclock
 }  // namespace esphome
@@ -1,7 +1,7 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import light
-from esphome.const import CONF_OUTPUT_ID
+from esphome.const import CONF_ID, CONF_OUTPUT_ID
 
 from .. import wordclock_ns, WordClock, CONF_WORDCLOCK_ID, LIGHT_TYPES
 
@@ -24,4 +24,5 @@ async def to_code(config):
     parent = await cg.get_variable(config[CONF_WORDCLOCK_ID])
     cg.add(var.set_wordclock(parent))
     cg.add(var.set_light_type(config[CONF_LIGHT_TYPE]))
+    cg.add(var.set_restore_key(config[CONF_ID].id))
     cg.add(parent.register_light(var, config[CONF_LIGHT_TYPE]))
@@ -23,12 +23,17 @@ class WordClockLight : public light::LightOutput, public Component {
     // Get default values based on light type
     LightColorState state = get_default_state();
     
-    // Create unique hash based on light_type_
-    uint32_t hash = fnv1_hash("wordclock_light_" + std::to_string(light_type_));
+    // Key on the light's id: the light type alone is shared by every clock
+    std::string legacy_key = "wordclock_light_" + std::to_string(light_type_);
+    uint32_t hash = fnv1_hash(restore_key_.empty() ? legacy_key : "wordclock_light_" + restore_key_);
     
     // Try to load from preferences (will keep default if no saved state)
     this->pref_ = global_preferences->make_preference<LightColorState>(hash);
-    this->pref_.load(&state);
+    if (!this->pref_.load(&state) && !restore_key_.empty()) {
+      // Colours saved under the type-only key before: adopt them once
+      auto legacy = global_preferences->make_preference<LightColorState>(fnv1_hash(legacy_key));
+      legacy.load(&state);
+    }
     
     // Store for later use
     saved_state_ = state;
@@ -76,10 +81,17 @@ class WordClockLight : public light::LightOutput, public Component {
       current.brightness = state_->current_values.get_brightness();
       this->pref_.save(&current);
     }
+
+    // Push the new colour snapshot to the renderer
+    if (wordclock_) {
+      wordclock_->on_light_changed(light_type_);
+    }
   }
 
   void set_wordclock(WordClock *wordclock) { wordclock_ = wordclock; }
   void set_light_type(LightType type) { light_type_ = type; }
+  /// Preference key (the light's id), unique across clocks on one device
+  void set_restore_key(const std::string &key) { restore_key_ = key; }
 
   void get_rgb(float *r, float *g, float *b, float *brightness) {
     if (state_) {
@@ -158,6 +170,7 @@ class WordClockLight : public light::LightOutput, public Component {
 
   WordClock *wordclock_{nullptr};
   LightType light_type_{LIGHT_HOURS};
+  std::string restore_key_;
   light::LightState *state_{nullptr};
   ESPPreferenceObject pref_;
   LightColorState saved_state_;
@@ -0,0 +1,199 @@
+#include "marquee.h"
+
+#ifdef USE_WORDCLOCK_MARQUEE
+
+namespace esphome {
+namespace wordclock {
+
+// ============================================================================
+// 5x7 Font
+// ============================================================================
+//
+// Printable ASCII (32-126) followed by the degree sign. Five columns per
+// glyph, bit 0 = top row.
+
+static constexpr int FONT_FIRST = 32;
+static constexpr int FONT_DEGREE = 127 - FONT_FIRST;
+static constexpr int FONT_UNKNOWN = '?' - FONT_FIRST;
+
+static constexpr uint8_t FONT_5X7[][MARQUEE_GLYPH_WIDTH] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00},  // space
+    {0x00, 0x00, 0x5F, 0x00, 0x00},  // !
+    {0x00, 0x07, 0x00, 0x07, 0x00},  // "
+    {0x14, 0x7F, 0x14, 0x7F, 0x14},  // #
+    {0x24, 0x2A, 0x7F, 0x2A, 0x12},  // $
+    {0x23, 0x13, 0x08, 0x64, 0x62},  // %
+    {0x36, 0x49, 0x55, 0x22, 0x50},  // &
+    {0x00, 0x05, 0x03, 0x00, 0x00},  // '
+    {0x00, 0x1C, 0x22, 0x41, 0x00},  // (
+    {0x00, 0x41, 0x22, 0x1C, 0x00},  // )
+    {0x08, 0x2A, 0x1C, 0x2A, 0x08},  // *
+    {0x08, 0x08, 0x3E, 0x08, 0x08},  // +
+    {0x00, 0x50, 0x30, 0x00, 0x00},  // ,
+    {0x08, 0x08, 0x08, 0x08, 0x08},  // -
+    {0x00, 0x60, 0x60, 0x00, 0x00},  // .
+    {0x20, 0x10, 0x08, 0x04, 0x02},  // /
+    {0x3E, 0x51, 0x49, 0x45, 0x3E},  // 0
+    {0x00, 0x42, 0x7F, 0x40, 0x00},  // 1
+    {0x42, 0x61, 0x51, 0x49, 0x46},  // 2
+    {0x21, 0x41, 0x45, 0x4B, 0x31},  // 3
+    {0x18, 0x14, 0x12, 0x7F, 0x10},  // 4
+    {0x27, 0x45, 0x45, 0x45, 0x39},  // 5
+    {0x3C, 0x4A, 0x49, 0x49, 0x30},  // 6
+    {0x01, 0x71, 0x09, 0x05, 0x03},  // 7
+    {0x36, 0x49, 0x49, 0x49, 0x36},  // 8
+    {0x06, 0x49, 0x49, 0x29, 0x1E},  // 9
+    {0x00, 0x36, 0x36, 0x00, 0x00},  // :
+    {0x00, 0x56, 0x36, 0x00, 0x00},  // ;
+    {0x08, 0x14, 0x22, 0x41, 0x00},  // <
+    {0x14, 0x14, 0x14, 0x14, 0x14},  // =
+    {0x00, 0x41, 0x22, 0x14, 0x08},  // >
+    {0x02, 0x01, 0x51, 0x09, 0x06},  // ?
+    {0x32, 0x49, 0x79, 0x41, 0x3E},  // @
+    {0x7E, 0x11, 0x11, 0x11, 0x7E},  // A
+    {0x7F, 0x49, 0x49, 0x49, 0x36},  // B
+    {0x3E, 0x41, 0x41, 0x41, 0x22},  // C
+    {0x7F, 0x41, 0x41, 0x22, 0x1C},  // D
+    {0x7F, 0x49, 0x49, 0x49, 0x41},  // E
+    {0x7F, 0x09, 0x09, 0x09, 0x01},  // F
+    {0x3E, 0x41, 0x49, 0x49, 0x7A},  // G
+    {0x7F, 0x08, 0x08, 0x08, 0x7F},  // H
+    {0x00, 0x41, 0x7F, 0x41, 0x00},  // I
+    {0x20, 0x40, 0x41, 0x3F, 0x01},  // J
+    {0x7F, 0x08, 0x14, 0x22, 0x41},  // K
+    {0x7F, 0x40, 0x40, 0x40, 0x40},  // L
+    {0x7F, 0x02, 0x0C, 0x02, 0x7F},  // M
+    {0x7F, 0x04, 0x08, 0x10, 0x7F},  // N
+    {0x3E, 0x41, 0x41, 0x41, 0x3E},  // O
+    {0x7F, 0x09, 0x09, 0x09, 0x06},  // P
+    {0x3E, 0x41, 0x51, 0x21, 0x5E},  // Q
+    {0x7F, 0x09, 0x19, 0x29, 0x46},  // R
+    {0x46, 0x49, 0x49, 0x49, 0x31},  // S
+    {0x01, 0x01, 0x7F, 0x01, 0x01},  // T
+    {0x3F, 0x40, 0x40, 0x40, 0x3F},  // U
+    {0x1F, 0x20, 0x40, 0x20, 0x1F},  // V
+    {0x3F, 0x40, 0x38, 0x40, 0x3F},  // W
+    {0x63, 0x14, 0x08, 0x14, 0x63},  // X
+    {0x07, 0x08, 0x70, 0x08, 0x07},  // Y
+    {0x61, 0x51, 0x49, 0x45, 0x43},  // Z
+    {0x00, 0x7F, 0x41, 0x41, 0x00},  // [
+    {0x02, 0x04, 0x08, 0x10, 0x20},  // backslash
+    {0x00, 0x41, 0x41, 0x7F, 0x00},  // ]
+    {0x04, 0x02, 0x01, 0x02, 0x04},  // ^
+    {0x40, 0x40, 0x40, 0x40, 0x40},  // _
+    {0x00, 0x01, 0x02, 0x04, 0x00},  // `
+    {0x20, 0x54, 0x54, 0x54, 0x78},  // a
+    {0x7F, 0x48, 0x44, 0x44, 0x38},  // b
+    {0x38, 0x44, 0x44, 0x44, 0x20},  // c
+    {0x38, 0x44, 0x44, 0x48, 0x7F},  // d
+    {0x38, 0x54, 0x54, 0x54, 0x18},  // e
+    {0x08, 0x7E, 0x09, 0x01, 0x02},  // f
+    {0x0C, 0x52, 0x52, 0x52, 0x3E},  // g
+    {0x7F, 0x08, 0x04, 0x04, 0x78},  // h
+    {0x00, 0x44, 0x7D, 0x40, 0x00},  // i
+    {0x20, 0x40, 0x44, 0x3D, 0x00},  // j
+    {0x7F, 0x10, 0x28, 0x44, 0x00},  // k
+    {0x00, 0x41, 0x7F, 0x40, 0x00},  // l
+    {0x7C, 0x04, 0x18, 0x04, 0x78},  // m
+    {0x7C, 0x08, 0x04, 0x04, 0x78},  // n
+    {0x38, 0x44, 0x44, 0x44, 0x38},  // o
+    {0x7C, 0x14, 0x14, 0x14, 0x08},  // p
+    {0x08, 0x14, 0x14, 0x18, 0x7C},  // q
+    {0x7C, 0x08, 0x04, 0x04, 0x08},  // r
+    {0x48, 0x54, 0x54, 0x54, 0x20},  // s
+    {0x04, 0x3F, 0x44, 0x40, 0x20},  // t
+    {0x3C, 0x40, 0x40, 0x20, 0x7C},  // u
+    {0x1C, 0x20, 0x40, 0x20, 0x1C},  // v
+    {0x3C, 0x40, 0x30, 0x40, 0x3C},  // w
+    {0x44, 0x28, 0x10, 0x28, 0x44},  // x
+    {0x0C, 0x50, 0x50, 0x50, 0x3C},  // y
+    {0x44, 0x64, 0x54, 0x4C, 0x44},  // z
+    {0x00, 0x08, 0x36, 0x41, 0x00},  // {
+    {0x00, 0x00, 0x7F, 0x00, 0x00},  // |
+    {0x00, 0x41, 0x36, 0x08, 0x00},  // }
+    {0x08, 0x04, 0x08, 0x10, 0x08},  // ~
+    {0x00, 0x06, 0x09, 0x09, 0x06},  // degree sign
+};
+
+static_assert(sizeof(FONT_5X7) / MARQUEE_GLYPH_WIDTH == FONT_DEGREE + 1, "one glyph per printable character");
+
+// ============================================================================
+// Marquee
+// ============================================================================
+
+Marquee::Marquee() {
+  // The whole grid goes dark, including the rows above and below the glyphs
+  for (int row = 0; row < GRID_ROWS; row++) {
+    for (int col = 0; col < GRID_COLS; col++) grid_.insert(get_grid_led(row, col));
+  }
+}
+
+bool Marquee::stage(const char *text, int repeat) {
+  if (pending_.load(std::memory_order_acquire)) return false;
+  int length = 0;
+  const auto *p = reinterpret_cast<const unsigned char *>(text != nullptr ? text : "");
+  while (*p != '\0' && length < config::MARQUEE_MAX_CHARS) {
+    int glyph = FONT_UNKNOWN;
+    if (*p >= FONT_FIRST && *p < 127) {
+      glyph = *p - FONT_FIRST;
+      p++;
+    } else if (p[0] == 0xC2 && p[1] == 0xB0) {  // UTF-8 degree sign
+      glyph = FONT_DEGREE;
+      p += 2;
+    } else {
+      // Other UTF-8 sequences: one '?' per character
+      p++;
+      while ((*p & 0xC0) == 0x80) p++;
+    }
+    staged_[length++] = uint8_t(glyph);
+  }
+  staged_length_ = uint8_t(length);
+  staged_passes_ = repeat < 0 ? repeat_ : uint8_t(repeat);
+  pending_.store(true, std::memory_order_release);
+  return true;
+}
+
+void Marquee::commit(uint32_t now_ms) {
+  if (!pending_.load(std::memory_order_acquire)) return;
+  glyphs_ = staged_;
+  length_ = staged_length_;
+  passes_ = staged_passes_;
+  start_ms_ = now_ms;
+  pending_.store(false, std::memory_order_release);
+}
+
+uint8_t Marquee::column_bits(int x) const {
+  int glyph = x / MARQUEE_ADVANCE;
+  int column = x % MARQUEE_ADVANCE;
+  if (column == MARQUEE_GLYPH_WIDTH) return 0;
+  return FONT_5X7[glyphs_[glyph]][column];
+}
+
+bool Marquee::render(uint32_t now_ms, LedSet &lit) {
+  if (length_ == 0) return false;
+
+  // The message enters at the right edge and leaves at the left one
+  int columns = length_ * MARQUEE_ADVANCE - 1;
+  uint32_t travel = uint32_t(columns + GRID_COLS);
+  uint32_t scrolled = uint32_t(uint64_t(now_ms - start_ms_) * speed_mcps_ / 1000000);
+  if (passes_ > 0 && scrolled / travel >= passes_) {
+    length_ = 0;
+    return false;
+  }
+  int offset = int(scrolled % travel) - GRID_COLS;
+
+  for (int col = 0; col < GRID_COLS; col++) {
+    int x = offset + col;
+    if (x < 0 || x >= columns) continue;
+    const auto &leds = MARQUEE_LEDS[col];
+    for (uint32_t bits = column_bits(x); bits != 0; bits &= bits - 1) {
+      lit.insert(leds[__builtin_ctz(bits)]);
+    }
+  }
+  return true;
+}
+
+}  // namespace wordclock
+}  // namespace esphome
+
+#endif  // USE_WORDCLOCK_MARQUEE
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "wordclock_config.h"
+
+#ifdef USE_WORDCLOCK_MARQUEE
+
+#include "esphome/core/color.h"
+#include "led_set.h"
+#include "led_utils.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace esphome {
+namespace wordclock {
+
+// ============================================================================
+// Marquee (marquee: in the YAML)
+// ============================================================================
+//
+// Scrolls a short message through the letter grid in a 5x7 font, lighting
+// the letters under the glyph pixels. A glyph is five column bytes (bit 0 =
+// top row) in a flash table (marquee.cpp); a message column is one byte,
+// so a frame lights the visible window column by column with bit scans.
+
+/// Glyph size and the blank column after each glyph
+static constexpr int MARQUEE_GLYPH_WIDTH = 5;
+static constexpr int MARQUEE_GLYPH_HEIGHT = 7;
+static constexpr int MARQUEE_ADVANCE = MARQUEE_GLYPH_WIDTH + 1;
+
+/// Glyph rows sit on grid rows 3-9, centred in the 14 rows
+static constexpr int MARQUEE_TOP_ROW = (GRID_ROWS - MARQUEE_GLYPH_HEIGHT) / 2;
+
+/// LED under each glyph pixel of the window: [grid column][glyph row]
+using MarqueeLedTable = std::array<std::array<uint8_t, MARQUEE_GLYPH_HEIGHT>, GRID_COLS>;
+
+constexpr MarqueeLedTable make_marquee_leds() {
+  MarqueeLedTable leds{};
+  for (int col = 0; col < GRID_COLS; col++) {
+    for (int row = 0; row < MARQUEE_GLYPH_HEIGHT; row++) {
+      leds[col][row] = uint8_t(get_grid_led(MARQUEE_TOP_ROW + row, col));
+    }
+  }
+  return leds;
+}
+
+static constexpr MarqueeLedTable MARQUEE_LEDS = make_marquee_leds();
+
+/**
+ * @brief One scrolling message
+ *
+ * Text comes from the ESPHome loop (API actions) while the renderer may be
+ * drawing, so stage() converts it into glyph indices in a staging buffer
+ * and commit() swaps it in on the renderer side (CMD_MARQUEE), as for
+ * effect programs. The scroll position is computed from the time since
+ * commit(), so the speed does not depend on the frame rate.
+ */
+class Marquee {
+ public:
+  Marquee();
+
+  void set_color(Color color) { color_ = color; }
+  void set_speed(float columns_per_second) { speed_mcps_ = uint32_t(columns_per_second * 1000.0f + 0.5f); }
+  void set_repeat(uint8_t repeat) { repeat_ = repeat; }
+  Color color() const { return color_; }
+
+  /**
+   * @brief Converts UTF-8 text into the staging buffer (loop thread)
+   * @param repeat Times the message crosses the grid, 0 = until stopped, -1 = set_repeat()
+   * @return false if the previous message was not started yet
+   */
+  bool stage(const char *text, int repeat);
+  /// Starts the staged message (renderer side); an empty one stops the marquee
+  void commit(uint32_t now_ms);
+  /// Drops the staged message when its CMD_MARQUEE was not queued (loop thread)
+  void cancel() { pending_.store(false, std::memory_order_release); }
+  void stop() { length_ = 0; }
+
+  bool active() const { return length_ > 0; }
+  /// Letter grid LEDs, covered while a message scrolls
+  const LedSet &grid() const { return grid_; }
+
+  /**
+   * @brief Lit LEDs of the current window
+   * @return false once the message has scrolled out for the last time
+   */
+  bool render(uint32_t now_ms, LedSet &lit);
+
+ protected:
+  /// Column bits at message column x (glyph columns, then a blank one)
+  uint8_t column_bits(int x) const;
+
+  std::array<uint8_t, config::MARQUEE_MAX_CHARS> glyphs_{};
+  std::array<uint8_t, config::MARQUEE_MAX_CHARS> staged_{};
+  uint8_t length_{0};
+  uint8_t staged_length_{0};
+  uint8_t passes_{1};  ///< Times the message crosses the grid, 0 = until stopped
+  uint8_t staged_passes_{1};
+  std::atomic<bool> pending_{false};
+  uint32_t start_ms_{0};
+
+  Color color_{255, 255, 255};
+  uint32_t speed_mcps_{uint32_t(config::MARQUEE_DEFAULT_SPEED * 1000.0f)};  ///< Columns per 1000 s
+  uint8_t repeat_{1};
+  LedSet grid_;
+};
+
+}  // namespace wordclock
+}  // namespace esphome
+
+#endif  // USE_WORDCLOCK_MARQUEE
@@ -3,18 +3,31 @@ import esphome.config_validation as cv
 from esphome.components import number
 from esphome.const import CONF_ID, CONF_MIN_VALUE, CONF_MAX_VALUE, CONF_STEP
 
-from .. import wordclock_ns, WordClock, CONF_WORDCLOCK_ID
+from .. import wordclock_ns, WordClock, CONF_WORDCLOCK_ID, LightType, RenderCommandType
 
 WordClockNumber = wordclock_ns.class_("WordClockNumber", number.Number, cg.Component)
 
 CONF_NUMBER_TYPE = "number_type"
 
+# Per-layer numbers: words_effect_brightness and effect_speed skip these layers
+LAYER_CONTROLS = {
+    "hours_effect_brightness": (RenderCommandType.CMD_LAYER_EFFECT_BRIGHTNESS, LightType.LIGHT_HOURS),
+    "minutes_effect_brightness": (RenderCommandType.CMD_LAYER_EFFECT_BRIGHTNESS, LightType.LIGHT_MINUTES),
+    "background_effect_brightness": (RenderCommandType.CMD_LAYER_EFFECT_BRIGHTNESS, LightType.LIGHT_BACKGROUND),
+    "hours_effect_speed": (RenderCommandType.CMD_LAYER_EFFECT_SPEED, LightType.LIGHT_HOURS),
+    "minutes_effect_speed": (RenderCommandType.CMD_LAYER_EFFECT_SPEED, LightType.LIGHT_MINUTES),
+    "seconds_effect_speed": (RenderCommandType.CMD_LAYER_EFFECT_SPEED, LightType.LIGHT_SECONDS),
+    "background_effect_speed": (RenderCommandType.CMD_LAYER_EFFECT_SPEED, LightType.LIGHT_BACKGROUND),
+}
+
 CONFIG_SCHEMA = cv.Schema({
     cv.GenerateID(): cv.declare_id(WordClockNumber),
     cv.Required(CONF_WORDCLOCK_ID): cv.use_id(WordClock),
     cv.Required(CONF_NUMBER_TYPE): cv.one_of(
         "words_fade_in", "words_fade_out", "seconds_fade_out", "typing_delay",
         "rainbow_spread", "words_effect_brightness", "effect_speed", "seconds_effect_brightness",
+        "hours_effect_brightness", "minutes_effect_brightness", "background_effect_brightness",
+        "hours_effect_speed", "minutes_effect_speed", "seconds_effect_speed", "background_effect_speed",
         lower=True
     ),
     cv.Optional(CONF_MIN_VALUE, default=0.0): cv.float_,
@@ -34,5 +47,11 @@ async def to_code(config):
     type_map = {
         "words_fade_in": 0, "words_fade_out": 1, "seconds_fade_out": 2, "typing_delay": 3,
         "rainbow_spread": 4, "words_effect_brightness": 5, "effect_speed": 6, "seconds_effect_brightness": 7,
+        "hours_effect_brightness": 8, "minutes_effect_brightness": 9, "background_effect_brightness": 10,
+        "hours_effect_speed": 11, "minutes_effect_speed": 12, "seconds_effect_speed": 13,
+        "background_effect_speed": 14,
     }
     cg.add(var.set_number_type(type_map[config[CONF_NUMBER_TYPE]]))
+    if config[CONF_NUMBER_TYPE] in LAYER_CONTROLS:
+        command, layer = LAYER_CONTROLS[config[CONF_NUMBER_TYPE]]
+        cg.add(parent.add_layer_control(command, layer))
@@ -8,7 +8,8 @@ namespace esphome {
 namespace wordclock {
 
 // 0=words_fade_in, 1=words_fade_out, 2=seconds_fade_out, 3=typing_delay, 4=rainbow_spread, 
-// 5=words_effect_brightness, 6=effect_speed, 7=seconds_effect_brightness
+// 5=words_effect_brightness, 6=effect_speed, 7=seconds_effect_brightness,
+// 8..10=hours/minutes/background_effect_brightness, 11..14=hours/minutes/seconds/background_effect_speed
 class WordClockNumber : public number::Number, public Component {
  public:
   void setup() override {
@@ -38,6 +39,13 @@ class WordClockNumber : public number::Number, public Component {
       case 5: return 50.0f;  // words_effect_brightness (50%)
       case 6: return 10.0f;  // effect_speed (10%)
       case 7: return 50.0f;  // seconds_effect_brightness (50%)
+      case 8: return 50.0f;  // hours_effect_brightness (50%)
+      case 9: return 50.0f;  // minutes_effect_brightness (50%)
+      case 10: return 10.0f;  // background_effect_brightness (10%)
+      case 11:
+      case 12:
+      case 13:
+      case 14: return 10.0f;  // <layer>_effect_speed (10%)
       default: return 0.0f;
     }
   }
@@ -59,6 +67,13 @@ class WordClockNumber : public number::Number, public Component {
       case 5: wordclock_->set_words_effect_brightness(value); break;
       case 6: wordclock_->set_effect_speed(value); break;
       case 7: wordclock_->set_seconds_effect_brightness(value); break;
+      case 8: wordclock_->set_layer_effect_brightness(LIGHT_HOURS, value); break;
+      case 9: wordclock_->set_layer_effect_brightness(LIGHT_MINUTES, value); break;
+      case 10: wordclock_->set_layer_effect_brightness(LIGHT_BACKGROUND, value); break;
+      case 11: wordclock_->set_layer_effect_speed(LIGHT_HOURS, value); break;
+      case 12: wordclock_->set_layer_effect_speed(LIGHT_MINUTES, value); break;
+      case 13: wordclock_->set_layer_effect_speed(LIGHT_SECONDS, value); break;
+      case 14: wordclock_->set_layer_effect_speed(LIGHT_BACKGROUND, value); break;
     }
   }
 
@@ -0,0 +1,146 @@
+#pragma once
+
+#include "wordclock_config.h"
+
+#ifdef USE_WORDCLOCK_OVERLAYS
+
+#include "esphome/core/color.h"
+#include "led_set.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace wordclock {
+
+// ============================================================================
+// Overlays (overlays: in the YAML)
+// ============================================================================
+//
+// An overlay lights a preset set of words (or the "42") in its own colour
+// for a while, over the clock: doorbell, timer or alert notifications. It
+// is composited into the frame only. Fades, typing and the prev colours
+// keep following the clock underneath, so it resumes unchanged when the
+// overlay ends.
+
+enum OverlayBlend : uint8_t {
+  OVERLAY_REPLACE = 0,  ///< Overlay colour instead of the clock
+  OVERLAY_ADD,          ///< Added to the clock colour, saturating
+  OVERLAY_MIX           ///< Half clock, half overlay
+};
+
+/**
+ * @brief A notification preset
+ *
+ * The keys are resolved into an LED set once per language
+ * (WordClock::build_overlay_leds()), so showing an overlay does no
+ * lookups.
+ */
+struct OverlayPreset {
+  const char *name{nullptr};
+  Color color{};
+  OverlayBlend blend{OVERLAY_REPLACE};
+  uint8_t priority{0};
+  uint32_t duration_ms{0};
+  uint32_t flash_ms{0};               ///< Blink half-period, 0 = steady
+  std::vector<const char *> hours;    ///< Hour-layer LED map keys (codegen literals)
+  std::vector<const char *> minutes;  ///< Minute-layer keys
+  std::vector<const char *> misc;     ///< Special content keys ("42")
+  LedSet leds;                        ///< Resolved for the current language
+};
+
+/// One overlay being shown
+struct OverlayEntry {
+  uint8_t preset;
+  uint8_t priority;
+  uint32_t start_ms;
+  uint32_t duration_ms;
+};
+
+/**
+ * @brief Overlays being shown, ascending priority (the last one is on top)
+ *
+ * Fixed size: a burst of notifications replaces the lowest-priority
+ * overlays instead of allocating. Renderer side only.
+ */
+class OverlayQueue {
+ public:
+  /// @return false if every slot holds a higher-priority overlay
+  bool push(const OverlayEntry &entry) {
+    // A preset shown again restarts
+    remove_if([&](const OverlayEntry &e) { return e.preset == entry.preset; });
+    if (count_ == config::OVERLAY_SLOTS) {
+      // entries_[0]: lowest priority, oldest among equals
+      if (entries_[0].priority > entry.priority) return false;
+      remove_at(0);
+    }
+    // Newer overlays go on top of older ones of the same priority
+    int i = count_;
+    while (i > 0 && entries_[i - 1].priority > entry.priority) {
+      entries_[i] = entries_[i - 1];
+      i--;
+    }
+    entries_[i] = entry;
+    count_++;
+    return true;
+  }
+
+  /// Drops the overlays whose duration has passed
+  void expire(uint32_t now_ms) {
+    remove_if([now_ms](const OverlayEntry &e) { return now_ms - e.start_ms >= e.duration_ms; });
+  }
+
+  void clear() { count_ = 0; }
+  bool empty() const { return count_ == 0; }
+  int size() const { return count_; }
+  const OverlayEntry &operator[](int i) const { return entries_[i]; }
+
+ protected:
+  template<typename Pred> void remove_if(Pred pred) {
+    int kept = 0;
+    for (int i = 0; i < count_; i++) {
+      if (!pred(entries_[i])) entries_[kept++] = entries_[i];
+    }
+    count_ = kept;
+  }
+  void remove_at(int index) {
+    for (int i = index + 1; i < count_; i++) entries_[i - 1] = entries_[i];
+    count_--;
+  }
+
+  std::array<OverlayEntry, config::OVERLAY_SLOTS> entries_{};
+  int count_{0};
+};
+
+/**
+ * @brief Weight of an overlay [0-255] at elapsed_ms into it
+ *
+ * Fades in and out over OVERLAY_FADE_MS; with flash_ms, off every other
+ * half-period.
+ */
+inline uint8_t overlay_level(uint32_t elapsed_ms, uint32_t duration_ms, uint32_t flash_ms) {
+  if (elapsed_ms >= duration_ms) return 0;
+  if (flash_ms > 0 && ((elapsed_ms / flash_ms) & 1)) return 0;
+  uint32_t edge = std::min(elapsed_ms, duration_ms - elapsed_ms);
+  if (edge >= config::OVERLAY_FADE_MS) return 255;
+  return uint8_t(edge * 255 / config::OVERLAY_FADE_MS);
+}
+
+/// Clock colour under with an overlay colour over it at weight level
+inline Color overlay_blend(Color under, Color over, uint8_t level, OverlayBlend blend) {
+  int weight = blend == OVERLAY_MIX ? level / 2 : level;
+  if (blend == OVERLAY_ADD) {
+    return Color(uint8_t(std::min(255, under.r + over.r * weight / 255)),
+                 uint8_t(std::min(255, under.g + over.g * weight / 255)),
+                 uint8_t(std::min(255, under.b + over.b * weight / 255)));
+  }
+  return Color(uint8_t(under.r + (over.r - under.r) * weight / 255),
+               uint8_t(under.g + (over.g - under.g) * weight / 255),
+               uint8_t(under.b + (over.b - under.b) * weight / 255));
+}
+
+}  // namespace wordclock
+}  // namespace esphome
+
+#endif  // USE_WORDCLOCK_OVERLAYS
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "wordclock_config.h"
+
+#ifdef USE_WORDCLOCK_PALETTES
+
+#include "esphome/core/color.h"
+#include <array>
+#include <cstdint>
+
+namespace esphome {
+namespace wordclock {
+
+// ============================================================================
+// Palettes (palettes: in the YAML)
+// ============================================================================
+//
+// A palette is a cyclic gradient of up to PALETTE_MAX_STOPS colours. The
+// effect using it expands it once into a 256-entry LUT at the effect
+// brightness; the renderer then only indexes the LUT with an 8-bit phase.
+
+/**
+ * @brief Gradient stops, positions ascending in [0-255]
+ *
+ * The last stop blends back into the first across 255 -> 0, so the
+ * palette cycles without a seam.
+ */
+struct Palette {
+  std::array<uint8_t, config::PALETTE_MAX_STOPS> positions{};
+  std::array<Color, config::PALETTE_MAX_STOPS> colors{};
+  uint8_t count{0};
+};
+
+/// 8-bit palette index of a hue-like phase [0-1)
+inline uint8_t palette_index(float phase) { return uint8_t(uint32_t(phase * 256.0f) & 0xFF); }
+
+/**
+ * @brief 256-entry RGB expansion of one palette at one brightness
+ */
+class PaletteLut {
+ public:
+  /// Rebuilds only if the palette or the brightness changed
+  void update(const Palette *palette, float brightness) {
+    if (palette == palette_ && brightness == brightness_) return;
+    palette_ = palette;
+    brightness_ = brightness;
+    if (palette == nullptr || palette->count == 0) {
+      lut_.fill({0, 0, 0});
+      return;
+    }
+    build(*palette, brightness);
+  }
+
+  Color sample(uint8_t index) const {
+    const auto &rgb = lut_[index];
+    return Color(rgb[0], rgb[1], rgb[2]);
+  }
+
+ protected:
+  void build(const Palette &palette, float brightness) {
+    // Brightness is folded into the table: sampling is a plain load
+    int scale = int(brightness * 256.0f + 0.5f);
+    if (scale < 0) scale = 0;
+    if (scale > 256) scale = 256;
+
+    int count = palette.count;
+    for (int s = 0; s < count; s++) {
+      const Color &from = palette.colors[s];
+      const Color &to = palette.colors[(s + 1) % count];
+      int start = palette.positions[s];
+      // Segment length; the last one wraps round to the first stop
+      int end = s + 1 < count ? palette.positions[s + 1] : palette.positions[0] + 256;
+      int length = end - start;
+      if (count == 1) length = 256;
+      for (int k = 0; k < length; k++) {
+        int a = length > 0 ? k * 256 / length : 0;
+        auto &rgb = lut_[(start + k) & 0xFF];
+        rgb[0] = uint8_t(((from.r * (256 - a) + to.r * a) >> 8) * scale >> 8);
+        rgb[1] = uint8_t(((from.g * (256 - a) + to.g * a) >> 8) * scale >> 8);
+        rgb[2] = uint8_t(((from.b * (256 - a) + to.b * a) >> 8) * scale >> 8);
+      }
+    }
+  }
+
+  std::array<std::array<uint8_t, 3>, 256> lut_{};
+  const Palette *palette_{nullptr};
+  float brightness_{-1.0f};
+};
+
+}  // namespace wordclock
+}  // namespace esphome
+
+#endif  // USE_WORDCLOCK_PALETTES
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "wordclock.h"
+#include "alloc_audit.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include <array>
+#include <vector>
+
+namespace esphome {
+namespace wordclock {
+namespace bench {
+
+static const char *const TAG_BENCH = "wordclock.bench";
+
+static constexpr int SECONDS_PER_DAY = 24 * 60 * 60;
+
+static const char *const PHRASE_ENGINE_NAMES[PHRASE_ENGINE_COUNT] = {"bytecode", "table", "string_keys"};
+
+struct PhraseBenchResult {
+  int language{0};
+  PhraseEngine engine{PHRASE_ENGINE_BYTECODE};
+  uint32_t calls{0};           ///< compute_active_leds() calls per round
+  float leds_ns{0.0f};         ///< compute_active_leds() per call: phrase, words, seconds, background
+  float phrase_ns{0.0f};       ///< Phrase rules alone per call (word IDs, no LEDs)
+  float allocs_per_call{-1.0f};  ///< -1 without alloc_audit: in the YAML
+  bool matches{true};          ///< Same LED lists as the bytecode engine for every minute
+};
+
+/// FNV-1a over every active list, order-sensitive (typing order included).
+/// Each index is mixed whole: strips can be longer than 256 LEDs.
+inline uint32_t leds_digest(WordClock *clock) {
+  uint32_t hash = 2166136261UL;
+  auto mix = [&hash](const std::vector<int> &leds) {
+    hash = (hash ^ 0xFF) * 16777619UL;
+    for (int led : leds) {
+      auto index = uint32_t(led);
+      for (int i = 0; i < 4; i++) hash = (hash ^ ((index >> (i * 8)) & 0xFF)) * 16777619UL;
+    }
+  };
+  mix(clock->get_active_hours_leds());
+  mix(clock->get_active_minutes_leds());
+  mix(clock->get_active_seconds_leds());
+  mix(clock->get_active_background_leds());
+  mix(clock->get_typing_sequence());
+  return hash;
+}
+
+/// Nanoseconds per call of the best round (micros() resolution over a whole round)
+template<typename F> inline float time_best_round(uint32_t calls, int rounds, F &&run_round) {
+  uint32_t best_us = UINT32_MAX;
+  for (int r = 0; r < rounds; r++) {
+    uint32_t start = micros();
+    run_round();
+    uint32_t elapsed = micros() - start;
+    if (elapsed < best_us) best_us = elapsed;
+  }
+  return calls > 0 ? float(best_us) * 1000.0f / float(calls) : 0.0f;
+}
+
+/**
+ * @brief Times compute_active_leds() for every second of the day, per
+ * compiled language and phrase engine
+ *
+ * Each engine is first checked against the bytecode engine minute by
+ * minute (LED lists and typing order), then timed over 86400/step calls;
+ * the best of `rounds` rounds is kept. The table engine is skipped for
+ * languages built without USE_WORDCLOCK_PHRASE_TABLE. Allocations are
+ * counted when alloc_audit: is compiled in.
+ *
+ * Blocks for several seconds on an ESP32 (use a larger step there) and
+ * mutates the live display state: intended for host replay, like
+ * golden::verify_golden_frames(), and refused (no results) while the
+ * render task runs.
+ */
+inline std::vector<PhraseBenchResult> run_phrase_benchmark(WordClock *clock, int step = 1, int rounds = 3) {
+  std::vector<PhraseBenchResult> results;
+  if (clock->is_render_task_running()) {
+    ESP_LOGE(TAG_BENCH, "Render task running, the benchmark needs the display state on this thread");
+    return results;
+  }
+  if (step < 1) step = 1;
+  if (rounds < 1) rounds = 1;
+  int saved_language = clock->get_language();
+  PhraseEngine saved_engine = clock->get_phrase_engine();
+  std::vector<uint32_t> reference(24 * 60);
+  volatile uint32_t sink = 0;
+
+  for (int lang = 0; lang < LANG_COUNT; lang++) {
+    if (!WordClock::has_language(lang)) continue;  // not compiled in (languages:)
+    clock->set_language(lang);
+
+    for (int e = 0; e < PHRASE_ENGINE_COUNT; e++) {
+      PhraseEngine engine = PhraseEngine(e);
+      if (engine == PHRASE_ENGINE_TABLE && !clock->has_phrase_table()) continue;
+      clock->set_phrase_engine(engine);
+
+      PhraseBenchResult result;
+      result.language = lang;
+      result.engine = engine;
+      for (int minute = 0; minute < 24 * 60; minute++) {
+        clock->evaluate_leds(minute / 60, minute % 60, minute % 60);
+        uint32_t digest = leds_digest(clock);
+        if (engine == PHRASE_ENGINE_BYTECODE) {
+          reference[minute] = digest;
+        } else if (digest != reference[minute]) {
+          result.matches = false;
+        }
+      }
+
+      result.calls = uint32_t((SECONDS_PER_DAY + step - 1) / step);
+#ifdef USE_WORDCLOCK_ALLOC_AUDIT
+      uint32_t allocs_before = heap_allocation_count();
+#endif
+      result.leds_ns = time_best_round(result.calls, rounds, [&]() {
+        for (int t = 0; t < SECONDS_PER_DAY; t += step) clock->evaluate_leds(t / 3600, (t / 60) % 60, t % 60);
+      });
+#ifdef USE_WORDCLOCK_ALLOC_AUDIT
+      result.allocs_per_call = float(heap_allocation_count() - allocs_before) / float(result.calls * rounds);
+#endif
+      result.phrase_ns = time_best_round(result.calls, rounds, [&]() {
+        for (int t = 0; t < SECONDS_PER_DAY; t += step) sink += clock->evaluate_phrase(t / 3600, (t / 60) % 60).count;
+      });
+      results.push_back(result);
+    }
+  }
+
+  clock->set_phrase_engine(saved_engine);
+  clock->set_language(saved_language);
+  (void) sink;
+
+  ESP_LOGI(TAG_BENCH, "Phrase engines (%d rounds, %u calls each):", rounds, results.empty() ? 0u : results[0].calls);
+  ESP_LOGI(TAG_BENCH, "  lang  engine       leds ns/call  rules ns/call  allocs/call  match");
+  for (const auto &r : results) {
+    ESP_LOGI(TAG_BENCH, "  %4d  %-11s  %12.1f  %13.1f  %11.2f  %s", r.language, PHRASE_ENGINE_NAMES[r.engine],
+             r.leds_ns, r.phrase_ns, r.allocs_per_call, r.matches ? "yes" : "NO");
+  }
+  return results;
+}
+
+}  // namespace bench
+}  // namespace wordclock
+}  // namespace esphome
@@ -0,0 +1,293 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace wordclock {
+
+// ============================================================================
+// Time-Phrase Bytecode
+// ============================================================================
+//
+// A language describes which words spell a given hour and minute with a
+// short program instead of hand-written C++. The program runs on a few
+// byte registers (hour and minute are preloaded), tests them with
+// structured IF / ELIF / ELSE / ENDIF blocks and emits word IDs, which
+// index the language's PhraseWord table.
+//
+// Programs are pure functions of (hours, minutes) and evaluate_phrase() is
+// constexpr: the same code runs once per minute at run time, or expands a
+// program into a 1440-entry table (check_phrase_program() does so at build
+// time to validate every language, make_phrase_table() for the table
+// engine).
+
+/// Registers available to phrase programs
+enum PhraseRegister : uint8_t {
+  REG_H = 0,  ///< Hours 0-23 (preloaded)
+  REG_M,      ///< Minutes 0-59 (preloaded)
+  REG_A,      ///< Scratch, initially 0
+  REG_B,      ///< Scratch, initially 0
+  REG_F,      ///< Flag / scratch, initially 0
+  PHRASE_REG_COUNT
+};
+
+enum PhraseOpcode : uint8_t {
+  OP_SET = 0,  ///< reg = value
+  OP_COPY,     ///< reg = reg2
+  OP_ADD,      ///< reg += value
+  OP_SUB,      ///< reg -= value
+  OP_RSUB,     ///< reg = value - reg
+  OP_MOD,      ///< reg %= value
+  OP_DIV,      ///< reg /= value
+  OP_IF,       ///< Enter block if the condition holds
+  OP_ELIF,     ///< Next alternative of the enclosing IF
+  OP_ELSE,     ///< Last alternative of the enclosing IF
+  OP_ENDIF,    ///< End of block
+  OP_EMIT,     ///< Emit word ID
+  OP_EMIT_R    ///< Emit word ID base + reg
+};
+
+enum PhraseCompare : uint8_t {
+  CMP_EQ = 0,
+  CMP_NE,
+  CMP_LT,
+  CMP_LE,
+  CMP_GT,
+  CMP_GE,
+  CMP_DIV,  ///< reg is a multiple of value
+  CMP_NDIV  ///< reg is not a multiple of value
+};
+
+/// One instruction: opcode plus up to three byte operands
+struct PhraseOp {
+  uint8_t op;
+  uint8_t a;
+  uint8_t b;
+  uint8_t c;
+};
+
+/// Word emitted by a program: LED map key and LightType layer
+struct PhraseWord {
+  const char *key;  ///< nullptr = no word (hole in an EMIT_R range)
+  uint8_t layer;
+};
+
+/// @name Program builders
+/// @{
+constexpr PhraseOp ph_set(uint8_t reg, uint8_t value) { return {OP_SET, reg, value, 0}; }
+constexpr PhraseOp ph_copy(uint8_t reg, uint8_t src) { return {OP_COPY, reg, src, 0}; }
+constexpr PhraseOp ph_add(uint8_t reg, uint8_t value) { return {OP_ADD, reg, value, 0}; }
+constexpr PhraseOp ph_sub(uint8_t reg, uint8_t value) { return {OP_SUB, reg, value, 0}; }
+constexpr PhraseOp ph_rsub(uint8_t reg, uint8_t value) { return {OP_RSUB, reg, value, 0}; }
+constexpr PhraseOp ph_mod(uint8_t reg, uint8_t value) { return {OP_MOD, reg, value, 0}; }
+constexpr PhraseOp ph_div(uint8_t reg, uint8_t value) { return {OP_DIV, reg, value, 0}; }
+constexpr PhraseOp ph_if(uint8_t reg, PhraseCompare cmp, uint8_t value) { return {OP_IF, reg, cmp, value}; }
+constexpr PhraseOp ph_elif(uint8_t reg, PhraseCompare cmp, uint8_t value) { return {OP_ELIF, reg, cmp, value}; }
+constexpr PhraseOp ph_else() { return {OP_ELSE, 0, 0, 0}; }
+constexpr PhraseOp ph_endif() { return {OP_ENDIF, 0, 0, 0}; }
+constexpr PhraseOp ph_emit(uint8_t word) { return {OP_EMIT, word, 0, 0}; }
+constexpr PhraseOp ph_emit_r(uint8_t reg, uint8_t base) { return {OP_EMIT_R, reg, base, 0}; }
+/// @}
+
+/// Upper bound of words in one phrase
+static constexpr size_t MAX_PHRASE_WORDS = 12;
+
+/// Words of one phrase, in typing order
+struct PhraseWords {
+  uint8_t count{0};
+  uint8_t ids[MAX_PHRASE_WORDS]{};
+  bool error{false};  ///< Word ID out of range or more than MAX_PHRASE_WORDS words
+};
+
+constexpr bool phrase_compare(int value, uint8_t cmp, int operand) {
+  switch (cmp) {
+    case CMP_EQ: return value == operand;
+    case CMP_NE: return value != operand;
+    case CMP_LT: return value < operand;
+    case CMP_LE: return value <= operand;
+    case CMP_GT: return value > operand;
+    case CMP_GE: return value >= operand;
+    case CMP_DIV: return operand != 0 && value % operand == 0;
+    case CMP_NDIV: return operand != 0 && value % operand != 0;
+    default: return false;
+  }
+}
+
+/**
+ * @brief Index of the next instruction at the current nesting depth
+ * @param stop_at_branch true to also stop at ELIF / ELSE (after a failed
+ *        condition), false to stop only at ENDIF (after a taken branch)
+ */
+constexpr size_t phrase_skip(const PhraseOp *program, size_t length, size_t pc, bool stop_at_branch) {
+  int depth = 0;
+  for (; pc < length; pc++) {
+    uint8_t op = program[pc].op;
+    if (op == OP_IF) {
+      depth++;
+    } else if (op == OP_ENDIF) {
+      if (depth == 0) return pc;
+      depth--;
+    } else if (depth == 0 && stop_at_branch && (op == OP_ELIF || op == OP_ELSE)) {
+      return pc;
+    }
+  }
+  return length;
+}
+
+/**
+ * @brief Runs a phrase program for one minute of the day
+ * @return Emitted word IDs in order
+ */
+constexpr PhraseWords evaluate_phrase(const PhraseOp *program, size_t length, int hours, int minutes) {
+  PhraseWords out{};
+  int regs[PHRASE_REG_COUNT] = {hours, minutes, 0, 0, 0};
+  size_t pc = 0;
+
+  while (pc < length) {
+    const PhraseOp &op = program[pc++];
+    switch (op.op) {
+      case OP_SET: regs[op.a] = op.b; break;
+      case OP_COPY: regs[op.a] = regs[op.b]; break;
+      case OP_ADD: regs[op.a] += op.b; break;
+      case OP_SUB: regs[op.a] -= op.b; break;
+      case OP_RSUB: regs[op.a] = op.b - regs[op.a]; break;
+      case OP_MOD: if (op.b) regs[op.a] %= op.b; break;
+      case OP_DIV: if (op.b) regs[op.a] /= op.b; break;
+      case OP_IF:
+        if (phrase_compare(regs[op.a], op.b, op.c)) break;
+        // Condition failed: find the first ELIF that holds, an ELSE or ENDIF
+        pc = phrase_skip(program, length, pc, true);
+        while (pc < length && program[pc].op == OP_ELIF &&
+               !phrase_compare(regs[program[pc].a], program[pc].b, program[pc].c)) {
+          pc = phrase_skip(program, length, pc + 1, true);
+        }
+        pc++;
+        break;
+      case OP_ELIF:
+      case OP_ELSE:
+        // Reached the end of a taken branch: leave the block
+        pc = phrase_skip(program, length, pc, false) + 1;
+        break;
+      case OP_ENDIF: break;
+      case OP_EMIT:
+      case OP_EMIT_R: {
+        int id = op.op == OP_EMIT ? op.a : op.b + regs[op.a];
+        if (id < 0 || id > 0xFF || out.count == MAX_PHRASE_WORDS) {
+          out.error = true;
+        } else {
+          out.ids[out.count++] = uint8_t(id);
+        }
+        break;
+      }
+      default: break;
+    }
+  }
+  return out;
+}
+
+/**
+ * @brief Build-time validation: expands the program for all 1440 minutes
+ *
+ * Every emitted ID must name a word of the table and no phrase may exceed
+ * MAX_PHRASE_WORDS. Use in a static_assert next to the program.
+ */
+constexpr bool check_phrase_program(const PhraseOp *program, size_t length, const PhraseWord *words,
+                                    size_t word_count) {
+  for (int t = 0; t < 24 * 60; t++) {
+    PhraseWords phrase = evaluate_phrase(program, length, t / 60, t % 60);
+    if (phrase.error || phrase.count == 0) return false;
+    for (int i = 0; i < phrase.count; i++) {
+      if (phrase.ids[i] >= word_count || words[phrase.ids[i]].key == nullptr) return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief A language's phrase program and the words it emits
+ */
+struct PhraseProgram {
+  const PhraseOp *ops{nullptr};
+  size_t length{0};
+  const PhraseWord *words{nullptr};
+  size_t word_count{0};
+
+  constexpr PhraseWords evaluate(int hours, int minutes) const {
+    return evaluate_phrase(ops, length, hours, minutes);
+  }
+  constexpr bool check() const { return check_phrase_program(ops, length, words, word_count); }
+};
+
+template<size_t N, size_t W>
+constexpr PhraseProgram make_phrase_program(const PhraseOp (&ops)[N], const PhraseWord (&words)[W]) {
+  return {ops, N, words, W};
+}
+
+// ============================================================================
+// Phrase Engines
+// ============================================================================
+
+/// How a clock turns the time into lit words (phrase_engine: in the YAML)
+enum PhraseEngine : uint8_t {
+  PHRASE_ENGINE_BYTECODE = 0,  ///< Program run once per minute, words resolved by ID
+  PHRASE_ENGINE_TABLE,         ///< Build-time table of all phrases (USE_WORDCLOCK_PHRASE_TABLE)
+  PHRASE_ENGINE_STRING_KEYS,   ///< Program run, each word looked up by key (benchmark reference)
+  PHRASE_ENGINE_COUNT
+};
+
+static constexpr int PHRASE_MINUTES = 24 * 60;
+
+/// Word IDs emitted over the whole day: size of the program's table
+constexpr size_t phrase_table_size(const PhraseProgram &program) {
+  size_t size = 0;
+  for (int t = 0; t < PHRASE_MINUTES; t++) size += program.evaluate(t / 60, t % 60).count;
+  return size;
+}
+
+/**
+ * @brief Every phrase of the day, expanded from a program at build time
+ *
+ * The phrase of minute t is ids[offsets[t]] .. ids[offsets[t + 1] - 1].
+ * About 12 KB of flash per language instead of an interpreter run per minute.
+ */
+template<size_t N> struct PhraseTable {
+  static_assert(N <= 0xFFFF, "phrase table offsets are 16-bit");
+  uint16_t offsets[PHRASE_MINUTES + 1]{};
+  uint8_t ids[N]{};
+};
+
+template<size_t N> constexpr PhraseTable<N> make_phrase_table(const PhraseProgram &program) {
+  PhraseTable<N> table{};
+  size_t next = 0;
+  for (int t = 0; t < PHRASE_MINUTES; t++) {
+    PhraseWords phrase = program.evaluate(t / 60, t % 60);
+    table.offsets[t] = uint16_t(next);
+    for (int i = 0; i < phrase.count; i++) table.ids[next++] = phrase.ids[i];
+  }
+  table.offsets[PHRASE_MINUTES] = uint16_t(next);
+  return table;
+}
+
+/**
+ * @brief Size-independent view of a PhraseTable (empty if not compiled in)
+ */
+struct PhraseTableView {
+  const uint16_t *offsets{nullptr};
+  const uint8_t *ids{nullptr};
+
+  bool empty() const { return offsets == nullptr; }
+  PhraseWords lookup(int hours, int minutes) const {
+    PhraseWords out{};
+    int t = hours * 60 + minutes;
+    for (uint16_t i = offsets[t]; i < offsets[t + 1]; i++) out.ids[out.count++] = ids[i];
+    return out;
+  }
+};
+
+template<size_t N> constexpr PhraseTableView make_phrase_table_view(const PhraseTable<N> &table) {
+  return {table.offsets, table.ids};
+}
+
+}  // namespace wordclock
+}  // namespace esphome
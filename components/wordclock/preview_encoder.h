@@ -0,0 +1,147 @@
+#pragma once
+
+#include "render_task.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace esphome {
+namespace wordclock {
+
+// ============================================================================
+// Preview Encoder
+// ============================================================================
+//
+// Turns composed frames into compact text messages for the preview stream.
+// A message is the base64 of a pixel RLE of (frame XOR reference):
+//
+//   token 0x00-0x7F   (n+1) copies of the following 3-byte pixel
+//   token 0x80-0xFF   (n-0x7F) literal pixels follow, 3 bytes each
+//
+// A keyframe is XORed against black, so it decodes without history and
+// starts with "<num_leds>,". A delta is XORed against the previous message;
+// unchanged LEDs XOR to 0 and collapse into 4-byte runs.
+
+/// Largest RLE payload: every token covers at least one 3-byte pixel
+static constexpr size_t PREVIEW_RLE_MAX = MAX_LEDS * 4;
+/// Largest text message: "256," + base64(PREVIEW_RLE_MAX) + NUL
+static constexpr size_t PREVIEW_TEXT_MAX = 4 + (PREVIEW_RLE_MAX + 2) / 3 * 4 + 1;
+
+class PreviewEncoder {
+ public:
+  /// Copies a composed frame (strip order, RGB only)
+  void capture(const FrameBuffer &frame, int num_leds) {
+    num_leds_ = std::min<int>(std::max(num_leds, 0), MAX_LEDS);
+    for (int i = 0; i < num_leds_; i++) {
+      current_[i * 3] = frame[i].r;
+      current_[i * 3 + 1] = frame[i].g;
+      current_[i * 3 + 2] = frame[i].b;
+    }
+    dirty_ = true;
+  }
+
+  /// Copies a frame that is already RGB in strip order (UDP input)
+  void capture_rgb(const uint8_t *rgb, int num_leds) {
+    num_leds_ = std::min<int>(std::max(num_leds, 0), MAX_LEDS);
+    std::memcpy(current_.data(), rgb, num_leds_ * 3);
+    dirty_ = true;
+  }
+
+  bool has_frame() const { return num_leds_ > 0; }
+  /// A frame was captured since the last encode()
+  bool dirty() const { return dirty_; }
+
+  /// Forgets the reference: the next message must be a keyframe
+  void reset() { has_reference_ = false; }
+  bool needs_keyframe() const { return !has_reference_; }
+
+  /**
+   * @brief Encodes the captured frame against the reference
+   * @return NUL-terminated message, nullptr when a delta would be empty
+   */
+  const char *encode(bool keyframe) {
+    dirty_ = false;
+    if (!keyframe && !has_reference_) keyframe = true;
+    if (keyframe) reference_.fill(0);
+    else if (std::memcmp(reference_.data(), current_.data(), num_leds_ * 3) == 0) return nullptr;
+
+    size_t rle_len = encode_rle_();
+    std::memcpy(reference_.data(), current_.data(), num_leds_ * 3);
+    has_reference_ = true;
+
+    char *out = text_.data();
+    if (keyframe) out += write_count_(out, num_leds_);
+    out += encode_base64_(rle_.data(), rle_len, out);
+    *out = '\0';
+    return text_.data();
+  }
+
+ protected:
+  bool same_pixel_(int a, int b) const {
+    return xor_(a * 3) == xor_(b * 3) && xor_(a * 3 + 1) == xor_(b * 3 + 1) && xor_(a * 3 + 2) == xor_(b * 3 + 2);
+  }
+  uint8_t xor_(int i) const { return current_[i] ^ reference_[i]; }
+
+  size_t encode_rle_() {
+    size_t len = 0;
+    int i = 0;
+    while (i < num_leds_) {
+      int run = 1;
+      while (i + run < num_leds_ && run < 128 && same_pixel_(i, i + run)) run++;
+      if (run >= 2) {
+        rle_[len++] = uint8_t(run - 1);
+        for (int c = 0; c < 3; c++) rle_[len++] = xor_(i * 3 + c);
+        i += run;
+        continue;
+      }
+      // Literal span up to the next pair of identical pixels
+      int count = 1;
+      while (i + count < num_leds_ && count < 128 &&
+             !(i + count + 1 < num_leds_ && same_pixel_(i + count, i + count + 1)))
+        count++;
+      rle_[len++] = uint8_t(0x80 + count - 1);
+      for (int p = i; p < i + count; p++) {
+        for (int c = 0; c < 3; c++) rle_[len++] = xor_(p * 3 + c);
+      }
+      i += count;
+    }
+    return len;
+  }
+
+  static size_t write_count_(char *out, int count) {
+    size_t len = 0;
+    if (count >= 100) out[len++] = char('0' + count / 100);
+    if (count >= 10) out[len++] = char('0' + count / 10 % 10);
+    out[len++] = char('0' + count % 10);
+    out[len++] = ',';
+    return len;
+  }
+
+  static size_t encode_base64_(const uint8_t *data, size_t len, char *out) {
+    static const char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    size_t o = 0;
+    for (size_t i = 0; i < len; i += 3) {
+      uint32_t chunk = uint32_t(data[i]) << 16;
+      if (i + 1 < len) chunk |= uint32_t(data[i + 1]) << 8;
+      if (i + 2 < len) chunk |= data[i + 2];
+      out[o++] = ALPHABET[(chunk >> 18) & 63];
+      out[o++] = ALPHABET[(chunk >> 12) & 63];
+      out[o++] = i + 1 < len ? ALPHABET[(chunk >> 6) & 63] : '=';
+      out[o++] = i + 2 < len ? ALPHABET[chunk & 63] : '=';
+    }
+    return o;
+  }
+
+  int num_leds_{0};
+  bool dirty_{false};
+  bool has_reference_{false};
+  std::array<uint8_t, MAX_LEDS * 3> current_{};
+  std::array<uint8_t, MAX_LEDS * 3> reference_{};
+  std::array<uint8_t, PREVIEW_RLE_MAX> rle_{};
+  std::array<char, PREVIEW_TEXT_MAX> text_{};
+};
+
+}  // namespace wordclock
+}  // namespace esphome
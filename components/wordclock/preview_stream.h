@@ -0,0 +1,98 @@
+#pragma once
+
+#include "wordclock_config.h"
+
+#ifdef USE_WORDCLOCK_PREVIEW
+
+#include "preview_encoder.h"
+#include "esphome/core/component.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include "esphome/components/web_server_base/web_server_base.h"
+#include <atomic>
+#include <string>
+
+namespace esphome {
+namespace wordclock {
+
+static const char *const TAG_PREVIEW = "wordclock.preview";
+
+// ============================================================================
+// Preview Stream (preview: in the YAML)
+// ============================================================================
+
+/**
+ * @brief Server-Sent Events endpoint streaming the composed frames
+ *
+ * WordClock::copy_frame_to_strip() hands every presented frame to
+ * capture(), a plain copy out of the framebuffer (the AddressableLight
+ * driver is never read back). Encoding and sending happen in this
+ * component's own loop(), rate-limited to max_fps and only while a client
+ * is connected. Events: "key" (full frame) and "delta", see
+ * preview_encoder.h for the payload.
+ */
+class PreviewStream : public Component {
+ public:
+  void set_path(const std::string &path) { path_ = path; }
+  void set_max_fps(float fps) { min_interval_ms_ = fps > 0 ? uint32_t(1000.0f / fps) : 0; }
+
+  void setup() override {
+    auto *server = web_server_base::global_web_server_base;
+    if (server == nullptr) {
+      ESP_LOGE(TAG_PREVIEW, "Preview needs web_server");
+      mark_failed();
+      return;
+    }
+    events_ = new AsyncEventSource(path_.c_str());  // NOLINT - lives as long as the server
+    // Runs on the web server task: only flag the request
+    events_->onConnect([this](auto *client) { keyframe_requested_.store(true, std::memory_order_relaxed); });
+    server->add_handler(events_);
+  }
+
+  void loop() override {
+    if (events_ == nullptr) return;
+    if (events_->count() == 0) {
+      encoder_.reset();
+      return;
+    }
+    if (!encoder_.has_frame()) return;
+
+    uint32_t now = millis();
+    bool keyframe = keyframe_requested_.exchange(false, std::memory_order_relaxed) || encoder_.needs_keyframe() ||
+                    now - last_keyframe_ms_ >= config::PREVIEW_KEYFRAME_INTERVAL_MS;
+    if (!keyframe && (!encoder_.dirty() || now - last_send_ms_ < min_interval_ms_)) return;
+
+    const char *message = encoder_.encode(keyframe);
+    if (message == nullptr) return;
+    last_send_ms_ = now;
+    if (keyframe) last_keyframe_ms_ = now;
+    events_->send(message, keyframe ? "key" : "delta", ++sequence_);
+  }
+
+  float get_setup_priority() const override { return setup_priority::WIFI - 1.0f; }
+
+  void dump_config() override {
+    ESP_LOGCONFIG(TAG_PREVIEW, "Preview stream: %s (min interval %u ms, %u B RAM)", path_.c_str(),
+                  (unsigned) min_interval_ms_, (unsigned) sizeof(encoder_));
+  }
+
+  /// Called from copy_frame_to_strip() with the frame just presented
+  void capture(const FrameBuffer &frame, int num_leds) { encoder_.capture(frame, num_leds); }
+  /// Called by the UDP input with the external frame it just showed
+  void capture_rgb(const uint8_t *rgb, int num_leds) { encoder_.capture_rgb(rgb, num_leds); }
+
+ protected:
+  std::string path_;
+  uint32_t min_interval_ms_{uint32_t(1000.0f / config::PREVIEW_DEFAULT_FPS)};
+  AsyncEventSource *events_{nullptr};
+  std::atomic<bool> keyframe_requested_{false};
+  PreviewEncoder encoder_;
+  uint32_t last_send_ms_{0};
+  uint32_t last_keyframe_ms_{0};
+  uint32_t sequence_{0};
+};
+
+}  // namespace wordclock
+}  // namespace esphome
+
+#endif  // USE_WORDCLOCK_PREVIEW
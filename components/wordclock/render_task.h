@@ -0,0 +1,256 @@
+#pragma once
+
+#include "esphome/core/color.h"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#ifdef USE_WORDCLOCK_RENDER_TASK
+#if defined(USE_ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#elif defined(USE_HOST)
+#include <chrono>
+#include <thread>
+#endif
+#endif
+
+namespace esphome {
+namespace wordclock {
+
+/// Maximum strip length handled by the internal framebuffer
+static constexpr size_t MAX_LEDS = 256;
+
+/// Composed frame, one colour per strip LED
+using FrameBuffer = std::array<Color, MAX_LEDS>;
+
+// ============================================================================
+// Render Commands
+// ============================================================================
+
+enum RenderCommandType : uint8_t {
+  CMD_TIME_TICK = 0,
+  CMD_POWER,
+  CMD_SECONDS_MODE,
+  CMD_LAYER_EFFECT,
+  CMD_LANGUAGE,
+  CMD_WORDS_FADE_IN,
+  CMD_WORDS_FADE_OUT,
+  CMD_SECONDS_FADE_OUT,
+  CMD_TYPING_DELAY,
+  CMD_RAINBOW_SPREAD,
+  CMD_LAYER_EFFECT_BRIGHTNESS,
+  CMD_LAYER_EFFECT_SPEED,
+  CMD_LAYER_LIGHT,
+  CMD_REDRAW,
+  CMD_EFFECT_PROGRAM,
+  CMD_OVERLAY,
+  CMD_MARQUEE,
+  CMD_THROTTLE
+};
+
+/**
+ * @brief Control change passed from the ESPHome loop to the renderer
+ */
+struct RenderCommand {
+  RenderCommandType type;
+  int32_t value{0};     ///< Integer payload (mode, effect, h*3600+m*60+s, light type, overlay)
+  float fvalue{0.0f};   ///< Float payload (durations, percentages, ms into the second)
+  bool on{false};       ///< On/off payload (power, layer light)
+  Color color{};        ///< Layer colour for CMD_LAYER_LIGHT
+  uint8_t layers{0};    ///< Layer mask (1 << LightType) for the CMD_LAYER_EFFECT* commands
+  uint32_t issued_us{0};  ///< micros() when submitted, stamped by submit_command()
+};
+
+// ============================================================================
+// Lock-free Single-Producer / Single-Consumer Queue
+// ============================================================================
+
+/**
+ * @brief Bounded lock-free SPSC ring buffer
+ *
+ * One thread calls push(), one other thread calls pop(). N must be a power
+ * of two; one slot is kept free to tell full from empty.
+ */
+template<typename T, size_t N>
+class SpscQueue {
+  static_assert((N & (N - 1)) == 0, "SpscQueue size must be a power of two");
+
+ public:
+  bool push(const T &item) {
+    size_t head = head_.load(std::memory_order_relaxed);
+    size_t next = (head + 1) & (N - 1);
+    if (next == tail_.load(std::memory_order_acquire)) return false;
+    slots_[head] = item;
+    head_.store(next, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T &item) {
+    size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail == head_.load(std::memory_order_acquire)) return false;
+    item = slots_[tail];
+    tail_.store((tail + 1) & (N - 1), std::memory_order_release);
+    return true;
+  }
+
+ private:
+  std::array<T, N> slots_{};
+  std::atomic<size_t> head_{0};
+  std::atomic<size_t> tail_{0};
+};
+
+// ============================================================================
+// Double-Buffered Frame Handoff
+// ============================================================================
+
+/**
+ * @brief Back buffer owned by the renderer, front buffer = strip driver
+ *
+ * The renderer composes into back() only while ready() is false, then
+ * publish()es it. The ESPHome loop copies a ready back buffer into the
+ * strip driver and release()s it. Neither side ever blocks.
+ */
+class FrameHandoff {
+ public:
+  FrameBuffer &back() { return back_; }
+  bool ready() const { return ready_.load(std::memory_order_acquire); }
+  void publish() { ready_.store(true, std::memory_order_release); }
+  void release() { ready_.store(false, std::memory_order_release); }
+
+ private:
+  FrameBuffer back_{};
+  std::atomic<bool> ready_{false};
+};
+
+// ============================================================================
+// Control Latency
+// ============================================================================
+
+/**
+ * @brief Control-to-photon latency of entity changes
+ *
+ * Measures from submit_command() (a light write_state or a number/select/
+ * switch control) to schedule_show() of the first frame rendered after the
+ * change was applied. invalidate() and attach_to_frame() run on the
+ * renderer, frame_shown() on loop(); the frame fields cross threads through
+ * the FrameHandoff publish/ready pair like the pixels do.
+ */
+class ControlLatency {
+ public:
+  /// A change needs a frame; keeps the oldest stamp until one is presented
+  void invalidate(uint32_t issued_us) {
+    if (pending_) return;
+    pending_ = true;
+    pending_us_ = issued_us;
+  }
+
+  /// Tags the frame about to be presented with the pending change, if any
+  void attach_to_frame() {
+    frame_has_change_ = pending_;
+    frame_issued_us_ = pending_us_;
+    pending_ = false;
+  }
+
+  /// Call right after schedule_show(); @return true if a sample was taken
+  bool frame_shown(uint32_t now_us) {
+    if (!frame_has_change_) return false;
+    frame_has_change_ = false;
+    last_us_ = now_us - frame_issued_us_;
+    if (last_us_ > peak_us_) peak_us_ = last_us_;
+    samples_++;
+    return true;
+  }
+
+  uint32_t last_us() const { return last_us_; }
+  uint32_t samples() const { return samples_; }
+  /// Worst latency since the last take_peak_us(), 0 if nothing changed
+  uint32_t take_peak_us() {
+    uint32_t peak = peak_us_;
+    peak_us_ = 0;
+    return peak;
+  }
+
+ protected:
+  bool pending_{false};
+  uint32_t pending_us_{0};
+  bool frame_has_change_{false};
+  uint32_t frame_issued_us_{0};
+  uint32_t last_us_{0};
+  uint32_t peak_us_{0};
+  uint32_t samples_{0};
+};
+
+#ifdef USE_WORDCLOCK_RENDER_TASK
+
+// ============================================================================
+// Render Task (FreeRTOS on ESP32, std::thread on host)
+// ============================================================================
+
+/**
+ * @brief Minimal portable wrapper around the render thread
+ */
+class RenderTask {
+ public:
+  using Body = void (*)(void *arg);
+
+  ~RenderTask() { stop(); }
+
+  /**
+   * @brief Starts the task
+   * @param core Core to pin to on ESP32, -1 for no affinity
+   */
+  bool start(Body body, void *arg, uint32_t stack_size, int priority, int core) {
+    if (running_.load()) return true;
+    running_.store(true);
+#if defined(USE_ESP32)
+    BaseType_t affinity = (core >= 0 && core < portNUM_PROCESSORS) ? core : tskNO_AFFINITY;
+    if (xTaskCreatePinnedToCore(body, "wordclock_render", stack_size, arg, priority, &handle_, affinity) != pdPASS) {
+      running_.store(false);
+      return false;
+    }
+#elif defined(USE_HOST)
+    thread_ = std::thread(body, arg);
+#endif
+    return true;
+  }
+
+  /// Asks the task to exit; joins it on host
+  void stop() {
+    running_.store(false);
+#if defined(USE_HOST)
+    if (thread_.joinable()) thread_.join();
+#endif
+  }
+
+  bool is_running() const { return running_.load(std::memory_order_acquire); }
+
+  static void sleep_ms(uint32_t ms) {
+#if defined(USE_ESP32)
+    vTaskDelay(pdMS_TO_TICKS(ms) > 0 ? pdMS_TO_TICKS(ms) : 1);
+#elif defined(USE_HOST)
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+#endif
+  }
+
+  /// Called by the task body when it returns
+  static void exit_current() {
+#if defined(USE_ESP32)
+    vTaskDelete(nullptr);
+#endif
+  }
+
+ private:
+  std::atomic<bool> running_{false};
+#if defined(USE_ESP32)
+  TaskHandle_t handle_{nullptr};
+#elif defined(USE_HOST)
+  std::thread thread_;
+#endif
+};
+
+#endif  // USE_WORDCLOCK_RENDER_TASK
+
+}  // namespace wordclock
+}  // namespace esphome
@@ -0,0 +1,135 @@
+#pragma once
+
+#include "wordclock_config.h"
+
+#ifdef USE_WORDCLOCK_THROTTLE
+
+#include <atomic>
+#include <cstdint>
+
+namespace esphome {
+namespace wordclock {
+
+// ============================================================================
+// Render Throttle (throttle: in the YAML)
+// ============================================================================
+//
+// While an OTA update runs or the network keeps the ESPHome loop busy, the
+// clock stops animating: only time changes and control changes are drawn,
+// and the frame in between stays up. Effects, fades and the marquee resume
+// from wall-clock time afterwards, so they simply jump ahead.
+//
+// The loop side decides (OTA state callback, loop period); the renderer
+// learns it through CMD_THROTTLE like any other setting. The renderer also
+// reads the OTA flag itself: loop() does not run during a native OTA
+// upload, so CMD_THROTTLE would only arrive once the upload is over.
+
+/**
+ * @brief Busy detection (loop side) and skipped-frame accounting (renderer side)
+ *
+ * "Busy" means an OTA update in progress, or a smoothed loop() period
+ * above busy_loop_ms: API syncs, web server requests and Wi-Fi work all
+ * run between two loop() calls of this component. The throttle is
+ * released hold_ms after the last busy sign.
+ */
+class RenderThrottle {
+ public:
+  void configure(uint32_t busy_loop_ms, uint32_t hold_ms) {
+    busy_loop_ms_ = busy_loop_ms;
+    hold_ms_ = hold_ms;
+  }
+
+  // --- Loop side ---
+
+  /// OTA state callback (may run on the OTA or web server task)
+  void set_ota(bool active) { ota_.store(active, std::memory_order_relaxed); }
+
+  /**
+   * @brief Samples the loop period once per loop()
+   * @return true when the throttle turns on or off
+   */
+  bool update(uint32_t now_ms) {
+    if (sampled_) {
+      // 1/8 smoothing in 1/16 ms: one slow loop is not a burst
+      uint32_t elapsed = now_ms - last_loop_ms_;
+      int32_t period = int32_t(elapsed < 60000 ? elapsed : 60000) * 16;
+      loop_period_q4_ += (period - loop_period_q4_) / 8;
+    }
+    sampled_ = true;
+    last_loop_ms_ = now_ms;
+
+    bool busy_now = ota_.load(std::memory_order_relaxed) || (busy_loop_ms_ > 0 && loop_period_ms() > busy_loop_ms_);
+    if (busy_now) last_busy_ms_ = now_ms;
+    bool throttled = busy_now || (throttled_ && now_ms - last_busy_ms_ < hold_ms_);
+    if (throttled == throttled_) return false;
+
+    throttled_ = throttled;
+    if (throttled) {
+      since_ms_ = now_ms;
+      episodes_++;
+    } else {
+      last_episode_ms_ = now_ms - since_ms_;
+      throttled_ms_ += last_episode_ms_;
+    }
+    return true;
+  }
+
+  bool throttled() const { return throttled_; }
+  uint32_t loop_period_ms() const { return uint32_t(loop_period_q4_ / 16); }
+  uint32_t episodes() const { return episodes_; }
+  uint32_t last_episode_ms() const { return last_episode_ms_; }
+  /// Total time spent throttled, including the current episode
+  uint32_t throttled_ms(uint32_t now_ms) const { return throttled_ms_ + (throttled_ ? now_ms - since_ms_ : 0); }
+
+  // --- Renderer side ---
+
+  void set_active(bool active) { active_ = active; }
+  bool active() const { return active_; }
+  /// OTA update in progress, straight from the state callback
+  bool ota() const { return ota_.load(std::memory_order_relaxed); }
+
+  /// Cost of a composed frame (1/8 smoothing)
+  void record_frame_us(uint32_t us) {
+    int32_t cost = int32_t(us < 100000 ? us : 100000) * 16;
+    frame_q4_ += (cost - frame_q4_) / 8;
+  }
+  /// A frame the adaptive FPS wanted but the throttle skipped
+  void skip_frame() {
+    frames_skipped_.fetch_add(1, std::memory_order_relaxed);
+    saved_us_ += uint32_t(frame_q4_ / 16);
+    if (saved_us_ >= 1000) {
+      saved_ms_.fetch_add(saved_us_ / 1000, std::memory_order_relaxed);
+      saved_us_ %= 1000;
+    }
+  }
+
+  uint32_t frames_skipped() const { return frames_skipped_.load(std::memory_order_relaxed); }
+  /// Estimated render time saved (skipped frames x average frame cost)
+  uint32_t saved_ms() const { return saved_ms_.load(std::memory_order_relaxed); }
+
+ protected:
+  uint32_t busy_loop_ms_{config::THROTTLE_DEFAULT_BUSY_LOOP_MS};
+  uint32_t hold_ms_{config::THROTTLE_DEFAULT_HOLD_MS};
+
+  std::atomic<bool> ota_{false};
+  bool sampled_{false};
+  uint32_t last_loop_ms_{0};
+  int32_t loop_period_q4_{0};  ///< Smoothed loop() period in 1/16 ms
+  uint32_t last_busy_ms_{0};
+  bool throttled_{false};
+  uint32_t since_ms_{0};
+  uint32_t episodes_{0};
+  uint32_t last_episode_ms_{0};
+  uint32_t throttled_ms_{0};
+
+  bool active_{false};
+  int32_t frame_q4_{0};   ///< Smoothed frame cost in 1/16 us
+  uint32_t saved_us_{0};  ///< Below one ms, not yet in saved_ms_
+  std::atomic<uint32_t> frames_skipped_{0};
+  std::atomic<uint32_t> saved_ms_{0};
+};
+
+}  // namespace wordclock
+}  // namespace esphome
+
+#endif  // USE_WORDCLOCK_THROTTLE
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "wordclock_config.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace wordclock {
+
+enum SecondsMode {
+  SECONDS_CURRENT = 0,
+  SECONDS_PASSED = 1,
+  SECONDS_INVERTED = 2,
+  SECONDS_SWEEP = 3
+};
+
+/// Number of SecondsMode values (select options, golden frames)
+static constexpr int SECONDS_MODE_COUNT = 4;
+
+// ============================================================================
+// Precomputed Ring Masks
+// ============================================================================
+
+/// Bit s set = ring LED of second s is lit (bits 0 and 30 are the gaps)
+using SecondsMask = uint64_t;
+
+/// All ring seconds (1-59 without the gap)
+static constexpr SecondsMask SECONDS_RING_ALL =
+    ((1ULL << 60) - 2) & ~(1ULL << config::SECONDS_RING_GAP);
+
+/**
+ * @brief Lit ring seconds for a mode at a given second
+ *
+ * Same rules as the former per-second loops of compute_seconds_leds():
+ * nothing is shown at the gaps except the full first half (PASSED at 30)
+ * and the full ring (INVERTED at 0 and 30).
+ */
+constexpr SecondsMask seconds_mode_mask(int mode, int second) {
+  bool gap = (second == 0 || second == config::SECONDS_RING_GAP);
+  switch (mode) {
+    case SECONDS_PASSED:
+      if (second == 0) return 0;
+      return ((1ULL << (second + 1)) - 2) & SECONDS_RING_ALL;
+    case SECONDS_INVERTED:
+      return gap ? SECONDS_RING_ALL : (SECONDS_RING_ALL & ~(1ULL << second));
+    case SECONDS_CURRENT:
+    case SECONDS_SWEEP:
+    default:
+      return gap ? 0 : (1ULL << second);
+  }
+}
+
+using SecondsMaskTable = std::array<std::array<SecondsMask, 60>, SECONDS_MODE_COUNT>;
+
+constexpr SecondsMaskTable make_seconds_mask_table() {
+  SecondsMaskTable table{};
+  for (int mode = 0; mode < SECONDS_MODE_COUNT; mode++) {
+    for (int second = 0; second < 60; second++) {
+      table[mode][second] = seconds_mode_mask(mode, second);
+    }
+  }
+  return table;
+}
+
+/// Mode x second -> lit ring seconds, built at compile time
+static constexpr SecondsMaskTable SECONDS_MASKS = make_seconds_mask_table();
+
+// ============================================================================
+// Seconds Ring Trail
+// ============================================================================
+
+/// Resolution of the trail decay table
+static constexpr int SECONDS_DECAY_LUT_SIZE = 256;
+
+/**
+ * @brief Builds the trail decay table at compile time
+ *
+ * Entry i is the hand brightness (0-255) left at normalized age
+ * i / (SIZE - 1) of the fade, eased like blend_colors().
+ */
+constexpr std::array<uint8_t, SECONDS_DECAY_LUT_SIZE> make_seconds_decay_lut() {
+  std::array<uint8_t, SECONDS_DECAY_LUT_SIZE> lut{};
+  for (int i = 0; i < SECONDS_DECAY_LUT_SIZE; i++) {
+    float x = float(i) / float(SECONDS_DECAY_LUT_SIZE - 1);
+    float eased = x * x * (3.0f - 2.0f * x);
+    lut[i] = uint8_t((1.0f - eased) * 255.0f + 0.5f);
+  }
+  return lut;
+}
+
+static constexpr auto SECONDS_DECAY_LUT = make_seconds_decay_lut();
+
+/**
+ * @brief Trail brightness for a given age
+ * @param age Seconds since the hand left the LED
+ * @param fade_duration Seconds fade-out duration
+ * @return Brightness 0-255 (0 once the fade is over)
+ */
+inline uint8_t seconds_trail_level(float age, float fade_duration) {
+  if (age < 0.0f || fade_duration <= 0.0f || age >= fade_duration) return 0;
+  int index = int(age / fade_duration * (SECONDS_DECAY_LUT_SIZE - 1));
+  return SECONDS_DECAY_LUT[index];
+}
+
+// ============================================================================
+// Seconds Ring Engine
+// ============================================================================
+
+/**
+ * @brief Ring LED lookup and whole-second trail table
+ *
+ * Holds the strip LED of each second (from the language's ring mapping)
+ * and the eased blend progress of the trail for each whole-second age,
+ * rebuilt only when the fade duration changes.
+ */
+class SecondsRing {
+ public:
+  /// Copies the first LED of each second; gaps map to -1
+  void set_leds(const std::array<std::vector<int>, 60> &ring) {
+    for (int s = 0; s < 60; s++) {
+      leds_[s] = ring[s].empty() ? -1 : ring[s][0];
+    }
+  }
+
+  /// Strip LED of a ring second, -1 for the gaps
+  int led(int second) const { return (second >= 0 && second < 60) ? leds_[second] : -1; }
+
+  static SecondsMask mask(int mode, int second) {
+    if (mode < 0 || mode >= SECONDS_MODE_COUNT || second < 0 || second >= 60) return 0;
+    return SECONDS_MASKS[mode][second];
+  }
+
+  /**
+   * @brief Eased progress toward the background for each age in seconds
+   *
+   * Entry age (1-59) holds blend_colors()'s eased progress for
+   * age / fade_duration, or a negative value once the fade is over.
+   */
+  const std::array<float, 60> &trail_progress(float fade_duration) {
+    if (fade_duration != trail_duration_) {
+      trail_duration_ = fade_duration;
+      for (int age = 0; age < 60; age++) {
+        float progress = fade_duration > 0.0f ? (float) age / fade_duration : 1.0f;
+        trail_[age] = progress < 1.0f ? progress * progress * (3.0f - 2.0f * progress) : -1.0f;
+      }
+    }
+    return trail_;
+  }
+
+ protected:
+  std::array<int16_t, 60> leds_{};
+  std::array<float, 60> trail_{};
+  float trail_duration_{-1.0f};
+};
+
+}  // namespace wordclock
+}  // namespace esphome
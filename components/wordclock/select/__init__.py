@@ -3,17 +3,28 @@ import esphome.config_validation as cv
 from esphome.components import select
 from esphome.const import CONF_ID
 
-from .. import wordclock_ns, WordClock, CONF_WORDCLOCK_ID
+from .. import (
+    wordclock_ns,
+    WordClock,
+    CONF_WORDCLOCK_ID,
+    get_wordclock_config,
+    language_options,
+    effect_options,
+    LightType,
+    RenderCommandType,
+)
 
 WordClockSecondsSelect = wordclock_ns.class_("WordClockSecondsSelect", select.Select, cg.Component)
 WordClockEffectSelect = wordclock_ns.class_("WordClockEffectSelect", select.Select, cg.Component)
 WordClockLanguageSelect = wordclock_ns.class_("WordClockLanguageSelect", select.Select, cg.Component)
 
-LightType = wordclock_ns.enum("LightType")
-
+# "words" drives the hours and minutes layers without their own select
 EFFECT_LIGHT_TYPES = {
     "words": LightType.LIGHT_WORDS,
+    "hours": LightType.LIGHT_HOURS,
+    "minutes": LightType.LIGHT_MINUTES,
     "seconds": LightType.LIGHT_SECONDS,
+    "background": LightType.LIGHT_BACKGROUND,
 }
 
 CONF_LIGHT_TYPE = "light_type"
@@ -44,29 +55,36 @@ def CONFIG_SCHEMA(config):
 
 async def to_code(config):
     select_type = config.get(CONF_SELECT_TYPE)
+    wordclock_config = get_wordclock_config(config[CONF_WORDCLOCK_ID])
     
     if select_type == SELECT_TYPE_LANGUAGE:
         # Language selector
         var = cg.new_Pvariable(config[CONF_ID])
-        # Options: French first (default), then English UK
-        await select.register_select(var, config, options=["Francais", "English UK"])
+        # Options: compiled-in languages, default language first
+        options = language_options(wordclock_config)
+        await select.register_select(var, config, options=[name for name, _ in options])
         await cg.register_component(var, config)
+        cg.add(var.set_option_values([value for _, value in options]))
         parent = await cg.get_variable(config[CONF_WORDCLOCK_ID])
         cg.add(var.set_wordclock(parent))
         cg.add(parent.register_language_select(var))
     elif CONF_LIGHT_TYPE in config:
         # Effect selector
         var = cg.new_Pvariable(config[CONF_ID])
-        await select.register_select(var, config, options=["None", "Rainbow", "Pulse", "Breathe", "Color cycle"])
+        # Options: "None" plus the compiled-in effects
+        options = effect_options(wordclock_config)
+        await select.register_select(var, config, options=[name for name, _ in options])
         await cg.register_component(var, config)
+        cg.add(var.set_option_values([value for _, value in options]))
         parent = await cg.get_variable(config[CONF_WORDCLOCK_ID])
         cg.add(var.set_wordclock(parent))
         cg.add(var.set_light_type(config[CONF_LIGHT_TYPE]))
         cg.add(parent.register_effect_select(var, config[CONF_LIGHT_TYPE]))
+        cg.add(parent.add_layer_control(RenderCommandType.CMD_LAYER_EFFECT, config[CONF_LIGHT_TYPE]))
     else:
         # Seconds mode selector
         var = cg.new_Pvariable(config[CONF_ID])
-        await select.register_select(var, config, options=["Current second", "Seconds passed", "Inverted"])
+        await select.register_select(var, config, options=["Current second", "Seconds passed", "Inverted", "Sweep"])
         await cg.register_component(var, config)
         parent = await cg.get_variable(config[CONF_WORDCLOCK_ID])
         cg.add(var.set_wordclock(parent))
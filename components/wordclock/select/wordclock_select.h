@@ -3,6 +3,7 @@
 #include "esphome/core/component.h"
 #include "esphome/components/select/select.h"
 #include "../wordclock.h"
+#include <vector>
 
 namespace esphome {
 namespace wordclock {
@@ -38,77 +39,101 @@ class WordClockSecondsSelect : public select::Select, public Component {
   ESPPreferenceObject pref_;
 };
 
-class WordClockEffectSelect : public select::Select, public Component {
+/**
+ * @brief Select whose options map to enum values
+ *
+ * Options can be filtered at compile time (effects:, languages:), so the
+ * option index is not the enum value: set_option_values() gives the value
+ * of each option. The stored preference is the value, not the index.
+ */
+class WordClockOptionSelect : public select::Select, public Component {
  public:
-  void setup() override {
-    int index = 1;  // Default: Rainbow
+  void set_wordclock(WordClock *wordclock) { wordclock_ = wordclock; }
+  void set_option_values(const std::vector<int> &values) { option_values_ = values; }
+
+  /// Selects the option of a value (first option if it is not compiled in)
+  void reset_to_value(int value) {
+    const auto &options = this->traits.get_options();
+    int index = index_of(value);
+    if (index < 0) index = 0;
+    if (index < (int)options.size()) {
+      auto call = this->make_call();
+      call.set_option(options[index]);
+      call.perform();
+    }
+  }
+
+ protected:
+  virtual void apply_value(int value) = 0;
+
+  void restore(int default_value) {
+    int value = default_value;
     this->pref_ = global_preferences->make_preference<int>(this->get_object_id_hash());
-    this->pref_.load(&index);
-    apply_effect(index);
+    this->pref_.load(&value);
+    int index = index_of(value);
+    if (index < 0) {
+      index = 0;
+      value = value_of(0);
+    }
+    apply_value(value);
     const auto &options = this->traits.get_options();
-    if (index >= 0 && index < (int)options.size()) {
+    if (index < (int)options.size()) {
       this->publish_state(options[index]);
     }
   }
 
-  void set_wordclock(WordClock *wordclock) { wordclock_ = wordclock; }
-  void set_light_type(LightType type) { light_type_ = type; }
-
- protected:
   void control(const std::string &value) override {
     const auto &options = this->traits.get_options();
     int index = 0;
     for (size_t i = 0; i < options.size(); i++) {
       if (options[i] == value) { index = i; break; }
     }
-    apply_effect(index);
-    this->pref_.save(&index);
+    int option_value = value_of(index);
+    apply_value(option_value);
+    this->pref_.save(&option_value);
     this->publish_state(value);
   }
 
-  void apply_effect(int index) {
-    if (!wordclock_) return;
-    switch (light_type_) {
-      case LIGHT_WORDS: wordclock_->set_words_effect(index); break;
-      case LIGHT_SECONDS: wordclock_->set_seconds_effect(index); break;
-      default: break;
+  int value_of(int index) const {
+    return index < (int)option_values_.size() ? option_values_[index] : index;
+  }
+
+  int index_of(int value) const {
+    if (option_values_.empty()) return value;
+    for (size_t i = 0; i < option_values_.size(); i++) {
+      if (option_values_[i] == value) return i;
     }
+    return -1;
   }
 
   WordClock *wordclock_{nullptr};
-  LightType light_type_{LIGHT_WORDS};
+  std::vector<int> option_values_;
   ESPPreferenceObject pref_;
 };
 
-class WordClockLanguageSelect : public select::Select, public Component {
+class WordClockEffectSelect : public WordClockOptionSelect {
  public:
-  void setup() override {
-    int index = 0;  // Default: French (LANG_FRENCH = 0)
-    this->pref_ = global_preferences->make_preference<int>(this->get_object_id_hash());
-    this->pref_.load(&index);
-    if (wordclock_) wordclock_->set_language(index);
-    const auto &options = this->traits.get_options();
-    if (index >= 0 && index < (int)options.size()) {
-      this->publish_state(options[index]);
-    }
-  }
+  // The background layer starts without effect, the others with the rainbow
+  void setup() override { restore(light_type_ == LIGHT_BACKGROUND ? EFFECT_NONE : EFFECT_RAINBOW); }
 
-  void set_wordclock(WordClock *wordclock) { wordclock_ = wordclock; }
+  void set_light_type(LightType type) { light_type_ = type; }
 
  protected:
-  void control(const std::string &value) override {
-    const auto &options = this->traits.get_options();
-    int index = 0;
-    for (size_t i = 0; i < options.size(); i++) {
-      if (options[i] == value) { index = i; break; }
-    }
-    if (wordclock_) wordclock_->set_language(index);
-    this->pref_.save(&index);
-    this->publish_state(value);
+  void apply_value(int effect) override {
+    if (wordclock_) wordclock_->set_layer_effect(light_type_, effect);
   }
 
-  WordClock *wordclock_{nullptr};
-  ESPPreferenceObject pref_;
+  LightType light_type_{LIGHT_WORDS};
+};
+
+class WordClockLanguageSelect : public WordClockOptionSelect {
+ public:
+  void setup() override { restore(wordclock_ ? wordclock_->get_default_language() : LANG_FRENCH); }
+
+ protected:
+  void apply_value(int lang) override {
+    if (wordclock_) wordclock_->set_language(lang);
+  }
 };
 
 }  // namespace wordclock
@@ -0,0 +1,147 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+import esphome.final_validate as fv
+from esphome.components import sensor
+from esphome.const import (
+    CONF_ID,
+    DEVICE_CLASS_DURATION,
+    STATE_CLASS_MEASUREMENT,
+    STATE_CLASS_TOTAL_INCREASING,
+    UNIT_MILLISECOND,
+    UNIT_SECOND,
+)
+
+from .. import (
+    wordclock_ns,
+    WordClock,
+    CONF_WORDCLOCK_ID,
+    CONF_ALLOC_AUDIT,
+    CONF_THROTTLE,
+    CONF_UDP_INPUT,
+)
+
+WordClockSensor = wordclock_ns.class_("WordClockSensor", cg.PollingComponent)
+
+CONF_CONTROL_LATENCY = "control_latency"
+CONF_LOOP_ALLOCATIONS = "loop_allocations"
+CONF_STEADY_ALLOCATIONS = "steady_allocations"
+CONF_INPUT_PACKET_RATE = "input_packet_rate"
+CONF_INPUT_FRAME_RATE = "input_frame_rate"
+CONF_INPUT_DROPPED = "input_dropped"
+CONF_INPUT_LATE_PACKETS = "input_late_packets"
+CONF_INPUT_LATENCY = "input_latency"
+CONF_THROTTLED_TIME = "throttled_time"
+CONF_RENDER_TIME_SAVED = "render_time_saved"
+
+ALLOCATION_SENSORS = (CONF_LOOP_ALLOCATIONS, CONF_STEADY_ALLOCATIONS)
+INPUT_SENSORS = (
+    CONF_INPUT_PACKET_RATE,
+    CONF_INPUT_FRAME_RATE,
+    CONF_INPUT_DROPPED,
+    CONF_INPUT_LATE_PACKETS,
+    CONF_INPUT_LATENCY,
+)
+THROTTLE_SENSORS = (CONF_THROTTLED_TIME, CONF_RENDER_TIME_SAVED)
+
+# Option -> setter on WordClockSensor
+SENSOR_SETTERS = {
+    CONF_CONTROL_LATENCY: "set_latency_sensor",
+    CONF_LOOP_ALLOCATIONS: "set_loop_sensor",
+    CONF_STEADY_ALLOCATIONS: "set_steady_sensor",
+    CONF_INPUT_PACKET_RATE: "set_input_packet_rate_sensor",
+    CONF_INPUT_FRAME_RATE: "set_input_frame_rate_sensor",
+    CONF_INPUT_DROPPED: "set_input_dropped_sensor",
+    CONF_INPUT_LATE_PACKETS: "set_input_late_sensor",
+    CONF_INPUT_LATENCY: "set_input_latency_sensor",
+    CONF_THROTTLED_TIME: "set_throttled_time_sensor",
+    CONF_RENDER_TIME_SAVED: "set_render_saved_sensor",
+}
+
+CONFIG_SCHEMA = cv.Schema({
+    cv.GenerateID(): cv.declare_id(WordClockSensor),
+    cv.Required(CONF_WORDCLOCK_ID): cv.use_id(WordClock),
+    # Worst entity change -> schedule_show() delay since the previous update
+    cv.Optional(CONF_CONTROL_LATENCY): sensor.sensor_schema(
+        unit_of_measurement=UNIT_MILLISECOND,
+        device_class=DEVICE_CLASS_DURATION,
+        accuracy_decimals=1,
+        state_class=STATE_CLASS_MEASUREMENT,
+    ),
+    # Largest single loop() since the previous update
+    cv.Optional(CONF_LOOP_ALLOCATIONS): sensor.sensor_schema(
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_MEASUREMENT,
+    ),
+    # Allocations after warm-up; anything but 0 is a render-path regression
+    cv.Optional(CONF_STEADY_ALLOCATIONS): sensor.sensor_schema(
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_TOTAL_INCREASING,
+    ),
+    # UDP input throughput since the previous update
+    cv.Optional(CONF_INPUT_PACKET_RATE): sensor.sensor_schema(
+        unit_of_measurement="packets/s",
+        accuracy_decimals=1,
+        state_class=STATE_CLASS_MEASUREMENT,
+    ),
+    cv.Optional(CONF_INPUT_FRAME_RATE): sensor.sensor_schema(
+        unit_of_measurement="fps",
+        accuracy_decimals=1,
+        state_class=STATE_CLASS_MEASUREMENT,
+    ),
+    # Malformed/foreign packets plus frames superseded before being shown
+    cv.Optional(CONF_INPUT_DROPPED): sensor.sensor_schema(
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_TOTAL_INCREASING,
+    ),
+    cv.Optional(CONF_INPUT_LATE_PACKETS): sensor.sensor_schema(
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_TOTAL_INCREASING,
+    ),
+    # Worst first packet read -> schedule_show() since the previous update
+    cv.Optional(CONF_INPUT_LATENCY): sensor.sensor_schema(
+        unit_of_measurement=UNIT_MILLISECOND,
+        device_class=DEVICE_CLASS_DURATION,
+        accuracy_decimals=2,
+        state_class=STATE_CLASS_MEASUREMENT,
+    ),
+    # Time spent with animations paused for OTA or network bursts
+    cv.Optional(CONF_THROTTLED_TIME): sensor.sensor_schema(
+        unit_of_measurement=UNIT_SECOND,
+        device_class=DEVICE_CLASS_DURATION,
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_TOTAL_INCREASING,
+    ),
+    # Estimated render time not spent while throttled
+    cv.Optional(CONF_RENDER_TIME_SAVED): sensor.sensor_schema(
+        unit_of_measurement=UNIT_MILLISECOND,
+        device_class=DEVICE_CLASS_DURATION,
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_TOTAL_INCREASING,
+    ),
+}).extend(cv.polling_component_schema("60s"))
+
+
+def _final_validate(config):
+    for conf in fv.full_config.get().get("wordclock", []):
+        if conf[CONF_ID] != config[CONF_WORDCLOCK_ID]:
+            continue
+        if any(key in config for key in ALLOCATION_SENSORS) and not conf[CONF_ALLOC_AUDIT]:
+            raise cv.Invalid(f"Allocation sensors need {CONF_ALLOC_AUDIT}: true on the wordclock")
+        if any(key in config for key in INPUT_SENSORS) and CONF_UDP_INPUT not in conf:
+            raise cv.Invalid(f"Input sensors need {CONF_UDP_INPUT}: on the wordclock")
+        if any(key in config for key in THROTTLE_SENSORS) and CONF_THROTTLE not in conf:
+            raise cv.Invalid(f"Throttle sensors need {CONF_THROTTLE}: on the wordclock")
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    parent = await cg.get_variable(config[CONF_WORDCLOCK_ID])
+    cg.add(var.set_wordclock(parent))
+    for key, setter in SENSOR_SETTERS.items():
+        if key in config:
+            sens = await sensor.new_sensor(config[key])
+            cg.add(getattr(var, setter)(sens))
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/components/sensor/sensor.h"
+#include "../wordclock.h"
+
+namespace esphome {
+namespace wordclock {
+
+/// Publishes render diagnostics: control latency, UDP input, throttling and allocation audit counters
+class WordClockSensor : public PollingComponent {
+ public:
+  void set_wordclock(WordClock *wordclock) { wordclock_ = wordclock; }
+  void set_latency_sensor(sensor::Sensor *sensor) { latency_sensor_ = sensor; }
+  void set_loop_sensor(sensor::Sensor *sensor) { loop_sensor_ = sensor; }
+  void set_steady_sensor(sensor::Sensor *sensor) { steady_sensor_ = sensor; }
+  void set_input_packet_rate_sensor(sensor::Sensor *sensor) { input_packet_rate_sensor_ = sensor; }
+  void set_input_frame_rate_sensor(sensor::Sensor *sensor) { input_frame_rate_sensor_ = sensor; }
+  void set_input_dropped_sensor(sensor::Sensor *sensor) { input_dropped_sensor_ = sensor; }
+  void set_input_late_sensor(sensor::Sensor *sensor) { input_late_sensor_ = sensor; }
+  void set_input_latency_sensor(sensor::Sensor *sensor) { input_latency_sensor_ = sensor; }
+  void set_throttled_time_sensor(sensor::Sensor *sensor) { throttled_time_sensor_ = sensor; }
+  void set_render_saved_sensor(sensor::Sensor *sensor) { render_saved_sensor_ = sensor; }
+
+  void update() override {
+    if (!wordclock_) return;
+    auto &latency = wordclock_->get_control_latency();
+    if (latency_sensor_ && latency.samples() != latency_samples_) {
+      // Only publish when a change was shown since the previous update
+      latency_samples_ = latency.samples();
+      latency_sensor_->publish_state(latency.take_peak_us() / 1000.0f);
+    }
+#ifdef USE_WORDCLOCK_UDP_INPUT
+    update_udp_input_();
+#endif
+#ifdef USE_WORDCLOCK_THROTTLE
+    auto &throttle = wordclock_->get_throttle();
+    if (throttled_time_sensor_) throttled_time_sensor_->publish_state(throttle.throttled_ms(millis()) / 1000);
+    if (render_saved_sensor_) render_saved_sensor_->publish_state(throttle.saved_ms());
+#endif
+#ifdef USE_WORDCLOCK_ALLOC_AUDIT
+    auto &audit = wordclock_->get_alloc_audit();
+    if (loop_sensor_) loop_sensor_->publish_state(audit.take_peak());
+    if (steady_sensor_) steady_sensor_->publish_state(audit.steady_total());
+#endif
+  }
+
+ protected:
+#ifdef USE_WORDCLOCK_UDP_INPUT
+  void update_udp_input_() {
+    auto &input = wordclock_->get_udp_input();
+    const auto &stats = input.stats();
+    uint32_t now = millis();
+    // Rates cover the time since the previous update
+    if (last_update_ms_ != 0 && now != last_update_ms_) {
+      float seconds = (now - last_update_ms_) / 1000.0f;
+      if (input_packet_rate_sensor_)
+        input_packet_rate_sensor_->publish_state((stats.packets - last_packets_) / seconds);
+      if (input_frame_rate_sensor_)
+        input_frame_rate_sensor_->publish_state((stats.frames_shown - last_frames_) / seconds);
+    }
+    last_update_ms_ = now;
+    last_packets_ = stats.packets;
+    last_frames_ = stats.frames_shown;
+    if (input_dropped_sensor_) input_dropped_sensor_->publish_state(stats.dropped_packets + stats.dropped_frames);
+    if (input_late_sensor_) input_late_sensor_->publish_state(stats.late_packets);
+    if (input_latency_sensor_) input_latency_sensor_->publish_state(input.take_peak_latency_us() / 1000.0f);
+  }
+#endif
+
+  WordClock *wordclock_{nullptr};
+  sensor::Sensor *latency_sensor_{nullptr};
+  sensor::Sensor *loop_sensor_{nullptr};
+  sensor::Sensor *steady_sensor_{nullptr};
+  sensor::Sensor *input_packet_rate_sensor_{nullptr};
+  sensor::Sensor *input_frame_rate_sensor_{nullptr};
+  sensor::Sensor *input_dropped_sensor_{nullptr};
+  sensor::Sensor *input_late_sensor_{nullptr};
+  sensor::Sensor *input_latency_sensor_{nullptr};
+  sensor::Sensor *throttled_time_sensor_{nullptr};
+  sensor::Sensor *render_saved_sensor_{nullptr};
+  uint32_t latency_samples_{0};
+  uint32_t last_update_ms_{0};
+  uint32_t last_packets_{0};
+  uint32_t last_frames_{0};
+};
+
+}  // namespace wordclock
+}  // namespace esphome
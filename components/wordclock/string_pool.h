@@ -14,17 +14,16 @@ namespace wordclock {
  * Words are stored only once in the pool.
  * Maps use size_t indices instead of strings.
  * Estimated savings: ~35-40KB RAM.
+ *
+ * Owned by each WordClock: indices are only meaningful for the maps
+ * of the instance that interned them.
  */
 class StringPool {
  public:
-  /**
-   * @brief Singleton instance
-   */
-  static StringPool& instance() {
-    static StringPool pool;
-    return pool;
-  }
-  
+  StringPool() = default;
+  StringPool(const StringPool&) = delete;
+  StringPool& operator=(const StringPool&) = delete;
+
   /**
    * @brief Interns a string and returns its index
    * @param str String to intern
@@ -69,10 +68,6 @@ class StringPool {
   size_t size() const { return pool_.size(); }
   
  private:
-  StringPool() = default;
-  StringPool(const StringPool&) = delete;
-  StringPool& operator=(const StringPool&) = delete;
-  
   std::vector<std::string> pool_;
   std::unordered_map<std::string, size_t> index_;
 };
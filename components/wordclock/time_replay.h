@@ -0,0 +1,184 @@
+#pragma once
+
+#include "wordclock.h"
+#include "esphome/core/hal.h"
+#include <atomic>
+#include <ctime>
+#include <functional>
+
+namespace esphome {
+namespace wordclock {
+
+/**
+ * @brief Fake clock driven by TimeReplay
+ *
+ * Holds a simulated epoch and a simulated millis() counter that only move
+ * when the replay driver advances them. The millis counter can start
+ * anywhere, e.g. just below 2^32 to exercise overflow handling. The
+ * driver thread advances it while a render task may read it: the clocks
+ * are atomic, the remainder belongs to the driver.
+ */
+class ReplayTimeSource : public TimeSource {
+ public:
+  void set_epoch(time_t epoch) {
+    epoch_remainder_ms_ = 0;
+    epoch_.store(epoch);
+  }
+  void set_millis(uint32_t ms) { millis_.store(ms); }
+
+  /// Advance both clocks; millis wraps like the hardware counter
+  void advance(uint32_t ms) {
+    millis_.fetch_add(ms);
+    epoch_remainder_ms_ += ms;
+    epoch_.fetch_add(time_t(epoch_remainder_ms_ / 1000));
+    epoch_remainder_ms_ %= 1000;
+  }
+
+  /// Shifts the epoch only, like an SNTP correction of a drifting RTC
+  void correct(int32_t ms) {
+    int64_t total = (int64_t) epoch_.load() * 1000 + epoch_remainder_ms_ + ms;
+    epoch_remainder_ms_ = uint32_t(total % 1000);
+    epoch_.store(time_t(total / 1000));
+  }
+
+  time_t get_epoch() const { return epoch_.load(); }
+
+  uint32_t get_millis() override { return millis_.load(); }
+  ESPTime get_time() override { return ESPTime::from_epoch_local(epoch_.load()); }
+
+ protected:
+  std::atomic<time_t> epoch_{0};
+  uint32_t epoch_remainder_ms_{0};  ///< Driver thread only
+  std::atomic<uint32_t> millis_{0};
+};
+
+/**
+ * @brief Statistics collected during a replay run
+ */
+struct ReplayStats {
+  uint32_t frames{0};                 ///< loop() calls executed
+  uint32_t ticks{0};                  ///< Simulated seconds elapsed
+  uint64_t total_frame_us{0};         ///< Sum of per-frame CPU time
+  uint32_t max_frame_us{0};           ///< Worst single frame
+  uint32_t checksum{2166136261UL};    ///< Hash of the whole frame checksum stream
+  size_t max_led_fades{0};            ///< Peak led_fades_ size
+  size_t max_seconds_fades{0};        ///< Peak seconds_fades_ size
+  size_t max_typing_leds{0};          ///< Peak typing_in_leds_ size
+  bool millis_wrapped{false};         ///< Simulated millis() crossed 2^32
+  uint32_t control_changes{0};        ///< Control changes that reached the strip
+  uint32_t max_control_latency_us{0}; ///< Worst submit_command() -> schedule_show()
+#ifdef USE_WORDCLOCK_ALLOC_AUDIT
+  uint32_t max_loop_allocations{0};   ///< Worst single loop() (any phase)
+  uint32_t steady_allocations{0};     ///< Allocations after warm-up (expected 0)
+  uint32_t steady_loops{0};           ///< loop() calls after warm-up
+#endif
+
+  float average_frame_us() const { return frames > 0 ? (float) total_frame_us / frames : 0.0f; }
+};
+
+/**
+ * @brief Deterministic accelerated replay of WordClock::loop()
+ *
+ * Drives the component with a ReplayTimeSource at a fixed simulated frame
+ * interval, either as fast as possible or at a given speed-up factor.
+ * Intended for the ESPHome host platform:
+ *
+ *   ReplayTimeSource source;
+ *   TimeReplay replay(clock, &source);
+ *   replay.start(1711846800, UINT32_MAX - 60000);  // wrap millis after 1 min
+ *   const auto &stats = replay.run(86400);          // one simulated day
+ *
+ * With alloc_audit enabled, stats.steady_allocations must stay 0: the
+ * display path may not touch the heap once warmed up.
+ */
+class TimeReplay {
+ public:
+  using FrameCallback = std::function<void(uint32_t frame, uint32_t checksum)>;
+
+  TimeReplay(WordClock *clock, ReplayTimeSource *source) : clock_(clock), source_(source) {}
+
+  /// Simulated/real time ratio (e.g. 1000), 0 = as fast as possible
+  void set_speed(float speed) { speed_ = speed; }
+  void set_frame_interval_ms(uint32_t ms) { frame_ms_ = ms > 0 ? ms : 1; }
+  /// Receives the per-frame checksum stream
+  void set_frame_callback(FrameCallback callback) { frame_callback_ = std::move(callback); }
+
+  void start(time_t epoch, uint32_t start_millis = 0) {
+    source_->set_epoch(epoch);
+    source_->set_millis(start_millis);
+    clock_->set_time_source(source_);
+    stats_ = ReplayStats();
+  }
+
+  /// Runs duration_s simulated seconds; may be called repeatedly
+  const ReplayStats &run(uint32_t duration_s) {
+    const uint64_t total_ms = (uint64_t) duration_s * 1000;
+    const uint32_t frame_wall_us = speed_ > 0 ? (uint32_t) (frame_ms_ * 1000.0f / speed_) : 0;
+
+    for (uint64_t elapsed_ms = 0; elapsed_ms < total_ms; elapsed_ms += frame_ms_) {
+      uint32_t frame_start_us = micros();
+      clock_->loop();
+      uint32_t frame_us = micros() - frame_start_us;
+      record_frame_(frame_us);
+
+      uint32_t prev_millis = source_->get_millis();
+      time_t prev_epoch = source_->get_epoch();
+      source_->advance(frame_ms_);
+      if (source_->get_millis() < prev_millis) stats_.millis_wrapped = true;
+      stats_.ticks += (uint32_t) (source_->get_epoch() - prev_epoch);
+
+      if (frame_wall_us > frame_us) {
+        delayMicroseconds(frame_wall_us - frame_us);
+      }
+    }
+    return stats_;
+  }
+
+  const ReplayStats &get_stats() const { return stats_; }
+
+ protected:
+  void record_frame_(uint32_t frame_us) {
+    stats_.frames++;
+    stats_.total_frame_us += frame_us;
+    if (frame_us > stats_.max_frame_us) stats_.max_frame_us = frame_us;
+
+    uint32_t checksum = clock_->frame_checksum();
+    for (int i = 0; i < 4; i++) {
+      stats_.checksum ^= (checksum >> (i * 8)) & 0xFF;
+      stats_.checksum *= 16777619UL;
+    }
+    if (frame_callback_) frame_callback_(stats_.frames, checksum);
+
+    if (clock_->get_led_fade_count() > stats_.max_led_fades)
+      stats_.max_led_fades = clock_->get_led_fade_count();
+    if (clock_->get_seconds_fade_count() > stats_.max_seconds_fades)
+      stats_.max_seconds_fades = clock_->get_seconds_fade_count();
+    if (clock_->get_typing_count() > stats_.max_typing_leds)
+      stats_.max_typing_leds = clock_->get_typing_count();
+
+    const auto &latency = clock_->get_control_latency();
+    if (latency.samples() != stats_.control_changes) {
+      stats_.control_changes = latency.samples();
+      if (latency.last_us() > stats_.max_control_latency_us)
+        stats_.max_control_latency_us = latency.last_us();
+    }
+
+#ifdef USE_WORDCLOCK_ALLOC_AUDIT
+    const auto &audit = clock_->get_alloc_audit();
+    if (audit.last_loop() > stats_.max_loop_allocations)
+      stats_.max_loop_allocations = audit.last_loop();
+    stats_.steady_allocations = audit.steady_total();
+    stats_.steady_loops = audit.steady_loops();
+#endif
+  }
+
+  WordClock *clock_;
+  ReplayTimeSource *source_;
+  float speed_{0.0f};
+  uint32_t frame_ms_{20};
+  FrameCallback frame_callback_;
+  ReplayStats stats_;
+};
+
+}  // namespace wordclock
+}  // namespace esphome
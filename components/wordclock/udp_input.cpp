@@ -0,0 +1,237 @@
+#include "udp_input.h"
+
+#ifdef USE_WORDCLOCK_UDP_INPUT
+
+#include "led_utils.h"
+#include "esphome/core/log.h"
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace wordclock {
+
+static const char *const TAG_UDP = "wordclock.udp";
+
+// DDP header (http://www.3waylabs.com/ddp/)
+static constexpr uint8_t DDP_VERSION_MASK = 0xC0;
+static constexpr uint8_t DDP_VERSION_1 = 0x40;
+static constexpr uint8_t DDP_FLAG_TIMECODE = 0x10;
+static constexpr uint8_t DDP_FLAG_QUERY = 0x02;
+static constexpr uint8_t DDP_FLAG_PUSH = 0x01;
+static constexpr uint8_t DDP_ID_DISPLAY = 1;
+static constexpr size_t DDP_HEADER_SIZE = 10;
+static constexpr size_t DDP_TIMECODE_SIZE = 4;
+
+// E1.31 data packet (ANSI E1.31-2018)
+static constexpr size_t E131_HEADER_SIZE = 126;
+static constexpr uint8_t E131_ACN_ID[12] = {'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0};
+static constexpr uint32_t E131_VECTOR_ROOT_DATA = 0x00000004;
+static constexpr uint32_t E131_VECTOR_FRAME_DATA = 0x00000002;
+static constexpr uint8_t E131_VECTOR_DMP_SET_PROPERTY = 0x02;
+static constexpr uint8_t E131_OPTION_PREVIEW = 0x80;
+static constexpr uint8_t E131_OPTION_TERMINATED = 0x40;
+/// Sequence numbers this far behind the last one are out of order (E1.31 6.7.2)
+static constexpr int E131_SEQUENCE_WINDOW = 20;
+
+static inline uint16_t read_be16(const uint8_t *p) { return uint16_t(p[0] << 8 | p[1]); }
+static inline uint32_t read_be32(const uint8_t *p) {
+  return uint32_t(p[0]) << 24 | uint32_t(p[1]) << 16 | uint32_t(p[2]) << 8 | p[3];
+}
+
+// ============================================================================
+// Setup
+// ============================================================================
+
+bool UdpFrameInput::start(int num_leds) {
+  num_leds_ = std::min<int>(num_leds, MAX_LEDS);
+  for (int pixel = 0; pixel < int(MAX_LEDS); pixel++) {
+    int led = layout_ == UDP_LAYOUT_ROWS ? get_led_index(pixel % 16, pixel / 16) : pixel;
+    pixel_map_[pixel] = is_excluded_led(led, num_leds_) ? UDP_INPUT_NO_LED : uint16_t(led);
+  }
+  e131_universes_ = (num_leds_ + E131_PIXELS_PER_UNIVERSE - 1) / E131_PIXELS_PER_UNIVERSE;
+  e131_sequence_.fill(-1);
+
+  socket_ = socket::socket_ip(SOCK_DGRAM, IPPROTO_IP);
+  if (!socket_) {
+    ESP_LOGE(TAG_UDP, "Could not create UDP socket");
+    return false;
+  }
+  int enable = 1;
+  socket_->setsockopt(SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+  socket_->setblocking(false);
+
+  struct sockaddr_storage addr;
+  socklen_t addr_len = socket::set_sockaddr_any((struct sockaddr *) &addr, sizeof(addr), port_);
+  if (socket_->bind((struct sockaddr *) &addr, addr_len) != 0) {
+    ESP_LOGE(TAG_UDP, "Could not bind UDP port %u", port_);
+    socket_.reset();
+    return false;
+  }
+  if (protocol_ == UDP_PROTOCOL_E131) join_e131_multicast_();
+  return true;
+}
+
+void UdpFrameInput::join_e131_multicast_() {
+  // Unicast works without this; multicast senders use 239.255.<universe>
+  for (int u = 0; u < e131_universes_; u++) {
+    uint16_t universe = universe_ + u;
+    struct ip_mreq mreq;
+    mreq.imr_multiaddr.s_addr = htonl(0xEFFF0000UL | universe);
+    mreq.imr_interface.s_addr = htonl(INADDR_ANY);
+    if (socket_->setsockopt(IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) != 0) {
+      ESP_LOGW(TAG_UDP, "Could not join multicast group of universe %u", universe);
+    }
+  }
+}
+
+// ============================================================================
+// Receive
+// ============================================================================
+
+const InputFrame *UdpFrameInput::poll(uint32_t now_ms, uint32_t now_us) {
+  if (socket_) {
+    for (int i = 0; i < config::UDP_INPUT_MAX_PACKETS_PER_LOOP; i++) {
+      ssize_t len = socket_->read(packet_.data(), packet_.size());
+      if (len <= 0) break;
+      stats_.packets++;
+      stats_.bytes += uint32_t(len);
+      if (protocol_ == UDP_PROTOCOL_DDP) {
+        handle_ddp(packet_.data(), size_t(len), now_ms, now_us);
+      } else {
+        handle_e131(packet_.data(), size_t(len), now_ms, now_us);
+      }
+    }
+  }
+  if (!has_frame_ || newest_shown_) return nullptr;
+  newest_shown_ = true;
+  return &ring_[newest_];
+}
+
+void UdpFrameInput::handle_ddp(const uint8_t *data, size_t len, uint32_t now_ms, uint32_t now_us) {
+  if (len < DDP_HEADER_SIZE || (data[0] & DDP_VERSION_MASK) != DDP_VERSION_1 || (data[0] & DDP_FLAG_QUERY) ||
+      (data[3] != DDP_ID_DISPLAY && data[3] != 0)) {
+    stats_.dropped_packets++;
+    return;
+  }
+  size_t header = DDP_HEADER_SIZE + ((data[0] & DDP_FLAG_TIMECODE) ? DDP_TIMECODE_SIZE : 0);
+  uint32_t offset = read_be32(data + 4);
+  uint16_t length = read_be16(data + 8);
+  if (len < header + length || offset >= size_t(num_leds_) * 3) {
+    stats_.dropped_packets++;
+    return;
+  }
+  if (sender_restarted_(now_ms)) ddp_sequence_ = 0;
+
+  // Sequence numbers run 1-15 (0 = not used); one more than half a turn
+  // behind the previous packet means this one arrived late
+  uint8_t sequence = data[1] & 0x0F;
+  if (sequence != 0 && ddp_sequence_ != 0) {
+    int ahead = (sequence - ddp_sequence_ + 15) % 15;
+    if (ahead > 7) {
+      stats_.late_packets++;
+      return;
+    }
+  }
+  if (sequence != 0) ddp_sequence_ = sequence;
+  last_packet_ms_ = now_ms;
+
+  begin_frame_(now_us);
+  write_bytes_(offset, data + header, length);
+  // PUSH marks the last packet of a frame; senders that never set it
+  // still complete a frame when they reach the end of the strip
+  if ((data[0] & DDP_FLAG_PUSH) || offset + length >= size_t(num_leds_) * 3) complete_frame_(now_ms);
+}
+
+void UdpFrameInput::handle_e131(const uint8_t *data, size_t len, uint32_t now_ms, uint32_t now_us) {
+  if (len < E131_HEADER_SIZE || std::memcmp(data + 4, E131_ACN_ID, sizeof(E131_ACN_ID)) != 0 ||
+      read_be32(data + 18) != E131_VECTOR_ROOT_DATA || read_be32(data + 40) != E131_VECTOR_FRAME_DATA ||
+      data[117] != E131_VECTOR_DMP_SET_PROPERTY || data[125] != 0 /* DMX start code */) {
+    stats_.dropped_packets++;
+    return;
+  }
+  uint8_t options = data[112];
+  int index = int(read_be16(data + 113)) - universe_;
+  uint16_t channels = read_be16(data + 123);
+  channels = channels > 0 ? channels - 1 : 0;
+  if ((options & E131_OPTION_PREVIEW) || index < 0 || index >= e131_universes_ ||
+      len < E131_HEADER_SIZE + channels) {
+    stats_.dropped_packets++;
+    return;
+  }
+  if (options & E131_OPTION_TERMINATED) {
+    // The source stopped on purpose: hand the panel back now
+    ESP_LOGI(TAG_UDP, "E1.31 stream terminated");
+    has_frame_ = false;
+    assembling_started_ = false;
+    e131_seen_ = 0;
+    return;
+  }
+
+  // Not is_active(): that would forget the universes of a first frame
+  if (sender_restarted_(now_ms)) e131_sequence_.fill(-1);
+  uint8_t sequence = data[111];
+  if (e131_sequence_[index] >= 0) {
+    int behind = int8_t(uint8_t(e131_sequence_[index]) - sequence);
+    if (behind >= 0 && behind < E131_SEQUENCE_WINDOW) {
+      stats_.late_packets++;
+      return;
+    }
+  }
+  e131_sequence_[index] = sequence;
+  last_packet_ms_ = now_ms;
+
+  // A universe repeating before the frame completed starts a new frame
+  uint8_t bit = uint8_t(1u << index);
+  if (e131_seen_ & bit) {
+    stats_.dropped_frames++;
+    assembling_started_ = false;
+    e131_seen_ = 0;
+  }
+  begin_frame_(now_us);
+  size_t bytes = std::min<size_t>(channels, E131_PIXELS_PER_UNIVERSE * 3);
+  write_bytes_(size_t(index) * E131_PIXELS_PER_UNIVERSE * 3, data + E131_HEADER_SIZE, bytes);
+  e131_seen_ |= bit;
+  if (e131_seen_ == (1u << e131_universes_) - 1) complete_frame_(now_ms);
+}
+
+// ============================================================================
+// Frame Ring
+// ============================================================================
+
+void UdpFrameInput::begin_frame_(uint32_t now_us) {
+  if (assembling_started_) return;
+  InputFrame &frame = assembling_();
+  if (has_frame_) {
+    frame.rgb = ring_[newest_].rgb;
+  } else {
+    frame.rgb.fill(0);
+  }
+  frame.first_packet_us = now_us;
+  assembling_started_ = true;
+}
+
+void UdpFrameInput::write_bytes_(size_t offset, const uint8_t *data, size_t len) {
+  auto &rgb = assembling_().rgb;
+  size_t end = std::min<size_t>(offset + len, size_t(num_leds_) * 3);
+  for (size_t pos = offset; pos < end; pos++) {
+    uint16_t led = pixel_map_[pos / 3];
+    if (led != UDP_INPUT_NO_LED) rgb[led * 3 + pos % 3] = data[pos - offset];
+  }
+}
+
+void UdpFrameInput::complete_frame_(uint32_t now_ms) {
+  if (has_frame_ && !newest_shown_) stats_.dropped_frames++;
+  stats_.frames++;
+  newest_ = write_;
+  write_ = (write_ + 1) % config::UDP_INPUT_RING_SIZE;
+  has_frame_ = true;
+  newest_shown_ = false;
+  assembling_started_ = false;
+  e131_seen_ = 0;
+  last_frame_ms_ = now_ms;
+}
+
+}  // namespace wordclock
+}  // namespace esphome
+
+#endif  // USE_WORDCLOCK_UDP_INPUT
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "wordclock_config.h"
+
+#ifdef USE_WORDCLOCK_UDP_INPUT
+
+#include "render_task.h"
+#include "esphome/components/socket/socket.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace esphome {
+namespace wordclock {
+
+// ============================================================================
+// UDP Frame Input (udp_input: in the YAML)
+// ============================================================================
+//
+// Lets external animation servers drive the panel as a plain 16x16 display.
+// Packets are read without blocking from WordClock::loop() into a ring of
+// preallocated frames; while frames keep arriving the word renderer is
+// bypassed and each complete frame is copied straight into the strip.
+// After timeout_ms without a frame the clock takes over again.
+
+enum UdpProtocol : uint8_t {
+  UDP_PROTOCOL_DDP = 0,   ///< Distributed Display Protocol, port 4048
+  UDP_PROTOCOL_E131 = 1,  ///< E1.31 / sACN, port 5568, 170 RGB pixels per universe
+};
+
+enum UdpInputLayout : uint8_t {
+  UDP_LAYOUT_STRIP = 0,  ///< Pixel n is strip LED n
+  UDP_LAYOUT_ROWS = 1,   ///< Row-major 16x16, remapped to the serpentine strip
+};
+
+/// Sender pixel without a strip LED (excluded corner or beyond num_leds)
+static constexpr uint16_t UDP_INPUT_NO_LED = 0xFFFF;
+/// E1.31 universes needed for MAX_LEDS at 170 RGB pixels each
+static constexpr int E131_PIXELS_PER_UNIVERSE = 170;
+static constexpr int E131_MAX_UNIVERSES = (MAX_LEDS + E131_PIXELS_PER_UNIVERSE - 1) / E131_PIXELS_PER_UNIVERSE;
+
+/// Counters since boot; rates are derived by the reader
+struct UdpInputStats {
+  uint32_t packets{0};          ///< Datagrams read
+  uint32_t bytes{0};            ///< Payload bytes read
+  uint32_t dropped_packets{0};  ///< Malformed, foreign or out-of-range datagrams
+  uint32_t late_packets{0};     ///< Older sequence number than the frame being assembled
+  uint32_t frames{0};           ///< Complete frames assembled
+  uint32_t frames_shown{0};     ///< Frames copied to the strip
+  uint32_t dropped_frames{0};   ///< Superseded before being shown, or left incomplete
+  uint32_t last_latency_us{0};  ///< First packet read -> schedule_show() of the last frame
+  uint32_t peak_latency_us{0};  ///< Worst latency since the last take_peak_latency_us()
+};
+
+/// One frame in strip order (RGB), plus when its first packet was read
+struct InputFrame {
+  std::array<uint8_t, MAX_LEDS * 3> rgb{};
+  uint32_t first_packet_us{0};
+};
+
+class UdpFrameInput {
+ public:
+  void configure(UdpProtocol protocol, uint16_t port, uint16_t universe, uint32_t timeout_ms, UdpInputLayout layout) {
+    protocol_ = protocol;
+    port_ = port;
+    universe_ = universe;
+    timeout_ms_ = timeout_ms;
+    layout_ = layout;
+    enabled_ = true;
+  }
+  bool is_enabled() const { return enabled_; }
+
+  /// Builds the pixel map and opens the socket
+  bool start(int num_leds);
+
+  /**
+   * @brief Reads pending datagrams (at most UDP_INPUT_MAX_PACKETS_PER_LOOP)
+   * @return Newest complete frame not shown yet, nullptr if none
+   */
+  const InputFrame *poll(uint32_t now_ms, uint32_t now_us);
+
+  /// A complete frame arrived within the timeout
+  bool is_active(uint32_t now_ms) const { return has_frame_ && now_ms - last_frame_ms_ < timeout_ms_; }
+
+  /// Call right after the frame returned by poll() was scheduled
+  void frame_shown(const InputFrame &frame, uint32_t now_us) {
+    stats_.frames_shown++;
+    stats_.last_latency_us = now_us - frame.first_packet_us;
+    if (stats_.last_latency_us > stats_.peak_latency_us) stats_.peak_latency_us = stats_.last_latency_us;
+  }
+
+  /// Datagram handlers, public so a host harness can feed packets directly
+  void handle_ddp(const uint8_t *data, size_t len, uint32_t now_ms, uint32_t now_us);
+  void handle_e131(const uint8_t *data, size_t len, uint32_t now_ms, uint32_t now_us);
+
+  const UdpInputStats &stats() const { return stats_; }
+  uint32_t take_peak_latency_us() {
+    uint32_t peak = stats_.peak_latency_us;
+    stats_.peak_latency_us = 0;
+    return peak;
+  }
+  UdpProtocol protocol() const { return protocol_; }
+  uint16_t port() const { return port_; }
+  uint32_t timeout_ms() const { return timeout_ms_; }
+
+ protected:
+  InputFrame &assembling_() { return ring_[write_]; }
+  /// Starts a frame from the newest one (senders may update part of the strip)
+  void begin_frame_(uint32_t now_us);
+  /// Copies sender bytes [offset, offset+len) into the assembling frame
+  void write_bytes_(size_t offset, const uint8_t *data, size_t len);
+  void complete_frame_(uint32_t now_ms);
+  void join_e131_multicast_();
+  /// No packet accepted for the timeout: the sender may restart its numbering
+  bool sender_restarted_(uint32_t now_ms) const { return now_ms - last_packet_ms_ >= timeout_ms_; }
+
+  bool enabled_{false};
+  UdpProtocol protocol_{UDP_PROTOCOL_DDP};
+  UdpInputLayout layout_{UDP_LAYOUT_STRIP};
+  uint16_t port_{4048};
+  uint16_t universe_{1};
+  uint32_t timeout_ms_{config::UDP_INPUT_DEFAULT_TIMEOUT_MS};
+  int num_leds_{0};
+
+  /// Sender pixel -> strip LED
+  std::array<uint16_t, MAX_LEDS> pixel_map_{};
+
+  std::array<InputFrame, config::UDP_INPUT_RING_SIZE> ring_{};
+  size_t write_{0};          ///< Slot being assembled
+  size_t newest_{0};         ///< Newest complete slot
+  bool has_frame_{false};    ///< newest_ holds a frame
+  bool newest_shown_{true};  ///< newest_ was returned by poll()
+  bool assembling_started_{false};
+  uint32_t last_frame_ms_{0};
+  uint32_t last_packet_ms_{0};  ///< Last packet past the sequence check
+
+  uint8_t ddp_sequence_{0};  ///< Last DDP sequence (1-15, 0 = unused)
+  int e131_universes_{1};    ///< Universes covering num_leds
+  uint8_t e131_seen_{0};     ///< Universes of the assembling frame (bit per universe)
+  std::array<int16_t, E131_MAX_UNIVERSES> e131_sequence_{};  ///< Last sequence, -1 = none yet
+
+  std::unique_ptr<socket::Socket> socket_;
+  std::array<uint8_t, config::UDP_INPUT_PACKET_SIZE> packet_{};
+  UdpInputStats stats_;
+};
+
+}  // namespace wordclock
+}  // namespace esphome
+
+#endif  // USE_WORDCLOCK_UDP_INPUT
@@ -0,0 +1,181 @@
+#pragma once
+
+#include "esphome/core/time.h"
+#include "wordclock_config.h"
+#include <cstdint>
+#include <ctime>
+
+namespace esphome {
+namespace wordclock {
+
+/**
+ * @brief Monotonic wall clock interpolated from millis()
+ *
+ * The RTC is only read while the clock asks for a sample (see
+ * needs_sample()): at start-up, after a time sync and every
+ * WALL_CLOCK_RESYNC_MS. A sample run waits for the RTC second to change so
+ * the clock is anchored on a second edge rather than somewhere inside it.
+ *
+ * In between, time advances from millis(). Small corrections are slewed
+ * (at most WALL_CLOCK_MAX_SLEW_MS per second), so the displayed second never
+ * repeats or skips; only errors above WALL_CLOCK_STEP_THRESHOLD_MS step the
+ * clock. update() reports exactly one tick per displayed second, and the
+ * local time conversion runs once per minute.
+ */
+class WallClock {
+ public:
+  /// True while loop() should read the RTC and pass it to observe()
+  bool needs_sample(uint32_t now_ms) const {
+    return !valid_ || sampling_ || resync_requested_ ||
+           (now_ms - last_sync_ms_) >= config::WALL_CLOCK_RESYNC_MS;
+  }
+
+  /// Forces a resync on the next sample (e.g. from an SNTP sync callback)
+  void request_resync() { resync_requested_ = true; }
+
+  /**
+   * @brief Starts the clock from an estimate instead of an RTC reading
+   *
+   * Used for the warm start. The clock runs at once; the first RTC sample
+   * reconciles it like any resync (slewed below the step threshold).
+   */
+  void seed(int64_t epoch_ms, uint32_t now_ms) {
+    step_to_(epoch_ms, now_ms);
+    valid_ = true;
+    resync_requested_ = true;
+  }
+
+  /**
+   * @brief Feeds one RTC reading (whole seconds)
+   *
+   * The first valid reading anchors the clock immediately; the next
+   * second edge refines the anchor by slewing or stepping.
+   */
+  void observe(time_t epoch, uint32_t now_ms) {
+    if (!valid_) {
+      step_to_((int64_t) epoch * 1000, now_ms);
+      valid_ = true;
+    }
+    if (!sampling_) {
+      sampling_ = true;
+      resync_requested_ = false;
+      sample_epoch_ = epoch;
+      sample_start_ms_ = now_ms;
+      return;
+    }
+
+    if (epoch == sample_epoch_) {
+      // RTC not moving (or stopped): give up after a bit more than a second
+      if (now_ms - sample_start_ms_ > config::WALL_CLOCK_EDGE_TIMEOUT_MS) end_sample_(now_ms);
+      return;
+    }
+
+    // Second edge: epoch started (at most one loop period) before now_ms
+    advance_(now_ms);
+    int64_t error_ms = (int64_t) epoch * 1000 - epoch_ms_;
+    int64_t abs_error = error_ms < 0 ? -error_ms : error_ms;
+    if (abs_error > config::WALL_CLOCK_STEP_THRESHOLD_MS) {
+      step_to_((int64_t) epoch * 1000, now_ms);
+    } else if (abs_error > config::WALL_CLOCK_DEADBAND_MS) {
+      slew_remaining_ms_ = (int32_t) error_ms;
+      slew_budget_us_ = 0;
+    }
+    end_sample_(now_ms);
+  }
+
+  /**
+   * @brief Advances the clock to now_ms
+   * @return true once per new displayed second
+   */
+  bool update(uint32_t now_ms) {
+    if (!valid_) return false;
+    advance_(now_ms);
+
+    int64_t second = epoch_ms_ / 1000;
+    if (second <= tick_epoch_) return false;  // slewing never moves backwards
+    bool minute_changed = (second / 60) != (tick_epoch_ / 60);
+    tick_epoch_ = second;
+    if (minute_changed || !local_valid_) convert_local_();
+    local_second_ = int(second % 60);
+    return true;
+  }
+
+  bool is_valid() const { return valid_ && local_valid_; }
+  int hour() const { return local_hour_; }
+  int minute() const { return local_minute_; }
+  int second() const { return local_second_; }
+
+  /// Milliseconds elapsed in the current displayed second [0, 999]
+  uint32_t subsecond_ms() const {
+    int64_t ms = epoch_ms_ - tick_epoch_ * 1000;
+    return ms < 0 ? 0 : (ms > 999 ? 999 : uint32_t(ms));
+  }
+
+  /// Interpolated UTC time at now_ms (no slew applied, does not advance the clock)
+  int64_t epoch_ms_at(uint32_t now_ms) const { return epoch_ms_ + int64_t(uint32_t(now_ms - base_ms_)); }
+
+  /// Pending slew correction in ms (monitoring)
+  int32_t get_slew_remaining_ms() const { return slew_remaining_ms_; }
+
+ protected:
+  void advance_(uint32_t now_ms) {
+    uint32_t elapsed = now_ms - base_ms_;
+    base_ms_ = now_ms;
+    int32_t correction = 0;
+    if (slew_remaining_ms_ != 0) {
+      // MAX_SLEW_MS per second is as many us per elapsed ms: frames shorter
+      // than 20 ms earn less than 1 ms, so the fraction carries over
+      slew_budget_us_ += uint64_t(elapsed) * config::WALL_CLOCK_MAX_SLEW_MS;
+      int32_t limit = int32_t(slew_budget_us_ / 1000);
+      correction = slew_remaining_ms_;
+      if (correction > limit) correction = limit;
+      if (correction < -limit) correction = -limit;
+      slew_remaining_ms_ -= correction;
+      slew_budget_us_ -= uint64_t(correction < 0 ? -correction : correction) * 1000;
+      if (slew_remaining_ms_ == 0) slew_budget_us_ = 0;
+    }
+    epoch_ms_ += int64_t(elapsed) + correction;
+  }
+
+  void step_to_(int64_t epoch_ms, uint32_t now_ms) {
+    epoch_ms_ = epoch_ms;
+    base_ms_ = now_ms;
+    slew_remaining_ms_ = 0;
+    slew_budget_us_ = 0;
+    tick_epoch_ = epoch_ms / 1000 - 1;  // next update() ticks into this second
+    local_valid_ = false;
+  }
+
+  void end_sample_(uint32_t now_ms) {
+    sampling_ = false;
+    last_sync_ms_ = now_ms;
+  }
+
+  void convert_local_() {
+    ESPTime local = ESPTime::from_epoch_local(time_t(tick_epoch_));
+    local_hour_ = local.hour;
+    local_minute_ = local.minute;
+    local_valid_ = true;
+  }
+
+  bool valid_{false};
+  bool sampling_{false};
+  bool resync_requested_{false};
+  time_t sample_epoch_{0};
+  uint32_t sample_start_ms_{0};
+  uint32_t last_sync_ms_{0};
+
+  int64_t epoch_ms_{0};       ///< Interpolated UTC time in ms
+  uint32_t base_ms_{0};       ///< millis() at the last advance
+  int32_t slew_remaining_ms_{0};
+  uint64_t slew_budget_us_{0};  ///< Slew earned but not yet spent in whole ms
+
+  int64_t tick_epoch_{0};     ///< Displayed second (UTC)
+  bool local_valid_{false};
+  int local_hour_{0};
+  int local_minute_{0};
+  int local_second_{0};
+};
+
+}  // namespace wordclock
+}  // namespace esphome
@@ -0,0 +1,86 @@
+#include "warm_start.h"
+
+#ifdef USE_WORDCLOCK_WARM_START
+
+#include <cstring>
+
+#if defined(USE_ESP32)
+#include "esp_attr.h"
+#define WARM_START_ATTR RTC_NOINIT_ATTR
+#else
+// Host: static storage survives a new WordClock in the same process
+#define WARM_START_ATTR
+#endif
+
+namespace esphome {
+namespace wordclock {
+
+/// 'WCW1'; the record size is folded into the checksum, so a firmware with another layout cold-starts
+static constexpr uint32_t WARM_START_MAGIC = 0x57435731;
+
+/// Earliest plausible saved time (2020-01-01), in case a corrupt record passes the checksum
+static constexpr int64_t WARM_START_MIN_EPOCH_MS = 1577836800LL * 1000;
+
+WARM_START_ATTR static WarmStartRecord warm_start_records[config::WARM_START_SLOTS];
+
+void WarmStart::set_slot(int slot) {
+  record_ = slot >= 0 && slot < config::WARM_START_SLOTS ? &warm_start_records[slot] : nullptr;
+}
+
+uint32_t WarmStart::checksum_() const {
+  uint32_t hash = 2166136261u ^ uint32_t(sizeof(WarmStartRecord));
+  auto mix = [&hash](const uint8_t *data, size_t size) {
+    for (size_t i = 0; i < size; i++) hash = (hash ^ data[i]) * 16777619u;
+  };
+  mix(reinterpret_cast<const uint8_t *>(&record_->epoch_ms), sizeof(record_->epoch_ms));
+  mix(reinterpret_cast<const uint8_t *>(&record_->frame_leds), sizeof(record_->frame_leds));
+  size_t frame_bytes = record_->frame_leds <= MAX_LEDS ? record_->frame_leds * 3 : 0;
+  mix(record_->frame, frame_bytes);
+  return hash;
+}
+
+void WarmStart::save_time(int64_t epoch_ms) {
+  if (record_ == nullptr) return;
+  if (record_->magic != WARM_START_MAGIC) record_->frame_leds = 0;
+  record_->epoch_ms = epoch_ms;
+  record_->magic = WARM_START_MAGIC;
+  record_->checksum = checksum_();
+}
+
+void WarmStart::save_frame(const FrameBuffer &frame, int count) {
+  if (record_ == nullptr || record_->magic != WARM_START_MAGIC) return;  // time first
+  if (count > int(MAX_LEDS)) count = MAX_LEDS;
+  uint8_t *out = record_->frame;
+  for (int i = 0; i < count; i++) {
+    *out++ = frame[i].r;
+    *out++ = frame[i].g;
+    *out++ = frame[i].b;
+  }
+  record_->frame_leds = uint16_t(count);
+  record_->checksum = checksum_();
+}
+
+void WarmStart::invalidate() {
+  if (record_ != nullptr) record_->magic = 0;
+}
+
+bool WarmStart::restore(int64_t *epoch_ms) const {
+  if (record_ == nullptr || record_->magic != WARM_START_MAGIC) return false;
+  if (record_->frame_leds > MAX_LEDS || record_->checksum != checksum_()) return false;
+  if (record_->epoch_ms < WARM_START_MIN_EPOCH_MS) return false;
+  *epoch_ms = record_->epoch_ms;
+  return true;
+}
+
+int WarmStart::restore_frame(FrameBuffer &frame, int count) const {
+  // Only after restore() succeeded; a frame for another strip length is not shown
+  if (record_ == nullptr || record_->frame_leds != count) return 0;
+  const uint8_t *in = record_->frame;
+  for (int i = 0; i < count; i++, in += 3) frame[i] = Color(in[0], in[1], in[2]);
+  return count;
+}
+
+}  // namespace wordclock
+}  // namespace esphome
+
+#endif  // USE_WORDCLOCK_WARM_START
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "wordclock_config.h"
+
+#ifdef USE_WORDCLOCK_WARM_START
+
+#include "render_task.h"
+#include <cstdint>
+
+namespace esphome {
+namespace wordclock {
+
+// ============================================================================
+// Warm Start (warm_start: in the YAML)
+// ============================================================================
+//
+// A soft reset (OTA, restart, crash) keeps RTC memory, and millis() restarts
+// at zero. The clock therefore keeps its last time and frame in a no-init
+// RTC record: at boot, the saved time plus millis() is a good estimate of
+// the current time, shown before Wi-Fi or SNTP are up. Power loss leaves
+// random content, which the magic and the checksum reject.
+
+/**
+ * @brief Time and frame retained across soft resets
+ */
+struct WarmStartRecord {
+  uint32_t magic;
+  uint32_t checksum;  ///< FNV-1a of everything below
+  int64_t epoch_ms;   ///< UTC time of the save
+  uint16_t frame_leds;  ///< LEDs in frame, 0 = no frame saved
+  uint8_t frame[MAX_LEDS * 3];
+};
+
+/**
+ * @brief One clock's record (slot assigned by __init__.py)
+ *
+ * Saves come from the ESPHome loop only: the time once per displayed
+ * second, the frame after it was presented.
+ */
+class WarmStart {
+ public:
+  void set_slot(int slot);
+  bool enabled() const { return record_ != nullptr; }
+
+  void save_time(int64_t epoch_ms);
+  void save_frame(const FrameBuffer &frame, int count);
+  void invalidate();
+
+  /// Saved time, false if the record did not survive (cold start)
+  bool restore(int64_t *epoch_ms) const;
+  /// Copies the saved frame into frame; returns its LED count (0 = none)
+  int restore_frame(FrameBuffer &frame, int count) const;
+
+ protected:
+  uint32_t checksum_() const;
+
+  WarmStartRecord *record_{nullptr};
+};
+
+}  // namespace wordclock
+}  // namespace esphome
+
+#endif  // USE_WORDCLOCK_WARM_START
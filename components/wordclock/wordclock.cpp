@@ -9,15 +9,18 @@
 #include "switch/wordclock_switch.h"
 #include "language_base.h"
 #include "language_manager.h"
-#include "lang_french.h"
-#include "lang_english_uk.h"
+#include "preview_stream.h"
 #include "esphome/core/log.h"
 #include "esphome/components/wifi/wifi_component.h"
 #include "esphome/components/light/light_state.h"
 #ifdef USE_CAPTIVE_PORTAL
 #include "esphome/components/captive_portal/captive_portal.h"
 #endif
+#if defined(USE_WORDCLOCK_THROTTLE) && defined(USE_OTA_STATE_CALLBACK)
+#include "esphome/components/ota/ota_backend.h"
+#endif
 #include <cmath>
+#include <cstring>
 #include <algorithm>
 #include <set>
 
@@ -34,17 +37,9 @@ static const char *const TAG = "wordclock";
 // Color Utilities Implementation
 // ============================================================================
 
-Color hsv_to_rgb(float h, float s, float v) {
-  return g_hsv_cache.get_rgb(h, s, v);
-}
-
 Color blend_colors(Color from, Color to, float progress) {
   progress = progress * progress * (3.0f - 2.0f * progress);
-  return Color(
-    uint8_t(from.r + (to.r - from.r) * progress),
-    uint8_t(from.g + (to.g - from.g) * progress),
-    uint8_t(from.b + (to.b - from.b) * progress)
-  );
+  return blend_colors_eased(from, to, progress);
 }
 
 Color get_light_color_safe(WordClockLight* light, const LightBrightnessRange& range) {
@@ -68,29 +63,335 @@ Color get_light_color_safe(WordClockLight* light, const LightBrightnessRange& ra
 void WordClock::setup() {
   ESP_LOGCONFIG(TAG, "Setting up WordClock...");
   
-  StringPool::instance().clear();
-  
-  LanguageManager::get_instance().register_language(LANG_FRENCH, new LanguageFrench());
-  LanguageManager::get_instance().register_language(LANG_ENGLISH_UK, new LanguageEnglishUK());
-  
+  string_pool_.clear();
+  if (!has_language(default_language_)) {
+    for (int lang = LANG_FRENCH; lang <= LANG_ENGLISH_UK; lang++) {
+      if (has_language(lang)) { default_language_ = lang; break; }
+    }
+  }
+  if (!has_language(current_language_)) current_language_ = default_language_;
   init_leds_arrays();
-  setup_time_ = millis();
+  setup_time_ = get_millis();
   prev_led_types_.resize(num_leds_, LIGHT_BACKGROUND);
   prev_led_colors_.resize(num_leds_, Color(0, 0, 0));
+  // The per-minute LED lists never outgrow one strip: reserve once so the
+  // display path does not allocate after boot
+  for (auto *leds : {&active_hours_leds_, &active_minutes_leds_, &active_seconds_leds_,
+                     &active_background_leds_, &prev_active_words_, &typing_sequence_}) {
+    leds->reserve(LED_SET_SIZE);
+  }
   led_type_index_.fill(LIGHT_BACKGROUND);
   number_components_.fill(nullptr);
   boot_state_ = BOOT_WAITING_WIFI;
   first_time_display_ = true;
+#ifdef USE_WORDCLOCK_EFFECT_VM
+  for (int slot = 0; slot < config::EFFECT_VM_SLOTS; slot++) {
+    if (program_sources_[slot] == nullptr) continue;
+    VmLoadResult result = effect_vm_.stage(slot, program_sources_[slot]);
+    if (result.ok) {
+      program_info_[slot] = {effect_vm_.staged().size, effect_vm_.staged().cycles};
+      effect_vm_.commit();
+    } else {
+      ESP_LOGE(TAG, "Effect program %d rejected, line %d: %s", slot, result.line, result.error);
+    }
+  }
+#endif
+  for (auto &layer : layer_effects_) {
+    if (!has_effect(layer.effect)) layer.effect = EFFECT_NONE;
+  }
+  controls_.layer_effects = layer_effects_;
+  controls_.language = current_language_;
+  rebuild_render_config();
+
+  if (time_) {
+    time_->add_on_time_sync_callback([this]() { wall_clock_.request_resync(); });
+  }
+#if defined(USE_WORDCLOCK_THROTTLE) && defined(USE_OTA_STATE_CALLBACK)
+  if (throttle_ota_) {
+    ota::get_global_ota_callback()->add_on_state_callback(
+        [this](ota::OTAState state, float progress, uint8_t error, ota::OTAComponent *component) {
+          throttle_.set_ota(state == ota::OTA_STARTED || state == ota::OTA_IN_PROGRESS);
+        });
+  }
+#endif
+#ifdef USE_WORDCLOCK_UDP_INPUT
+  if (udp_input_.is_enabled() && !udp_input_.start(num_leds_)) {
+    ESP_LOGE(TAG, "UDP frame input disabled");
+  }
+#endif
+#ifdef USE_WORDCLOCK_WARM_START
+  restore_warm_start();
+#endif
   
-  ESP_LOGCONFIG(TAG, "WordClock setup complete, StringPool: %d strings", StringPool::instance().size());
+  ESP_LOGCONFIG(TAG, "WordClock setup complete, StringPool: %d strings", string_pool_.size());
 }
 
 void WordClock::dump_config() {
+  auto lang = LanguageManager::get_language(get_language());
   ESP_LOGCONFIG(TAG, "WordClock:");
-  ESP_LOGCONFIG(TAG, "  LEDs: %d, Language: %s", num_leds_, 
-                current_language_ == LANG_FRENCH ? "French" : "English UK");
+  ESP_LOGCONFIG(TAG, "  LEDs: %d, Language: %s", num_leds_, lang ? lang->get_name() : "none");
   ESP_LOGCONFIG(TAG, "  StringPool: %d, VectorPool: %d", 
-                StringPool::instance().size(), led_pool_.pool_size());
+                string_pool_.size(), led_pool_.pool_size());
+  dump_feature_footprint();
+}
+
+// ============================================================================
+// Compile-time Features
+// ============================================================================
+
+bool WordClock::has_language(int lang) {
+  return LanguageManager::get_language(lang) != nullptr;
+}
+
+bool WordClock::has_effect(int effect) {
+  switch (effect) {
+    case EFFECT_NONE: return true;
+#ifdef USE_WORDCLOCK_EFFECT_RAINBOW
+    case EFFECT_RAINBOW: return true;
+#endif
+#ifdef USE_WORDCLOCK_EFFECT_PULSE
+    case EFFECT_PULSE: return true;
+#endif
+#ifdef USE_WORDCLOCK_EFFECT_BREATHE
+    case EFFECT_BREATHE: return true;
+#endif
+#ifdef USE_WORDCLOCK_EFFECT_COLOR_CYCLE
+    case EFFECT_COLOR_CYCLE: return true;
+#endif
+    default:
+#ifdef USE_WORDCLOCK_EFFECT_VM
+      if (effect_program_slot(effect) >= 0) return true;
+#endif
+#ifdef USE_WORDCLOCK_PALETTES
+      if (effect_palette_index(effect) >= 0) return true;
+#endif
+      return false;
+  }
+}
+
+#ifdef USE_WORDCLOCK_PALETTES
+void WordClock::add_palette(const std::vector<uint32_t> &stops) {
+  if (palette_count_ == config::PALETTE_SLOTS) {
+    ESP_LOGE(TAG, "Too many palettes, ignoring palette %d", palette_count_);
+    return;
+  }
+  Palette &palette = palettes_[palette_count_++];
+  for (uint32_t stop : stops) {
+    if (palette.count == config::PALETTE_MAX_STOPS) break;
+    palette.positions[palette.count] = uint8_t(stop >> 24);
+    palette.colors[palette.count] = Color(uint8_t(stop >> 16), uint8_t(stop >> 8), uint8_t(stop));
+    palette.count++;
+  }
+}
+#endif
+
+#ifdef USE_WORDCLOCK_WORD_COLORS
+void WordClock::add_word_color(uint32_t rgb, const std::vector<const char *> &hours,
+                               const std::vector<const char *> &minutes) {
+  if (word_color_count_ == config::WORD_COLOR_SLOTS) {
+    ESP_LOGE(TAG, "Too many word colours, ignoring slot %d", word_color_count_);
+    return;
+  }
+  WordColorSlot &slot = word_color_slots_[word_color_count_++];
+  slot.color = Color(uint8_t(rgb >> 16), uint8_t(rgb >> 8), uint8_t(rgb));
+  slot.hours = hours;
+  slot.minutes = minutes;
+}
+#endif
+
+#ifdef USE_WORDCLOCK_OVERLAYS
+void WordClock::add_overlay(const char *name, uint32_t rgb, OverlayBlend blend, uint8_t priority,
+                            uint32_t duration_ms, uint32_t flash_ms, const std::vector<const char *> &hours,
+                            const std::vector<const char *> &minutes, const std::vector<const char *> &misc) {
+  if (overlay_preset_count_ == config::OVERLAY_PRESETS) {
+    ESP_LOGE(TAG, "Too many overlays, ignoring %s", name);
+    return;
+  }
+  OverlayPreset &preset = overlay_presets_[overlay_preset_count_++];
+  preset.name = name;
+  preset.color = Color(uint8_t(rgb >> 16), uint8_t(rgb >> 8), uint8_t(rgb));
+  preset.blend = blend;
+  preset.priority = priority;
+  preset.duration_ms = duration_ms;
+  preset.flash_ms = flash_ms;
+  preset.hours = hours;
+  preset.minutes = minutes;
+  preset.misc = misc;
+}
+
+bool WordClock::show_overlay(const std::string &name, uint32_t duration_ms) {
+  for (int i = 0; i < overlay_preset_count_; i++) {
+    if (name == overlay_presets_[i].name) {
+      show_overlay(i, duration_ms);
+      return true;
+    }
+  }
+  ESP_LOGW(TAG, "No overlay named '%s'", name.c_str());
+  return false;
+}
+
+void WordClock::show_overlay(int preset, uint32_t duration_ms) {
+  if (preset < 0 || preset >= overlay_preset_count_) return;
+  RenderCommand cmd{CMD_OVERLAY, preset};
+  cmd.fvalue = float(duration_ms);
+  submit_command(cmd);
+}
+
+void WordClock::clear_overlays() { submit_command({CMD_OVERLAY, -1}); }
+
+void WordClock::apply_overlay(int preset, uint32_t duration_ms) {
+  if (preset < 0 || preset >= overlay_preset_count_) {
+    overlays_.clear();
+    return;
+  }
+  const OverlayPreset &p = overlay_presets_[preset];
+  OverlayEntry entry{uint8_t(preset), p.priority, get_millis(), duration_ms > 0 ? duration_ms : p.duration_ms};
+  if (!overlays_.push(entry)) {
+    ESP_LOGD(TAG, "Overlay %s dropped, %d higher-priority overlays shown", p.name, config::OVERLAY_SLOTS);
+  }
+}
+#endif
+
+#ifdef USE_WORDCLOCK_MARQUEE
+bool WordClock::show_marquee(const std::string &text, int repeat) {
+  if (!marquee_.stage(text.c_str(), repeat)) {
+    ESP_LOGW(TAG, "Marquee busy, message dropped");
+    return false;
+  }
+  // As for effect programs: nothing will start a message whose command was dropped
+  if (!submit_command({CMD_MARQUEE})) {
+    marquee_.cancel();
+    return false;
+  }
+  return true;
+}
+#endif
+
+#ifdef USE_WORDCLOCK_EFFECT_VM
+bool WordClock::load_effect_program(int slot, const std::string &source) {
+  VmLoadResult result = effect_vm_.stage(slot, source.c_str());
+  if (!result.ok) {
+    ESP_LOGW(TAG, "Effect program %d rejected, line %d: %s", slot, result.line, result.error);
+    return false;
+  }
+  // Nothing will commit a program whose command was dropped: unstage it
+  if (!submit_command({CMD_EFFECT_PROGRAM, slot})) {
+    effect_vm_.cancel();
+    return false;
+  }
+  program_info_[slot] = {effect_vm_.staged().size, effect_vm_.staged().cycles};
+  ESP_LOGI(TAG, "Effect program %d loaded", slot);
+  return true;
+}
+#endif
+
+/// Approximate heap held by an LED map (nodes, buckets and vector storage)
+static size_t led_map_bytes(const IndexedLedMap &map) {
+  size_t bytes = map.bucket_count() * sizeof(void *);
+  for (const auto &entry : map) {
+    bytes += sizeof(IndexedLedMap::value_type) + sizeof(void *) + entry.second.capacity() * sizeof(int);
+  }
+  return bytes;
+}
+
+/// Flash held by a language's letter grid (pointers and strings)
+static size_t letter_grid_bytes(const LanguageBase &language) {
+  const char *const *grid = language.get_letter_grid();
+  size_t bytes = GRID_ROWS * sizeof(char *);
+  for (int row = 0; row < GRID_ROWS; row++) bytes += strlen(grid[row]) + 1;
+  return bytes;
+}
+
+/// Flash held by a language's phrase program (ops and word table)
+static size_t phrase_program_bytes(const PhraseProgram &program) {
+  return program.length * sizeof(PhraseOp) + program.word_count * sizeof(PhraseWord);
+}
+
+/// Flash held by a language's phrase table, 0 if not compiled in
+static size_t phrase_table_bytes(const PhraseTableView &table) {
+  if (table.empty()) return 0;
+  return (PHRASE_MINUTES + 1) * sizeof(uint16_t) + table.offsets[PHRASE_MINUTES] * sizeof(uint8_t);
+}
+
+void WordClock::dump_feature_footprint() {
+  // RAM is measured on this instance; flash is only known for static
+  // tables. The LED tables are code (init_leds_arrays()), like every
+  // feature's code size: see the linker map, e.g. firmware.map
+  ESP_LOGCONFIG(TAG, "  Features:");
+  for (int lang = LANG_FRENCH; lang <= LANG_ENGLISH_UK; lang++) {
+    auto language = LanguageManager::get_language(lang);
+    if (!language) continue;
+    ESP_LOGCONFIG(TAG, "    Language %s: %u B letter grid, %u B phrase program, %u B phrase table (flash)",
+                  language->get_code(), (unsigned) letter_grid_bytes(*language),
+                  (unsigned) phrase_program_bytes(language->get_phrase_program()),
+                  (unsigned) phrase_table_bytes(language->get_phrase_table()));
+  }
+  // The maps and program slots belong to the render task while it runs:
+  // only the figures recorded when they were built are read here
+  ESP_LOGCONFIG(TAG, "    LED maps (current language): ~%u B RAM",
+                (unsigned) status_.led_map_bytes.load(std::memory_order_relaxed));
+
+  // One line per select value: built-in kernels, program slots, palettes
+  static const char *const EFFECT_NAMES[] = {"none", "rainbow", "pulse", "breathe", "color_cycle"};
+  for (int effect = EFFECT_RAINBOW; effect <= EFFECT_COLOR_CYCLE; effect++) {
+    if (has_effect(effect)) ESP_LOGCONFIG(TAG, "    Effect %d: %s", effect, EFFECT_NAMES[effect]);
+  }
+#ifdef USE_WORDCLOCK_EFFECT_VM
+  for (int slot = 0; slot < config::EFFECT_VM_SLOTS; slot++) {
+    const EffectProgramInfo &program = program_info_[slot];
+    if (program_sources_[slot] == nullptr && program.size == 0) continue;
+    ESP_LOGCONFIG(TAG, "    Effect %d: program %d, %u instructions, %u cycles/LED", EFFECT_PROGRAM + slot, slot,
+                  (unsigned) program.size, (unsigned) program.cycles);
+  }
+  ESP_LOGCONFIG(TAG, "    Effect VM: %u B RAM", (unsigned) sizeof(effect_vm_));
+#endif
+#ifdef USE_WORDCLOCK_PALETTES
+  for (int index = 0; index < palette_count_; index++) {
+    ESP_LOGCONFIG(TAG, "    Effect %d: palette %d, %u stops", EFFECT_PALETTE + index, index,
+                  (unsigned) palettes_[index].count);
+  }
+  ESP_LOGCONFIG(TAG, "    Palettes: %d, %u B RAM (%d LUTs of %u B)", palette_count_,
+                (unsigned) (sizeof(palettes_) + sizeof(palette_luts_)), EFFECT_LAYER_COUNT,
+                (unsigned) sizeof(palette_luts_[0]));
+#endif
+#ifdef USE_WORDCLOCK_WORD_COLORS
+  ESP_LOGCONFIG(TAG, "    Word colours: %d", word_color_count_);
+#endif
+#ifdef USE_WORDCLOCK_MARQUEE
+  ESP_LOGCONFIG(TAG, "    Marquee: %u B RAM", (unsigned) sizeof(marquee_));
+#endif
+#ifdef USE_WORDCLOCK_OVERLAYS
+  ESP_LOGCONFIG(TAG, "    Overlays: %d presets, %d slots, %u B RAM", overlay_preset_count_, config::OVERLAY_SLOTS,
+                (unsigned) (sizeof(overlay_presets_) + sizeof(overlays_)));
+#endif
+#ifdef USE_WORDCLOCK_HSV
+  ESP_LOGCONFIG(TAG, "    HSV cache: %u B RAM", (unsigned) sizeof(hsv_cache_));
+#endif
+#ifdef USE_WORDCLOCK_BOOT_ANIMATION
+  ESP_LOGCONFIG(TAG, "    Boot animation: enabled");
+#else
+  ESP_LOGCONFIG(TAG, "    Boot animation: status ring only");
+#endif
+  ESP_LOGCONFIG(TAG, "    Seconds ring: %u B tables (flash), %u B RAM",
+                (unsigned) (sizeof(SECONDS_MASKS) + sizeof(SECONDS_DECAY_LUT)), (unsigned) sizeof(seconds_ring_));
+  ESP_LOGCONFIG(TAG, "    Framebuffer: %u B RAM", (unsigned) sizeof(frame_handoff_));
+  ESP_LOGCONFIG(TAG, "    Fade slots: %u B RAM", (unsigned) (sizeof(led_fades_) + sizeof(seconds_fades_) + sizeof(typing_in_leds_)));
+#ifdef USE_WORDCLOCK_ALLOC_AUDIT
+  ESP_LOGCONFIG(TAG, "    Allocation audit: enabled (warm-up %u s)", (unsigned) (config::ALLOC_AUDIT_WARMUP_MS / 1000));
+#endif
+#ifdef USE_WORDCLOCK_RENDER_TASK
+  if (render_task_enabled_) {
+    ESP_LOGCONFIG(TAG, "    Render task: %u B stack + %u B queue", (unsigned) config::RENDER_TASK_STACK_SIZE,
+                  (unsigned) sizeof(command_queue_));
+  }
+#endif
+#ifdef USE_WORDCLOCK_UDP_INPUT
+  if (udp_input_.is_enabled()) {
+    ESP_LOGCONFIG(TAG, "    UDP input: %s on port %u, timeout %u ms, %u B RAM",
+                  udp_input_.protocol() == UDP_PROTOCOL_E131 ? "E1.31" : "DDP", udp_input_.port(),
+                  (unsigned) udp_input_.timeout_ms(), (unsigned) sizeof(udp_input_));
+  }
+#endif
 }
 
 // ============================================================================
@@ -98,22 +399,57 @@ void WordClock::dump_config() {
 // ============================================================================
 
 void WordClock::loop() {
-  if (!updates_enabled_ || !time_) return;
+#ifdef USE_WORDCLOCK_ALLOC_AUDIT
+  alloc_audit_.begin_loop();
+  update_loop();
+  end_alloc_audit();
+#else
+  update_loop();
+#endif
+}
 
-  auto now = time_->now();
-  uint32_t current_millis = millis();
+void WordClock::update_loop() {
+  if (!updates_enabled_ || (!time_ && !time_source_)) return;
+
+  // The RTC is only read while the wall clock resyncs; otherwise time
+  // advances from millis() with one tick per displayed second
+  uint32_t current_millis = get_millis();
+#ifdef USE_WORDCLOCK_THROTTLE
+  update_throttle(current_millis);
+#endif
+  sample_wall_clock(current_millis);
+  if (wall_clock_.update(current_millis)) {
+    // The renderer's copy comes with the tick command while it runs
+    if (!is_render_task_running()) second_start_ms_ = current_millis - wall_clock_.subsecond_ms();
+#ifdef USE_WORDCLOCK_WARM_START
+    save_warm_start_time(current_millis);
+#endif
+  }
+
+#ifdef USE_WORDCLOCK_UDP_INPUT
+  // An external stream owns the strip until it times out
+  if (service_udp_input()) return;
+#endif
+
+#ifdef USE_WORDCLOCK_RENDER_TASK
+  if (render_task_.is_running()) {
+    loop_with_render_task();
+    return;
+  }
+#endif
 
   if (!time_synced_) {
-    handle_boot_sequence(current_millis);
-    if (!now.is_valid()) return;
+    // A warm start has its time from setup(): no boot screens
+    if (!warm_started_) handle_boot_sequence(current_millis);
+    if (!wall_clock_.is_valid()) return;
     
     time_synced_ = true;
-    ESP_LOGI(TAG, "Time synchronized!");
-    set_boot_state(BOOT_TRANSITION_TO_TIME);
+    ESP_LOGI(TAG, warm_started_ ? "Time restored, SNTP will reconcile it" : "Time synchronized!");
+    if (!warm_started_) set_boot_state(BOOT_TRANSITION_TO_TIME);
     
-    last_hours_ = now.hour;
-    last_minutes_ = now.minute;
-    last_seconds_ = now.second;
+    last_hours_ = wall_clock_.hour();
+    last_minutes_ = wall_clock_.minute();
+    last_seconds_ = wall_clock_.second();
     compute_active_leds();
     update_led_type_index();
     
@@ -130,20 +466,40 @@ void WordClock::loop() {
     prev_active_words_.clear();
     prev_active_words_.insert(prev_active_words_.end(), active_hours_leds_.begin(), active_hours_leds_.end());
     prev_active_words_.insert(prev_active_words_.end(), active_minutes_leds_.begin(), active_minutes_leds_.end());
-    return;
+
+    if (!warm_started_) return;
+
+    // Warm start: no transition, the time is drawn in this same loop
+    redraw_pending_ = true;
+    complete_boot();
+#ifdef USE_WORDCLOCK_RENDER_TASK
+    if (render_task_.is_running()) return;
+#endif
   }
 
   if (boot_state_ == BOOT_TRANSITION_TO_TIME) {
+#ifdef USE_WORDCLOCK_BOOT_ANIMATION
     apply_boot_transition();
     float elapsed = (current_millis - boot_transition_start_) / 1000.0f;
-    if (elapsed >= words_fade_out_duration_) {
-      set_boot_state(BOOT_COMPLETE);
-      first_time_display_ = false;
-    }
+    bool transition_done = elapsed >= words_fade_out_duration_;
+#else
+    // No boot animation: the time appears on the next frame
+    bool transition_done = true;
+    redraw_pending_ = true;
+#endif
+    if (transition_done) complete_boot();
     return;
   }
 
-  handle_time_display(now, current_millis);
+  handle_time_display(wall_clock_.hour(), wall_clock_.minute(), wall_clock_.second(), current_millis);
+}
+
+void WordClock::sample_wall_clock(uint32_t current_millis) {
+  if (!wall_clock_.needs_sample(current_millis)) return;
+  auto now = get_time();
+  if (now.is_valid()) {
+    wall_clock_.observe(now.timestamp, current_millis);
+  }
 }
 
 void WordClock::handle_boot_sequence(uint32_t current_millis) {
@@ -153,7 +509,8 @@ void WordClock::handle_boot_sequence(uint32_t current_millis) {
     esp_restart();
   }
   
-  bool wifi_connected = wifi::global_wifi_component->is_connected();
+  bool wifi_connected = wifi::global_wifi_component != nullptr &&
+                        wifi::global_wifi_component->is_connected();
   if (!wifi_connected) {
 #ifdef USE_CAPTIVE_PORTAL
     if (captive_portal::global_captive_portal != nullptr && 
@@ -175,11 +532,8 @@ void WordClock::handle_boot_sequence(uint32_t current_millis) {
   }
 }
 
-void WordClock::handle_time_display(const esphome::ESPTime& now, uint32_t current_millis) {
-  int current_hours = now.hour;
-  int current_minutes = now.minute;
-  int current_seconds = now.second;
-
+void WordClock::handle_time_display(int current_hours, int current_minutes, int current_seconds,
+                                    uint32_t current_millis) {
   bool time_changed = (current_hours != last_hours_ || 
                        current_minutes != last_minutes_ || 
                        current_seconds != last_seconds_);
@@ -191,7 +545,7 @@ void WordClock::handle_time_display(const esphome::ESPTime& now, uint32_t curren
     last_seconds_ = current_seconds;
     compute_active_leds();
     update_led_type_index();
-    detect_led_changes();
+    detect_led_changes(current_millis);
     
     // FIX H2+H7: Force immediate render after time change
     // This ensures new LEDs are rendered in the same frame they're added to typing_in_leds_
@@ -206,29 +560,292 @@ void WordClock::handle_time_display(const esphome::ESPTime& now, uint32_t curren
   }
 
   // Continuous effect/fade updates (separate from time change)
-  bool has_effect = (words_effect_ != EFFECT_NONE || seconds_effect_ != EFFECT_NONE);
+  bool has_sweep = (seconds_mode_ == SECONDS_SWEEP && layer_lights_[LIGHT_SECONDS].on);
+  bool has_effect = any_layer_effect() || has_sweep;
+#ifdef USE_WORDCLOCK_OVERLAYS
+  has_effect = has_effect || !overlays_.empty();
+#endif
+#ifdef USE_WORDCLOCK_MARQUEE
+  has_effect = has_effect || marquee_.active();
+#endif
   bool has_fades = !led_fades_.empty() || !seconds_fades_.empty() || !typing_in_leds_.empty();
+  bool animate = has_effect || has_fades;
+#ifdef USE_WORDCLOCK_THROTTLE
+  // OTA or network burst: the last frame stays up, skipped frames are counted
+  if (animate && (throttle_.active() || throttle_.ota())) {
+    if (adaptive_fps_.should_update(current_millis)) throttle_.skip_frame();
+    animate = false;
+  }
+#endif
   
-  if (has_effect || has_fades) {
+  if (animate) {
     float change_intensity = has_effect ? 1.0f : 0.3f;
     if (adaptive_fps_.should_update(current_millis)) {
       adaptive_fps_.register_visual_change(change_intensity);
       update_display();
+      redraw_pending_ = false;
     }
   }
+
+  if (redraw_pending_.exchange(false)) {
+    update_display();
+  }
 }
 
+// ============================================================================
+// Control Commands
+// ============================================================================
+
+bool WordClock::submit_command(const RenderCommand &cmd) {
+  RenderCommand stamped = cmd;
+  stamped.issued_us = micros();
+#ifdef USE_WORDCLOCK_RENDER_TASK
+  if (render_task_.is_running()) {
+    if (!command_queue_.push(stamped)) {
+      ESP_LOGW(TAG, "Render command queue full, dropping command %d", cmd.type);
+      return false;
+    }
+    return true;
+  }
+#endif
+  apply_command(stamped);
+  return true;
+}
+
+bool WordClock::any_layer_effect() const {
+  for (int layer = 0; layer < EFFECT_LAYER_COUNT; layer++) {
+    if (layer_effects_[layer].effect != EFFECT_NONE && layer_lights_[layer].on) return true;
+  }
+  return false;
+}
+
+void WordClock::apply_layer_command(std::array<LayerEffect, EFFECT_LAYER_COUNT> &layers,
+                                    const RenderCommand &cmd) {
+  for (int layer = 0; layer < EFFECT_LAYER_COUNT; layer++) {
+    if (!(cmd.layers & (1 << layer))) continue;
+    LayerEffect &effect = layers[layer];
+    if (cmd.type == CMD_LAYER_EFFECT) effect.effect = has_effect(cmd.value) ? cmd.value : EFFECT_NONE;
+    if (cmd.type == CMD_LAYER_EFFECT_BRIGHTNESS) effect.brightness = cmd.fvalue;
+    if (cmd.type == CMD_LAYER_EFFECT_SPEED) effect.speed = cmd.fvalue;
+  }
+}
+
+void WordClock::apply_command(const RenderCommand &cmd) {
+  bool seconds_before = layer_lights_[LIGHT_SECONDS].on;
+  int seconds_mode_before = seconds_mode_;
+
+  switch (cmd.type) {
+    case CMD_TIME_TICK:
+      pending_time_ = cmd.value;
+      second_start_ms_ = get_millis() - uint32_t(cmd.fvalue);
+      break;
+    case CMD_POWER: apply_power_state(cmd.on); break;
+    case CMD_SECONDS_MODE: seconds_mode_ = cmd.value; break;
+    case CMD_LAYER_EFFECT:
+    case CMD_LAYER_EFFECT_BRIGHTNESS:
+    case CMD_LAYER_EFFECT_SPEED:
+      apply_layer_command(layer_effects_, cmd);
+      break;
+    case CMD_LANGUAGE: apply_language(cmd.value); break;
+    case CMD_WORDS_FADE_IN: words_fade_in_duration_ = cmd.fvalue; break;
+    case CMD_WORDS_FADE_OUT: words_fade_out_duration_ = cmd.fvalue; break;
+    case CMD_SECONDS_FADE_OUT: seconds_fade_out_duration_ = cmd.fvalue; break;
+    case CMD_TYPING_DELAY: typing_delay_ = cmd.fvalue; break;
+    case CMD_RAINBOW_SPREAD: rainbow_spread_ = cmd.fvalue; break;
+    case CMD_LAYER_LIGHT:
+      if (cmd.value >= LIGHT_HOURS && cmd.value <= LIGHT_BACKGROUND) {
+        layer_lights_[cmd.value].on = cmd.on;
+        layer_lights_[cmd.value].color = cmd.color;
+        layer_lights_[cmd.value].brightness = cmd.fvalue;
+      }
+      break;
+    case CMD_REDRAW: break;
+    case CMD_EFFECT_PROGRAM:
+#ifdef USE_WORDCLOCK_EFFECT_VM
+      effect_vm_.commit();
+#endif
+      break;
+    case CMD_OVERLAY:
+#ifdef USE_WORDCLOCK_OVERLAYS
+      apply_overlay(cmd.value, uint32_t(cmd.fvalue));
+#endif
+      break;
+    case CMD_MARQUEE:
+#ifdef USE_WORDCLOCK_MARQUEE
+      marquee_.commit(get_millis());
+#endif
+      break;
+    case CMD_THROTTLE:
+#ifdef USE_WORDCLOCK_THROTTLE
+      throttle_.set_active(cmd.on);
+#endif
+      break;
+  }
+
+  // Settings read by every frame: refresh the snapshot only when they change
+  switch (cmd.type) {
+    case CMD_LAYER_EFFECT:
+    case CMD_RAINBOW_SPREAD:
+    case CMD_LAYER_EFFECT_BRIGHTNESS:
+    case CMD_LAYER_EFFECT_SPEED:
+    case CMD_LAYER_LIGHT:
+      rebuild_render_config();
+      break;
+    default:
+      break;
+  }
+
+  if (cmd.type == CMD_TIME_TICK) return;
+  // Any other control may recolour an LED of a static layer
+  static_cache_valid_ = false;
+  if (cmd.type == CMD_REDRAW || cmd.type == CMD_THROTTLE) {
+    redraw_pending_ = true;
+    return;
+  }
+
+  // The lit seconds only change on a tick: re-evaluate now so a new mode or
+  // a toggled seconds layer shows (and fades) without waiting for it
+  bool seconds_changed = seconds_mode_ != seconds_mode_before || layer_lights_[LIGHT_SECONDS].on != seconds_before;
+  if (seconds_changed && time_synced_ && boot_state_ == BOOT_COMPLETE) {
+    compute_active_leds();
+    update_led_type_index();
+    detect_led_changes(get_millis());
+  }
+
+  // Every control change is drawn by the next render, even when no effect
+  // or fade keeps the display animating
+  redraw_pending_ = true;
+  control_latency_.invalidate(cmd.issued_us);
+}
+
+void WordClock::on_light_changed(LightType type) {
+  WordClockLight *light = nullptr;
+  LightBrightnessRange range = HOURS_BRIGHTNESS_RANGE;
+  switch (type) {
+    case LIGHT_HOURS: light = hours_light_; break;
+    case LIGHT_MINUTES: light = minutes_light_; range = MINUTES_BRIGHTNESS_RANGE; break;
+    case LIGHT_SECONDS: light = seconds_light_; range = SECONDS_BRIGHTNESS_RANGE; break;
+    case LIGHT_BACKGROUND: light = background_light_; range = BACKGROUND_BRIGHTNESS_RANGE; break;
+    default: return;
+  }
+  RenderCommand cmd{CMD_LAYER_LIGHT, type};
+  cmd.on = (light && light->is_on());
+  cmd.color = get_light_color_safe(light, range);
+  if (cmd.on) {
+    float r, g, b, brightness;
+    light->get_rgb(&r, &g, &b, &brightness);
+    cmd.fvalue = map_brightness(brightness, range.min, range.max);
+  }
+  submit_command(cmd);
+}
+
+void WordClock::request_redraw() {
+  // With a render task the back buffer may be in use by loop(): defer
+  // to the next render iteration instead of drawing from here
+#ifdef USE_WORDCLOCK_RENDER_TASK
+  if (render_task_.is_running()) {
+    redraw_pending_ = true;
+    return;
+  }
+#endif
+  update_display();
+}
+
+// ============================================================================
+// Render Task
+// ============================================================================
+
+#ifdef USE_WORDCLOCK_RENDER_TASK
+void WordClock::start_render_task() {
+  // Hand the current time over so the first render iteration has a tick
+  pending_time_ = last_hours_ * 3600 + last_minutes_ * 60 + last_seconds_;
+  posted_time_ = pending_time_;
+  if (render_task_.start(&WordClock::render_task_body, this, config::RENDER_TASK_STACK_SIZE,
+                         render_task_priority_, render_task_core_)) {
+    ESP_LOGI(TAG, "Render task started (core %d, priority %d)", render_task_core_, render_task_priority_);
+  } else {
+    ESP_LOGE(TAG, "Failed to start render task, rendering from loop()");
+  }
+}
+
+void WordClock::loop_with_render_task() {
+  // loop() only forwards wall clock ticks and presents finished frames
+  int32_t packed = wall_clock_.hour() * 3600 + wall_clock_.minute() * 60 + wall_clock_.second();
+  if (packed != posted_time_) {
+    posted_time_ = packed;
+    submit_command({CMD_TIME_TICK, packed, float(wall_clock_.subsecond_ms())});
+  }
+
+  if (frame_handoff_.ready()) {
+    copy_frame_to_strip();
+    frame_handoff_.release();
+  }
+}
+
+void WordClock::render_task_iteration() {
+  RenderCommand cmd;
+  while (command_queue_.pop(cmd)) {
+    apply_command(cmd);
+  }
+
+  // The back buffer still holds a frame loop() has not presented yet
+  if (frame_handoff_.ready() || pending_time_ < 0) return;
+
+  handle_time_display(pending_time_ / 3600, (pending_time_ / 60) % 60, pending_time_ % 60, get_millis());
+}
+
+void WordClock::render_task_body(void *arg) {
+  auto *self = static_cast<WordClock *>(arg);
+  while (self->render_task_.is_running()) {
+    self->render_task_iteration();
+    RenderTask::sleep_ms(config::RENDER_TASK_IDLE_MS);
+  }
+  RenderTask::exit_current();
+}
+#endif
+
+#ifdef USE_WORDCLOCK_ALLOC_AUDIT
+// ============================================================================
+// Allocation Audit
+// ============================================================================
+
+void WordClock::end_alloc_audit() {
+  uint32_t now_ms = get_millis();
+  uint32_t steady_before = alloc_audit_.steady_total();
+  uint32_t count = alloc_audit_.end_loop(now_ms);
+  if (alloc_audit_.steady_total() == steady_before) return;
+
+  // Rate-limited: a regression would otherwise log on every frame
+  if (now_ms - last_alloc_warning_ms_ >= config::ALLOC_AUDIT_LOG_INTERVAL_MS) {
+    last_alloc_warning_ms_ = now_ms;
+    ESP_LOGW(TAG, "Steady-state loop made %u heap allocations (%u since warm-up)", (unsigned) count,
+             (unsigned) alloc_audit_.steady_total());
+  }
+}
+#endif
+
 // ============================================================================
 // Boot State Management
 // ============================================================================
 
+void WordClock::complete_boot() {
+  set_boot_state(BOOT_COMPLETE);
+  first_time_display_ = false;
+#ifdef USE_WORDCLOCK_RENDER_TASK
+  if (render_task_enabled_) start_render_task();
+#endif
+}
+
 void WordClock::set_boot_state(BootState state) {
   if (boot_state_ != state) {
     ESP_LOGI(TAG, "Boot state: %d -> %d", boot_state_, state);
     boot_state_ = state;
     if (state == BOOT_TRANSITION_TO_TIME) {
-      boot_transition_start_ = millis();
+      boot_transition_start_ = get_millis();
     }
+#ifdef USE_WORDCLOCK_ALLOC_AUDIT
+    if (state == BOOT_COMPLETE) alloc_audit_.arm(get_millis());
+#endif
   }
 }
 
@@ -238,44 +855,39 @@ void WordClock::set_boot_state(BootState state) {
 
 void WordClock::show_boot_display() {
   if (!strip_ || !power_on_) return;
-  auto output = static_cast<light::AddressableLight *>(strip_->get_output());
-  if (!output) return;
 
+  auto &frame = this->frame();
   for (int i = 0; i < num_leds_; i++) {
-    (*output)[i] = Color(0, 0, 0);
+    frame[i] = Color(0, 0, 0);
   }
 
-  uint32_t now_ms = millis();
+  uint32_t now_ms = get_millis();
+#ifdef USE_WORDCLOCK_BOOT_ANIMATION
   render_boot_matrix(now_ms);
+#endif
   render_boot_ring(now_ms);
-  output->schedule_show();
+  present_frame();
 }
 
+#ifdef USE_WORDCLOCK_BOOT_ANIMATION
 void WordClock::render_boot_matrix(uint32_t now_ms) {
-  auto output = static_cast<light::AddressableLight *>(strip_->get_output());
-  if (!output) return;
-
-  size_t key_idx = StringPool::instance().intern("42");
-  auto it = ledsarray_misc_.find(key_idx);
-  if (it == ledsarray_misc_.end() || it->second.empty()) return;
-  
-  const std::vector<int>& boot_leds = it->second;
+  auto &frame = this->frame();
   float t = fmod(1.0f - (float)now_ms / (config::BOOT_CYCLE_TIME_S * 1000.0f), 1.0f);
   if (t < 0) t += 1.0f;
   float hue_per_led = (config::BOOT_RAINBOW_SPREAD / 100.0f) * config::HUE_SPREAD_FACTOR;
 
-  for (size_t i = 0; i < boot_leds.size(); i++) {
-    int led = boot_leds[i];
+  for (int i = 0; i < boot_animation_.matrix_count(); i++) {
+    int led = boot_animation_.matrix_led(i);
     if (!is_excluded_led(led, num_leds_)) {
       float hue = fmod(i * hue_per_led + t, 1.0f);
-      (*output)[led] = hsv_to_rgb(hue, 1.0f, config::BOOT_BRIGHTNESS_MULT);
+      frame[led] = hsv_to_rgb(hue, 1.0f, config::BOOT_BRIGHTNESS_MULT);
     }
   }
 }
+#endif  // USE_WORDCLOCK_BOOT_ANIMATION
 
 void WordClock::render_boot_ring(uint32_t now_ms) {
-  auto output = static_cast<light::AddressableLight *>(strip_->get_output());
-  if (!output) return;
+  auto &frame = this->frame();
 
   Color ring_color;
   switch (boot_state_) {
@@ -285,27 +897,13 @@ void WordClock::render_boot_ring(uint32_t now_ms) {
     default:                    ring_color = Color(0, 0, 255); break;
   }
 
-  int ring_position = (now_ms / config::BOOT_RING_ROTATION_MS) % config::SECONDS_RING_SIZE;
-
-  for (int i = 1; i <= 59; i++) {
-    if (i == config::SECONDS_RING_GAP) continue;
-    const auto& leds = get_second_leds(i);
-    if (leds.empty()) continue;
-    
-    int led = leds[0];
-    int idx = (i <= 29) ? (i - 1) : (i - 2);
-    int distance = idx - ring_position;
-    if (distance < 0) distance += config::SECONDS_RING_SIZE;
-    
-    if (distance < config::BOOT_RING_TRAIL_LENGTH) {
-      float brightness = 1.0f - (float)distance / (float)config::BOOT_RING_TRAIL_LENGTH;
-      brightness = brightness * brightness;
-      (*output)[led] = Color(
-        uint8_t(ring_color.r * brightness * config::BOOT_BRIGHTNESS_MULT),
-        uint8_t(ring_color.g * brightness * config::BOOT_BRIGHTNESS_MULT),
-        uint8_t(ring_color.b * brightness * config::BOOT_BRIGHTNESS_MULT)
-      );
-    }
+  int ring_position = BootAnimation::ring_position(now_ms);
+  for (int s = 1; s <= 59; s++) {
+    if (s == config::SECONDS_RING_GAP) continue;
+    int led = seconds_ring_.led(s);
+    if (led < 0) continue;
+    uint8_t level = BootAnimation::ring_level(s, ring_position);
+    if (level > 0) frame[led] = lerp_colors(Color(0, 0, 0), ring_color, level);
   }
 }
 
@@ -313,7 +911,11 @@ void WordClock::render_boot_ring(uint32_t now_ms) {
 // Language Management
 // ============================================================================
 
-void WordClock::set_language(int lang) {
+void WordClock::apply_language(int lang) {
+  if (!has_language(lang)) {
+    ESP_LOGW(TAG, "Language %d not compiled in", lang);
+    return;
+  }
   if (current_language_ != lang) {
     ESP_LOGI(TAG, "Language: %d -> %d", current_language_, lang);
     current_language_ = lang;
@@ -321,22 +923,37 @@ void WordClock::set_language(int lang) {
     
     // FIX H3: Reset stale color data to prevent ghost flashes
     std::fill(prev_led_colors_.begin(), prev_led_colors_.end(), Color(0, 0, 0));
+    static_cache_valid_ = false;
     std::fill(prev_led_types_.begin(), prev_led_types_.end(), LIGHT_BACKGROUND);
     
     if (time_synced_) {
       compute_active_leds();
       update_led_type_index();
-      detect_led_changes();
+      detect_led_changes(get_millis());
     }
   }
 }
 
 void WordClock::init_leds_arrays() {
-  auto lang = LanguageManager::get_instance().get_language(current_language_);
+  auto lang = LanguageManager::get_language(current_language_);
   if (lang) {
-    lang->init_leds_arrays(ledsarray_start_, ledsarray_hours_, 
+    lang->init_leds_arrays(string_pool_, ledsarray_start_, ledsarray_hours_, 
                            ledsarray_minutes_, seconds_ring_leds_, 
                            ledsarray_misc_);
+    build_word_index(*lang);
+#ifdef USE_WORDCLOCK_OVERLAYS
+    build_overlay_leds();
+#endif
+    seconds_ring_.set_leds(seconds_ring_leds_);
+    size_t map_bytes = led_map_bytes(ledsarray_start_) + led_map_bytes(ledsarray_hours_) +
+                       led_map_bytes(ledsarray_minutes_) + led_map_bytes(ledsarray_misc_);
+    status_.led_map_bytes.store(uint32_t(map_bytes), std::memory_order_relaxed);
+    auto boot_leds = ledsarray_misc_.find(string_pool_.intern("42"));
+    if (boot_leds != ledsarray_misc_.end()) {
+      boot_animation_.set_matrix_leds(boot_leds->second);
+    } else {
+      boot_animation_.clear_matrix_leds();
+    }
   } else {
     ESP_LOGW(TAG, "Language %d not found", current_language_);
   }
@@ -355,13 +972,85 @@ void WordClock::compute_active_leds() {
   active_seconds_leds_.clear();
   active_background_leds_.clear();
   typing_sequence_.clear();
+  led_color_index_.fill(0);
   
-  auto lang = LanguageManager::get_instance().get_language(current_language_);
+  auto lang = LanguageManager::get_language(current_language_);
   if (lang) {
     lang->compute_active_leds(last_hours_, last_minutes_, last_seconds_, this);
   }
 }
 
+void WordClock::evaluate_leds(int hours, int minutes, int seconds) {
+  last_hours_ = hours;
+  last_minutes_ = minutes;
+  last_seconds_ = seconds;
+  compute_active_leds();
+}
+
+void WordClock::evaluate_time(int hours, int minutes, int seconds) {
+  evaluate_leds(hours, minutes, seconds);
+  update_led_type_index();
+}
+
+PhraseWords WordClock::evaluate_phrase(int hours, int minutes) const {
+  auto lang = LanguageManager::get_language(current_language_);
+  return lang ? lang->evaluate_phrase(hours, minutes, phrase_engine_) : PhraseWords{};
+}
+
+bool WordClock::has_phrase_table() const {
+  auto lang = LanguageManager::get_language(current_language_);
+  return lang && !lang->get_phrase_table().empty();
+}
+
+// ============================================================================
+// Phrase Programs
+// ============================================================================
+
+PhraseWords LanguageBase::evaluate_phrase(int hours, int minutes, PhraseEngine engine) const {
+  // Languages without a compiled table fall back to the program
+  PhraseTableView table = get_phrase_table();
+  if (engine == PHRASE_ENGINE_TABLE && !table.empty()) return table.lookup(hours, minutes);
+  return get_phrase_program().evaluate(hours, minutes);
+}
+
+void LanguageBase::compute_active_leds(int hours, int minutes, int seconds, WordClock* clock) const {
+  PhraseProgram program = get_phrase_program();
+  PhraseEngine engine = clock->get_phrase_engine();
+  PhraseWords phrase = evaluate_phrase(hours, minutes, engine);
+  for (int i = 0; i < phrase.count; i++) {
+    uint8_t id = phrase.ids[i];
+    if (id >= program.word_count) continue;
+    if (engine == PHRASE_ENGINE_STRING_KEYS) {
+      clock->add_phrase_key(program.words[id], id);
+    } else {
+      clock->add_phrase_word(id);
+    }
+  }
+  clock->compute_seconds_leds(seconds);
+  clock->compute_background_leds();
+}
+
+std::string WordClock::describe_active_words() {
+  if (is_render_task_running()) return "";
+  // Spell the active words from the faceplate, in typing order
+  auto lang = LanguageManager::get_language(current_language_);
+  if (!lang) return "";
+  const char *const *grid = lang->get_letter_grid();
+
+  std::string phrase;
+  int prev_row = -1, prev_col = -1;
+  for (int led : typing_sequence_) {
+    int row, col;
+    if (!get_led_grid_pos(led, &row, &col)) continue;
+    bool adjacent = (row == prev_row && (col == prev_col + 1 || col == prev_col - 1));
+    if (!phrase.empty() && !adjacent) phrase += ' ';
+    phrase += grid[row][col];
+    prev_row = row;
+    prev_col = col;
+  }
+  return phrase;
+}
+
 void WordClock::clear_active_leds() {
   active_hours_leds_.clear();
   active_minutes_leds_.clear();
@@ -369,7 +1058,7 @@ void WordClock::clear_active_leds() {
   active_background_leds_.clear();
 }
 
-void WordClock::add_word(const std::vector<int> &leds, LightType light_type) {
+void WordClock::add_word(const std::vector<int> &leds, LightType light_type, uint8_t color) {
   std::vector<int> *target;
   switch (light_type) {
     case LIGHT_HOURS: target = &active_hours_leds_; break;
@@ -383,6 +1072,12 @@ void WordClock::add_word(const std::vector<int> &leds, LightType light_type) {
   // Track word order for typing animation (hours and minutes only)
   if (light_type == LIGHT_HOURS || light_type == LIGHT_MINUTES) {
     typing_sequence_.insert(typing_sequence_.end(), leds.begin(), leds.end());
+    // A letter shared by an hour and a minute word takes the minute colour,
+    // as in led_type_index_ (odd entries are minute-layer colours)
+    for (int led : leds) {
+      if (led < 0 || led >= int(led_color_index_.size())) continue;
+      if (light_type == LIGHT_MINUTES || (led_color_index_[led] & 1) == 0) led_color_index_[led] = color;
+    }
   }
 }
 
@@ -401,6 +1096,29 @@ void WordClock::update_led_type_index() {
   for (int led : active_seconds_leds_) {
     if (!is_excluded_led(led, num_leds_)) led_type_index_[led] = LIGHT_SECONDS;
   }
+
+  // Composition state: list positions (the last one wins, as when painting
+  // the lists in order), ring positions and background membership
+  led_compose_.fill(LedComposeState{});
+  static_cache_valid_ = false;
+  auto set_positions = [this](const std::vector<int> &leds, uint8_t LedComposeState::*position) {
+    for (size_t i = 0; i < leds.size() && i < LedComposeState::NO_POSITION; i++) {
+      if (LedSet::in_range(leds[i])) led_compose_[leds[i]].*position = uint8_t(i);
+    }
+  };
+  set_positions(active_hours_leds_, &LedComposeState::hours);
+  set_positions(active_minutes_leds_, &LedComposeState::minutes);
+  set_positions(active_seconds_leds_, &LedComposeState::seconds);
+  for (int s = 1; s < 60; s++) {
+    int led = seconds_ring_.led(s);
+    if (LedSet::in_range(led)) led_compose_[led].ring = uint8_t(s);
+  }
+  for (int led : active_background_leds_) {
+    if (LedSet::in_range(led)) led_compose_[led].background = true;
+  }
+  for (int led = 0; led < LED_SET_SIZE; led++) {
+    led_compose_[led].excluded = is_excluded_led(led, num_leds_);
+  }
 }
 
 LightType WordClock::get_led_type(int led_index) {
@@ -415,6 +1133,7 @@ LightType WordClock::get_led_type(int led_index) {
 void WordClock::register_light(WordClockLight *light, LightType type) {
   register_component_by_type(light, type,
     &hours_light_, &minutes_light_, &seconds_light_, &background_light_);
+  on_light_changed(type);
 }
 
 void WordClock::register_light_state(light::LightState *state, LightType type) {
@@ -424,11 +1143,7 @@ void WordClock::register_light_state(light::LightState *state, LightType type) {
 }
 
 void WordClock::register_effect_select(WordClockEffectSelect *sel, LightType type) {
-  switch (type) {
-    case LIGHT_WORDS: words_effect_select_ = sel; break;
-    case LIGHT_SECONDS: seconds_effect_select_ = sel; break;
-    default: break;
-  }
+  if (type >= LIGHT_HOURS && type <= LIGHT_WORDS) effect_selects_[type] = sel;
 }
 
 void WordClock::register_number(WordClockNumber *num, int type) {
@@ -468,16 +1183,12 @@ void WordClock::factory_reset() {
   reset_light(background_light_state_, defaults::BACKGROUND_COLOR_R, defaults::BACKGROUND_COLOR_G,
               defaults::BACKGROUND_COLOR_B, defaults::BACKGROUND_BRIGHTNESS, defaults::BACKGROUND_ON);
 
-  // Reset selects
-  if (words_effect_select_) {
-    auto call = words_effect_select_->make_call();
-    call.set_option("Rainbow");
-    call.perform();
-  }
-  if (seconds_effect_select_) {
-    auto call = seconds_effect_select_->make_call();
-    call.set_option("Rainbow");
-    call.perform();
+  // Reset selects (effects fall back to "None" when not compiled in)
+  const int default_effects[] = {defaults::DEFAULT_WORDS_EFFECT, defaults::DEFAULT_WORDS_EFFECT,
+                                 defaults::DEFAULT_SECONDS_EFFECT, defaults::DEFAULT_BACKGROUND_EFFECT,
+                                 defaults::DEFAULT_WORDS_EFFECT};
+  for (int type = LIGHT_HOURS; type <= LIGHT_WORDS; type++) {
+    if (effect_selects_[type]) effect_selects_[type]->reset_to_value(default_effects[type]);
   }
   if (seconds_select_) {
     auto call = seconds_select_->make_call();
@@ -486,12 +1197,8 @@ void WordClock::factory_reset() {
   }
   set_seconds_mode(defaults::DEFAULT_SECONDS_MODE);
 
-  if (language_select_) {
-    auto call = language_select_->make_call();
-    call.set_option("Francais");
-    call.perform();
-  }
-  set_language(LANG_FRENCH);
+  if (language_select_) language_select_->reset_to_value(default_language_);
+  set_language(default_language_);
 
   // Helper lambda for resetting numbers
   auto reset_number = [](WordClockNumber* num, float value) {
@@ -511,6 +1218,12 @@ void WordClock::factory_reset() {
   reset_number(number_components_[NUM_WORDS_EFFECT_BRIGHTNESS], defaults::WORDS_EFFECT_BRIGHTNESS);
   reset_number(number_components_[NUM_SECONDS_EFFECT_BRIGHTNESS], defaults::SECONDS_EFFECT_BRIGHTNESS);
   reset_number(number_components_[NUM_EFFECT_SPEED], defaults::EFFECT_SPEED);
+  reset_number(number_components_[NUM_HOURS_EFFECT_BRIGHTNESS], defaults::WORDS_EFFECT_BRIGHTNESS);
+  reset_number(number_components_[NUM_MINUTES_EFFECT_BRIGHTNESS], defaults::WORDS_EFFECT_BRIGHTNESS);
+  reset_number(number_components_[NUM_BACKGROUND_EFFECT_BRIGHTNESS], defaults::BACKGROUND_EFFECT_BRIGHTNESS);
+  for (int type = NUM_HOURS_EFFECT_SPEED; type <= NUM_BACKGROUND_EFFECT_SPEED; type++) {
+    reset_number(number_components_[type], defaults::EFFECT_SPEED);
+  }
 
   set_power_state(true);
   if (power_switch_) {
@@ -525,25 +1238,23 @@ void WordClock::factory_reset() {
 // Power & Display Control
 // ============================================================================
 
-void WordClock::set_power_state(bool state) {
+void WordClock::apply_power_state(bool state) {
   if (power_on_ != state) {
     power_on_ = state;
     ESP_LOGI(TAG, "Power: %s", state ? "ON" : "OFF");
-    update_display();
+    request_redraw();
   }
 }
 
 void WordClock::update_display() {
   if (!strip_) return;
 
-  auto output = static_cast<light::AddressableLight *>(strip_->get_output());
-  if (!output) return;
-
   if (!power_on_) {
+    auto &frame = this->frame();
     for (int i = 0; i < num_leds_; i++) {
-      (*output)[i] = Color(0, 0, 0);
+      frame[i] = Color(0, 0, 0);
     }
-    output->schedule_show();
+    present_frame();
     return;
   }
 
@@ -553,20 +1264,183 @@ void WordClock::update_display() {
 }
 
 // ============================================================================
-// Status Logging
+// Frame Output
 // ============================================================================
 
-void WordClock::log_display_status() {
+void WordClock::present_frame() {
+  control_latency_.attach_to_frame();
+  publish_status();
+#ifdef USE_WORDCLOCK_RENDER_TASK
+  if (render_task_.is_running()) {
+    frame_handoff_.publish();
+    return;
+  }
+#endif
+  copy_frame_to_strip();
+}
+
+void WordClock::publish_status() {
+  status_.estimated_power_w.store(estimated_power_w_, std::memory_order_relaxed);
+  status_.led_fades.store(led_fades_.size(), std::memory_order_relaxed);
+  status_.seconds_fades.store(seconds_fades_.size(), std::memory_order_relaxed);
+  status_.typing_leds.store(typing_in_leds_.size(), std::memory_order_relaxed);
+}
+
+void WordClock::copy_frame_to_strip() {
   if (!strip_) return;
   auto output = static_cast<light::AddressableLight *>(strip_->get_output());
   if (!output) return;
 
+  const auto &frame = frame_handoff_.back();
+  int count = std::min<int>(num_leds_, output->size());
+  for (int i = 0; i < count; i++) {
+    (*output)[i] = frame[i];
+  }
+  output->schedule_show();
+
+#ifdef USE_WORDCLOCK_PREVIEW
+  if (preview_) preview_->capture(frame, count);
+#endif
+  if (control_latency_.frame_shown(micros())) {
+    ESP_LOGD(TAG, "Control change shown after %u us", (unsigned) control_latency_.last_us());
+  }
+  if (time_synced_ && !first_frame_shown_) {
+    first_frame_shown_ = true;
+    first_frame_latency_ms_ = get_millis() - setup_time_;
+    ESP_LOGI(TAG, "First time frame %u ms after setup (%s start)", (unsigned) first_frame_latency_ms_,
+             warm_started_ ? "warm" : "cold");
+  }
+#ifdef USE_WORDCLOCK_WARM_START
+  if (warm_frame_due_) {
+    warm_frame_due_ = false;
+    warm_start_.save_frame(frame, count);
+  }
+#endif
+}
+
+#ifdef USE_WORDCLOCK_THROTTLE
+// ============================================================================
+// Render Throttle
+// ============================================================================
+
+void WordClock::update_throttle(uint32_t now_ms) {
+  if (throttle_.update(now_ms)) {
+    if (throttle_.throttled()) {
+      ESP_LOGI(TAG, "Network busy (loop period %u ms), animations paused", (unsigned) throttle_.loop_period_ms());
+    } else {
+      ESP_LOGI(TAG, "Animations resumed after %u ms; %u frames skipped, ~%u ms render time saved in total",
+               (unsigned) throttle_.last_episode_ms(), (unsigned) throttle_.frames_skipped(),
+               (unsigned) throttle_.saved_ms());
+    }
+  }
+  // Not a control change: no latency sample, but the next render redraws.
+  // Retried on the next loop while the render queue is full.
+  if (throttle_.throttled() == throttle_posted_) return;
+  if (submit_command({CMD_THROTTLE, 0, 0.0f, throttle_.throttled()})) throttle_posted_ = throttle_.throttled();
+}
+#endif
+
+#ifdef USE_WORDCLOCK_WARM_START
+// ============================================================================
+// Warm Start
+// ============================================================================
+
+void WordClock::restore_warm_start() {
+  int64_t epoch_ms;
+  if (!warm_start_.enabled() || !warm_start_.restore(&epoch_ms)) {
+    ESP_LOGI(TAG, "Cold start");
+    return;
+  }
+  // millis() restarted with the reset: the saved time plus the uptime is
+  // short only by the part of a second since the last save and the ROM boot
+  uint32_t now_ms = get_millis();
+  wall_clock_.seed(epoch_ms + now_ms, now_ms);
+  warm_started_ = true;
+  ESP_LOGI(TAG, "Warm start: clock restored, %u ms since reset", (unsigned) now_ms);
+
+  // Until the first live frame, show the one from before the reset
+  if (strip_ && power_on_ && warm_start_.restore_frame(frame(), num_leds_) > 0) copy_frame_to_strip();
+}
+
+void WordClock::save_warm_start_time(uint32_t now_ms) {
+  if (boot_state_ != BOOT_COMPLETE) return;
+  warm_start_.save_time(wall_clock_.epoch_ms_at(now_ms));
+#ifdef USE_WORDCLOCK_UDP_INPUT
+  if (udp_streaming_) return;  // external frames are not the clock's
+#endif
+  warm_frame_due_ = true;
+}
+
+void WordClock::on_shutdown() {
+  // OTA and safe restarts: save the time at the reset, not at the last tick
+  if (boot_state_ == BOOT_COMPLETE && wall_clock_.is_valid()) {
+    warm_start_.save_time(wall_clock_.epoch_ms_at(get_millis()));
+  }
+}
+#endif
+
+// ============================================================================
+// UDP Frame Input
+// ============================================================================
+
+#ifdef USE_WORDCLOCK_UDP_INPUT
+bool WordClock::service_udp_input() {
+  if (!udp_input_.is_enabled()) return false;
+
+  // Network timing: real millis(), not the (possibly replayed) clock time
+  uint32_t now_ms = millis();
+  const InputFrame *frame = udp_input_.poll(now_ms, micros());
+  bool streaming = controls_.power && udp_input_.is_active(now_ms);
+  if (streaming != udp_streaming_) {
+    udp_streaming_ = streaming;
+    ESP_LOGI(TAG, "UDP input: %s", streaming ? "streaming" : "timed out, showing the clock");
+    if (!streaming) {
+      // The last clock frame is stale by now: draw a fresh one
+      submit_command({CMD_REDRAW});
+#ifdef USE_WORDCLOCK_RENDER_TASK
+      if (render_task_.is_running()) frame_handoff_.release();
+#endif
+    }
+  }
+  if (!streaming) return false;
+
+  if (frame != nullptr) show_input_frame(*frame);
+  return true;
+}
+
+void WordClock::show_input_frame(const InputFrame &frame) {
+  if (!strip_) return;
+  auto output = static_cast<light::AddressableLight *>(strip_->get_output());
+  if (!output) return;
+
+  // Straight from the ring slot into the driver: no framebuffer, no effects
+  int count = std::min<int>(num_leds_, output->size());
+  for (int i = 0; i < count; i++) {
+    (*output)[i] = Color(frame.rgb[i * 3], frame.rgb[i * 3 + 1], frame.rgb[i * 3 + 2]);
+  }
+  output->schedule_show();
+  udp_input_.frame_shown(frame, micros());
+
+#ifdef USE_WORDCLOCK_PREVIEW
+  if (preview_) preview_->capture_rgb(frame.rgb.data(), count);
+#endif
+}
+#endif
+
+// ============================================================================
+// Status Logging
+// ============================================================================
+
+void WordClock::log_display_status() {
+  if (!strip_) return;
+  const auto &frame = this->frame();
+
   float total_power_mw = 0;
   for (int i = 0; i < num_leds_; i++) {
     if (is_excluded_led(i, num_leds_)) continue;
-    uint8_t r = (*output)[i].get_red();
-    uint8_t g = (*output)[i].get_green();
-    uint8_t b = (*output)[i].get_blue();
+    uint8_t r = frame[i].r;
+    uint8_t g = frame[i].g;
+    uint8_t b = frame[i].b;
     float led_current_ma = config::IDLE_CURRENT_MA;
     led_current_ma += (r / 255.0f) * config::MAX_CURRENT_PER_CHANNEL_MA;
     led_current_ma += (g / 255.0f) * config::MAX_CURRENT_PER_CHANNEL_MA;
@@ -586,7 +1460,8 @@ void WordClock::log_display_status() {
   }
 #endif
   
-  const char* lang_str = (current_language_ == LANG_FRENCH) ? "FR" : "UK";
+  auto lang = LanguageManager::get_language(current_language_);
+  const char* lang_str = lang ? lang->get_code() : "--";
   
   ESP_LOGD(TAG, "%02d:%02d:%02d [%s] W:%d S:%d | %.2fW | RAM:%.1f%% | %dms",
     last_hours_, last_minutes_, last_seconds_, lang_str,
@@ -595,87 +1470,144 @@ void WordClock::log_display_status() {
   );
 }
 
+// ============================================================================
+// Frame Checksum (replay / regression)
+// ============================================================================
+
+uint32_t WordClock::frame_checksum() {
+  // FNV-1a over the rendered strip, or over the active LED sets when no
+  // strip is attached (host replay without an output driver)
+  uint32_t hash = 2166136261UL;
+  auto mix = [&hash](uint8_t byte) {
+    hash ^= byte;
+    hash *= 16777619UL;
+  };
+
+  auto output = strip_ ? static_cast<light::AddressableLight *>(strip_->get_output()) : nullptr;
+  if (output) {
+    for (int i = 0; i < num_leds_; i++) {
+      mix((*output)[i].get_red());
+      mix((*output)[i].get_green());
+      mix((*output)[i].get_blue());
+    }
+    return hash;
+  }
+
+  const std::vector<int> *layers[] = {&active_hours_leds_, &active_minutes_leds_, &active_seconds_leds_};
+  for (const auto *layer : layers) {
+    mix(0xFF);
+    for (int led : *layer) mix(uint8_t(led));
+  }
+  return hash;
+}
+
 // ============================================================================
 // Helper Methods for Language Implementations
 // ============================================================================
 
-void WordClock::add_word_from_map(const std::string& key, LightType light_type) {
-  size_t key_idx = StringPool::instance().intern(key);
-  
-  IndexedLedMap* source = nullptr;
-  switch (light_type) {
-    case LIGHT_HOURS:
-      if (ledsarray_start_.count(key_idx)) source = &ledsarray_start_;
-      else if (ledsarray_hours_.count(key_idx)) source = &ledsarray_hours_;
-      break;
-    case LIGHT_MINUTES:
-      if (ledsarray_minutes_.count(key_idx)) source = &ledsarray_minutes_;
-      break;
-    default:
-      break;
+void WordClock::build_word_index(const LanguageBase &lang) {
+  // Resolves every phrase word once per language: the per-minute path then
+  // needs no string interning or map lookups
+  PhraseProgram program = lang.get_phrase_program();
+  word_index_.assign(program.word_count, PhraseWordEntry{});
+  for (size_t id = 0; id < program.word_count; id++) {
+    const PhraseWord &word = program.words[id];
+    PhraseWordEntry &entry = word_index_[id];
+    entry.layer = word.layer;
+    entry.color = word_color_index(0, word.layer);
+    if (word.key == nullptr) continue;
+
+    entry.leds = find_word_leds(word);
+
+#ifdef USE_WORDCLOCK_WORD_COLORS
+    // First slot listing the key for the word's layer
+    for (int s = 0; s < word_color_count_ && entry.color < 2; s++) {
+      const auto &keys = word.layer == LIGHT_HOURS ? word_color_slots_[s].hours : word_color_slots_[s].minutes;
+      for (const char *key : keys) {
+        if (strcmp(key, word.key) == 0) entry.color = word_color_index(s + 1, word.layer);
+      }
+    }
+#endif
   }
-  
-  if (source && source->count(key_idx)) {
-    add_word((*source)[key_idx], light_type);
+}
+
+const std::vector<int> *WordClock::find_word_leds(const PhraseWord &word) {
+  size_t key_idx = string_pool_.intern(word.key);
+  IndexedLedMap *sources[2] = {nullptr, nullptr};
+  switch (word.layer) {
+    case LIGHT_HOURS: sources[0] = &ledsarray_start_; sources[1] = &ledsarray_hours_; break;
+    case LIGHT_MINUTES: sources[0] = &ledsarray_minutes_; break;
+    default: break;
   }
+  for (IndexedLedMap *source : sources) {
+    if (source == nullptr) continue;
+    auto it = source->find(key_idx);
+    if (it != source->end()) return &it->second;
+  }
+  return nullptr;
 }
 
-void WordClock::compute_seconds_leds(int time_seconds) {
-  bool seconds_enabled = (seconds_light_ && seconds_light_->is_on());
-  
-  if (!seconds_enabled || time_seconds == 0 || time_seconds == config::SECONDS_RING_GAP) {
-    if (seconds_enabled && (time_seconds == 0 || time_seconds == config::SECONDS_RING_GAP)) {
-      if (seconds_mode_ == SECONDS_PASSED && time_seconds == config::SECONDS_RING_GAP) {
-        for (int s = 1; s < config::SECONDS_RING_GAP; s++) {
-          const auto& leds = get_second_leds(s);
-          if (!leds.empty()) add_word(leds, LIGHT_SECONDS);
-        }
-      } else if (seconds_mode_ == SECONDS_INVERTED) {
-        for (int s = 1; s <= 59; s++) {
-          if (s == config::SECONDS_RING_GAP) continue;
-          const auto& leds = get_second_leds(s);
-          if (!leds.empty()) add_word(leds, LIGHT_SECONDS);
-        }
+#ifdef USE_WORDCLOCK_OVERLAYS
+void WordClock::build_overlay_leds() {
+  // Keys are matched against the pool strings, so missing keys are not interned
+  auto add_keys = [this](LedSet &leds, const IndexedLedMap &map, const std::vector<const char *> &keys) {
+    for (const auto &entry : map) {
+      const std::string &key = string_pool_.get(entry.first);
+      for (const char *wanted : keys) {
+        if (key != wanted) continue;
+        for (int led : entry.second) leds.insert(led);
       }
     }
-    return;
+  };
+  for (int i = 0; i < overlay_preset_count_; i++) {
+    OverlayPreset &preset = overlay_presets_[i];
+    preset.leds.clear();
+    add_keys(preset.leds, ledsarray_start_, preset.hours);
+    add_keys(preset.leds, ledsarray_hours_, preset.hours);
+    add_keys(preset.leds, ledsarray_minutes_, preset.minutes);
+    add_keys(preset.leds, ledsarray_misc_, preset.misc);
   }
+}
+#endif
 
-  switch (seconds_mode_) {
-    case SECONDS_CURRENT: {
-      const auto& leds = get_second_leds(time_seconds);
-      if (!leds.empty()) add_word(leds, LIGHT_SECONDS);
-      break;
+void WordClock::add_phrase_key(const PhraseWord &word, uint8_t word_id) {
+  // Reference path for PHRASE_ENGINE_STRING_KEYS: every call interns the
+  // key and looks its LEDs up in the language maps
+  if (word.key == nullptr || word_id >= word_index_.size()) return;
+  const std::vector<int> *leds = find_word_leds(word);
+  if (leds != nullptr) add_word(*leds, LightType(word.layer), word_index_[word_id].color);
+}
+
+void WordClock::add_phrase_word(uint8_t word_id) {
+  if (word_id >= word_index_.size()) return;
+  const PhraseWordEntry &entry = word_index_[word_id];
+  if (entry.leds != nullptr) add_word(*entry.leds, LightType(entry.layer), entry.color);
+}
+
+void WordClock::compute_seconds_leds(int time_seconds) {
+  // Lit seconds come from the precomputed mode x second masks
+  active_seconds_mask_ = layer_lights_[LIGHT_SECONDS].on ? SecondsRing::mask(seconds_mode_, time_seconds) : 0;
+
+  for (SecondsMask mask = active_seconds_mask_; mask != 0; mask &= mask - 1) {
+    int led = seconds_ring_.led(__builtin_ctzll(mask));
+    if (led >= 0) {
+      active_seconds_leds_.push_back(led);
     }
-    case SECONDS_PASSED:
-      for (int s = 1; s <= time_seconds; s++) {
-        if (s == config::SECONDS_RING_GAP) continue;
-        const auto& leds = get_second_leds(s);
-        if (!leds.empty()) add_word(leds, LIGHT_SECONDS);
-      }
-      break;
-    case SECONDS_INVERTED:
-      for (int s = 1; s <= 59; s++) {
-        if (s == config::SECONDS_RING_GAP || s == time_seconds) continue;
-        const auto& leds = get_second_leds(s);
-        if (!leds.empty()) add_word(leds, LIGHT_SECONDS);
-      }
-      break;
   }
 }
 
 void WordClock::compute_background_leds() {
-  std::vector<bool> used_leds(num_leds_, false);
+  LedSet used_leds;
   
   for (int led : active_hours_leds_) 
-    if (!is_excluded_led(led, num_leds_)) used_leds[led] = true;
+    if (!is_excluded_led(led, num_leds_)) used_leds.insert(led);
   for (int led : active_minutes_leds_) 
-    if (!is_excluded_led(led, num_leds_)) used_leds[led] = true;
+    if (!is_excluded_led(led, num_leds_)) used_leds.insert(led);
   for (int led : active_seconds_leds_) 
-    if (!is_excluded_led(led, num_leds_)) used_leds[led] = true;
+    if (!is_excluded_led(led, num_leds_)) used_leds.insert(led);
 
   for (int i = 0; i < num_leds_; i++) {
-    if (!used_leds[i] && !is_excluded_led(i, num_leds_)) {
+    if (!used_leds.contains(i) && !is_excluded_led(i, num_leds_)) {
       active_background_leds_.push_back(i);
     }
   }
@@ -7,8 +7,24 @@
 #include "esphome/components/light/light_state.h"
 #include "esphome/components/time/real_time_clock.h"
 #include "wordclock_config.h"
+#include "render_task.h"
+#include "wall_clock.h"
+#include "seconds_ring.h"
+#include "boot_animation.h"
+#include "led_set.h"
+#include "alloc_audit.h"
+#include "udp_input.h"
+#include "effect_vm.h"
+#include "palette.h"
+#include "overlay.h"
+#include "marquee.h"
+#include "warm_start.h"
+#include "render_throttle.h"
+#include "phrase_rules.h"
+#include "string_pool.h"
+#include "color_utils.h"
 #include <array>
-#include <map>
+#include <atomic>
 #include <unordered_map>
 #include <vector>
 #include <string>
@@ -19,9 +35,6 @@ namespace wordclock {
 
 // Forward declarations
 class LanguageBase;
-struct LightColors;
-struct EffectParams;
-struct LightBrightnessRange;
 
 /// Type for LED maps using StringPool indices
 using IndexedLedMap = std::unordered_map<size_t, std::vector<int>>;
@@ -39,20 +52,28 @@ enum LightType {
   LIGHT_BOOT = 5
 };
 
-enum SecondsMode {
-  SECONDS_CURRENT = 0,
-  SECONDS_PASSED = 1,
-  SECONDS_INVERTED = 2
-};
-
 enum EffectType {
   EFFECT_NONE = 0,
   EFFECT_RAINBOW = 1,
   EFFECT_PULSE = 2,
   EFFECT_BREATHE = 3,
-  EFFECT_COLOR_CYCLE = 4
+  EFFECT_COLOR_CYCLE = 4,
+  EFFECT_PROGRAM = 16,  ///< + slot: user programs (effect_vm.h)
+  EFFECT_PALETTE = 32   ///< + index: palettes (palette.h)
 };
 
+/// Program slot of an effect value, -1 if it is not a program
+inline int effect_program_slot(int effect) {
+  int slot = effect - EFFECT_PROGRAM;
+  return slot >= 0 && slot < config::EFFECT_VM_SLOTS ? slot : -1;
+}
+
+/// Palette index of an effect value, -1 if it is not a palette
+inline int effect_palette_index(int effect) {
+  int index = effect - EFFECT_PALETTE;
+  return index >= 0 && index < config::PALETTE_SLOTS ? index : -1;
+}
+
 enum BootState {
   BOOT_WAITING_WIFI = 0,
   BOOT_WAITING_TIME_SYNC = 1,
@@ -63,7 +84,8 @@ enum BootState {
 
 enum MatrixLanguage {
   LANG_FRENCH = 0,
-  LANG_ENGLISH_UK = 1
+  LANG_ENGLISH_UK = 1,
+  LANG_COUNT
 };
 
 /**
@@ -77,13 +99,118 @@ enum NumberComponentIndex {
   NUM_RAINBOW_SPREAD = 4,
   NUM_WORDS_EFFECT_BRIGHTNESS = 5,
   NUM_EFFECT_SPEED = 6,
-  NUM_SECONDS_EFFECT_BRIGHTNESS = 7
+  NUM_SECONDS_EFFECT_BRIGHTNESS = 7,
+  NUM_HOURS_EFFECT_BRIGHTNESS = 8,
+  NUM_MINUTES_EFFECT_BRIGHTNESS = 9,
+  NUM_BACKGROUND_EFFECT_BRIGHTNESS = 10,
+  NUM_HOURS_EFFECT_SPEED = 11,
+  NUM_MINUTES_EFFECT_SPEED = 12,
+  NUM_SECONDS_EFFECT_SPEED = 13,
+  NUM_BACKGROUND_EFFECT_SPEED = 14
 };
 
 // ============================================================================
 // Structures
 // ============================================================================
 
+/**
+ * @brief Snapshot of one layer light (hours, minutes, seconds, background)
+ *
+ * Updated from WordClockLight::write_state() so the renderer never reads
+ * LightState objects owned by the ESPHome loop.
+ */
+struct LayerLight {
+  bool on{false};
+  Color color{};
+  float brightness{0.0f};  ///< Mapped brightness folded into color (word colour slots)
+};
+
+/**
+ * @brief Effect settings of one layer (hours, minutes, seconds, background)
+ *
+ * The words controls set hours and minutes together, effect_speed sets
+ * every layer; the layer selects and numbers set one layer each.
+ */
+struct LayerEffect {
+  int effect{EFFECT_NONE};
+  float brightness{0.0f};               ///< Effect brightness, %
+  float speed{defaults::EFFECT_SPEED};  ///< Effect speed, %
+};
+
+/// Effect layer mask of a LightType: LIGHT_WORDS is hours and minutes
+constexpr uint8_t effect_layer_mask(LightType type) {
+  return type == LIGHT_WORDS ? uint8_t((1 << LIGHT_HOURS) | (1 << LIGHT_MINUTES))
+         : type <= LIGHT_BACKGROUND ? uint8_t(1 << type) : uint8_t(0);
+}
+static constexpr uint8_t EFFECT_LAYERS_ALL = (1 << EFFECT_LAYER_COUNT) - 1;
+
+/// Indexed by LightType (hours..background)
+static constexpr std::array<LayerEffect, EFFECT_LAYER_COUNT> DEFAULT_LAYER_EFFECTS{{
+    {defaults::DEFAULT_WORDS_EFFECT, defaults::WORDS_EFFECT_BRIGHTNESS},
+    {defaults::DEFAULT_WORDS_EFFECT, defaults::WORDS_EFFECT_BRIGHTNESS},
+    {defaults::DEFAULT_SECONDS_EFFECT, defaults::SECONDS_EFFECT_BRIGHTNESS},
+    {defaults::DEFAULT_BACKGROUND_EFFECT, defaults::BACKGROUND_EFFECT_BRIGHTNESS},
+}};
+
+/**
+ * @brief Settings as last requested through the setters
+ *
+ * Owned by the loop thread and read by the getters: with a render task
+ * the applied settings belong to the renderer, which writes them while
+ * a control or sensor might read.
+ */
+struct ControlSettings {
+  bool power{true};
+  int seconds_mode{defaults::DEFAULT_SECONDS_MODE};
+  int language{LANG_FRENCH};
+  float words_fade_in_duration{defaults::WORDS_FADE_IN_DURATION};
+  float words_fade_out_duration{defaults::WORDS_FADE_OUT_DURATION};
+  float seconds_fade_out_duration{defaults::SECONDS_FADE_OUT_DURATION};
+  float typing_delay{defaults::TYPING_DELAY};
+  float rainbow_spread{defaults::RAINBOW_SPREAD};
+  std::array<LayerEffect, EFFECT_LAYER_COUNT> layer_effects{DEFAULT_LAYER_EFFECTS};
+};
+
+/**
+ * @brief Renderer counters, published with each frame for the loop thread
+ */
+struct RenderStatus {
+  std::atomic<float> estimated_power_w{0.0f};
+  std::atomic<uint32_t> led_fades{0};
+  std::atomic<uint32_t> seconds_fades{0};
+  std::atomic<uint32_t> typing_leds{0};
+  std::atomic<uint32_t> led_map_bytes{0};  ///< Current language's LED maps, set by init_leds_arrays()
+};
+
+/**
+ * @brief Word of the current language's phrase table, resolved once
+ *
+ * Indexed by phrase word ID. leds points into the language LED maps
+ * (nullptr for holes and unknown keys); color is the word's entry in
+ * RenderConfig::word_colors.
+ */
+struct PhraseWordEntry {
+  const std::vector<int> *leds{nullptr};
+  uint8_t layer{0};
+  uint8_t color{0};
+};
+
+/**
+ * @brief Composition state of one LED (see WordClock::compose_frame())
+ *
+ * Rebuilt with the LED type index whenever the active LEDs change, so the
+ * frame pass finds the layers of each LED without searching the lists.
+ */
+struct LedComposeState {
+  static constexpr uint8_t NO_POSITION = 0xFF;
+  uint8_t hours{NO_POSITION};    ///< Last position in active_hours_leds_
+  uint8_t minutes{NO_POSITION};  ///< Last position in active_minutes_leds_
+  uint8_t seconds{NO_POSITION};  ///< Position in active_seconds_leds_
+  uint8_t ring{0};               ///< Seconds ring position 1-59, 0 = not on the ring
+  bool background{false};        ///< In active_background_leds_
+  bool excluded{false};          ///< is_excluded_led(), drawn black
+};
+
 struct LedFadeState {
   LightType from_type;
   Color from_color;
@@ -162,6 +289,20 @@ class AdaptiveFPS {
   static constexpr float CHANGE_THRESHOLD_LOW = 0.1f;
 };
 
+/**
+ * @brief Injectable time source
+ *
+ * By default WordClock reads millis() and the RealTimeClock. A replay
+ * driver (see time_replay.h) substitutes a fake clock so whole simulated
+ * days can be rendered on the host in seconds.
+ */
+class TimeSource {
+ public:
+  virtual ~TimeSource() = default;
+  virtual uint32_t get_millis() = 0;
+  virtual ESPTime get_time() = 0;
+};
+
 // ============================================================================
 // Forward Declarations of Component Classes
 // ============================================================================
@@ -172,6 +313,7 @@ class WordClockSecondsSelect;
 class WordClockEffectSelect;
 class WordClockLanguageSelect;
 class WordClockNumber;
+class PreviewStream;
 
 // ============================================================================
 // Main WordClock Class
@@ -179,75 +321,268 @@ class WordClockNumber;
 
 class WordClock : public Component {
  public:
-  static constexpr size_t NUM_NUMBER_COMPONENTS = 8;
+  static constexpr size_t NUM_NUMBER_COMPONENTS = 15;
   
   void setup() override;
   void loop() override;
   float get_setup_priority() const override { return setup_priority::DATA; }
   void dump_config() override;
+#ifdef USE_WORDCLOCK_WARM_START
+  void on_shutdown() override;
+#endif
 
   // Configuration
   void set_num_leds(uint16_t num_leds) { num_leds_ = num_leds; }
   void set_time(time::RealTimeClock *time) { time_ = time; }
   void set_strip(light::AddressableLightState *strip) { strip_ = strip; }
+#ifdef USE_WORDCLOCK_PREVIEW
+  void set_preview(PreviewStream *preview) { preview_ = preview; }
+#endif
+  void set_time_source(TimeSource *source) { time_source_ = source; }
 
   // Component Registration
   void register_light(WordClockLight *light, LightType type);
   void register_switch(WordClockSwitch *sw) { power_switch_ = sw; }
   void register_seconds_select(WordClockSecondsSelect *sel) { seconds_select_ = sel; }
   void register_effect_select(WordClockEffectSelect *sel, LightType type);
+  /// A number or select sets this layer's setting on its own (codegen, before
+  /// setup()): the words and effect speed controls then leave the layer alone
+  void add_layer_control(RenderCommandType type, LightType layer) {
+    if (layer != LIGHT_WORDS) dedicated_layers(type) |= effect_layer_mask(layer);
+  }
   void register_language_select(WordClockLanguageSelect *sel) { language_select_ = sel; }
   void register_number(WordClockNumber *num, int type);
   void register_light_state(light::LightState *state, LightType type);
 
+  // Render Task (optional, see render_task.h)
+  void set_render_task(int core, int priority) {
+    render_task_enabled_ = true;
+    render_task_core_ = core;
+    render_task_priority_ = priority;
+  }
+  /// Display state belongs to the render task while it runs: setters are queued
+  bool is_render_task_running() const {
+#ifdef USE_WORDCLOCK_RENDER_TASK
+    return render_task_.is_running();
+#else
+    return false;
+#endif
+  }
+
+#ifdef USE_WORDCLOCK_UDP_INPUT
+  // UDP Frame Input (optional, see udp_input.h)
+  void set_udp_input(UdpProtocol protocol, uint16_t port, uint16_t universe, uint32_t timeout_ms,
+                     UdpInputLayout layout) {
+    udp_input_.configure(protocol, port, universe, timeout_ms, layout);
+  }
+  UdpFrameInput &get_udp_input() { return udp_input_; }
+  bool is_udp_streaming() const { return udp_streaming_; }
+#endif
+
+#ifdef USE_WORDCLOCK_EFFECT_VM
+  // Effect Programs (optional, see effect_vm.h)
+  /// Source compiled in setup() (effect_programs: in the YAML)
+  void set_effect_program(int slot, const char *source) {
+    if (slot >= 0 && slot < config::EFFECT_VM_SLOTS) program_sources_[slot] = source;
+  }
+  /// Replaces a slot at runtime (e.g. from an API service); false if rejected
+  /// or the render command queue is full (nothing changes, retry later)
+  bool load_effect_program(int slot, const std::string &source);
+  const EffectProgram &get_effect_program(int slot) const { return effect_vm_.program(slot); }
+#endif
+
+#ifdef USE_WORDCLOCK_WORD_COLORS
+  // Word Colours (optional, word_colors: in the YAML)
+  /// Appends a colour slot (0xRRGGBB) for the given hour-layer and minute-layer word keys
+  void add_word_color(uint32_t rgb, const std::vector<const char *> &hours,
+                      const std::vector<const char *> &minutes);
+  int get_word_color_count() const { return word_color_count_; }
+#endif
+
+#ifdef USE_WORDCLOCK_OVERLAYS
+  // Overlays (optional, see overlay.h)
+  /// Appends a preset (0xRRGGBB) lighting the given hour-layer, minute-layer and misc keys
+  void add_overlay(const char *name, uint32_t rgb, OverlayBlend blend, uint8_t priority, uint32_t duration_ms,
+                   uint32_t flash_ms, const std::vector<const char *> &hours,
+                   const std::vector<const char *> &minutes, const std::vector<const char *> &misc);
+  int get_overlay_count() const { return overlay_preset_count_; }
+  /// Shows a preset by name (e.g. from an API action); duration 0 = the preset's
+  bool show_overlay(const std::string &name, uint32_t duration_ms = 0);
+  void show_overlay(int preset, uint32_t duration_ms = 0);
+  void clear_overlays();
+#endif
+
+#ifdef USE_WORDCLOCK_MARQUEE
+  // Marquee (optional, see marquee.h)
+  void set_marquee(uint32_t rgb, float columns_per_second, uint8_t repeat) {
+    marquee_.set_color(Color(uint8_t(rgb >> 16), uint8_t(rgb >> 8), uint8_t(rgb)));
+    marquee_.set_speed(columns_per_second);
+    marquee_.set_repeat(repeat);
+  }
+  /// Scrolls text over the letter grid (e.g. from an API action); repeat -1 = the configured count
+  bool show_marquee(const std::string &text, int repeat = -1);
+  void stop_marquee() { show_marquee("", 0); }
+#endif
+
+#ifdef USE_WORDCLOCK_THROTTLE
+  // Render Throttle (optional, see render_throttle.h)
+  void set_throttle(uint32_t busy_loop_ms, uint32_t hold_ms, bool ota) {
+    throttle_.configure(busy_loop_ms, hold_ms);
+    throttle_ota_ = ota;
+  }
+  RenderThrottle &get_throttle() { return throttle_; }
+#endif
+
+#ifdef USE_WORDCLOCK_WARM_START
+  // Warm Start (optional, see warm_start.h)
+  void set_warm_start(int slot) { warm_start_.set_slot(slot); }
+#endif
+  /// True if the time came from the retained record rather than the boot screens
+  bool is_warm_started() const { return warm_started_; }
+
+#ifdef USE_WORDCLOCK_PALETTES
+  // Palettes (optional, see palette.h)
+  /// Appends a palette; stops are 0xPPRRGGBB (position, colour), positions ascending
+  void add_palette(const std::vector<uint32_t> &stops);
+  int get_palette_count() const { return palette_count_; }
+#endif
+
   // Power Control
-  void set_power_state(bool state);
-  bool get_power_state() const { return power_on_; }
+  void set_power_state(bool state) {
+    controls_.power = state;
+    submit_command({CMD_POWER, 0, 0.0f, state});
+  }
+  bool get_power_state() const { return controls_.power; }
 
-  // Mode Configuration
-  void set_seconds_mode(int mode) { seconds_mode_ = mode; }
-  int get_seconds_mode() const { return seconds_mode_; }
-  void set_words_effect(int effect) { words_effect_ = effect; }
-  int get_words_effect() const { return words_effect_; }
-  void set_seconds_effect(int effect) { seconds_effect_ = effect; }
-  int get_seconds_effect() const { return seconds_effect_; }
+  // Phrase Engine (config time, or between benchmark runs)
+  void set_phrase_engine(PhraseEngine engine) { phrase_engine_ = engine; }
+  PhraseEngine get_phrase_engine() const { return phrase_engine_; }
+
+  // Mode Configuration (the getters report the last requested settings)
+  void set_seconds_mode(int mode) {
+    controls_.seconds_mode = mode;
+    submit_command({CMD_SECONDS_MODE, mode});
+  }
+  int get_seconds_mode() const { return controls_.seconds_mode; }
+  void set_words_effect(int effect) { set_layer_effect(LIGHT_WORDS, effect); }
+  int get_words_effect() const { return get_layer_effect(LIGHT_WORDS); }
+  void set_seconds_effect(int effect) { set_layer_effect(LIGHT_SECONDS, effect); }
+  int get_seconds_effect() const { return get_layer_effect(LIGHT_SECONDS); }
+
+  // Layer Effects (hours, minutes, seconds, background; LIGHT_WORDS = hours and minutes)
+  void set_layer_effect(LightType layer, int effect) {
+    submit_layer_command(CMD_LAYER_EFFECT, control_mask(CMD_LAYER_EFFECT, layer), effect, 0.0f);
+  }
+  int get_layer_effect(LightType layer) const { return control_layer(layer).effect; }
+  void set_layer_effect_brightness(LightType layer, float brightness) {
+    submit_layer_command(CMD_LAYER_EFFECT_BRIGHTNESS, control_mask(CMD_LAYER_EFFECT_BRIGHTNESS, layer), 0,
+                         brightness);
+  }
+  float get_layer_effect_brightness(LightType layer) const { return control_layer(layer).brightness; }
+  void set_layer_effect_speed(LightType layer, float speed) {
+    submit_layer_command(CMD_LAYER_EFFECT_SPEED, control_mask(CMD_LAYER_EFFECT_SPEED, layer), 0, speed);
+  }
+  float get_layer_effect_speed(LightType layer) const { return control_layer(layer).speed; }
 
   // Language Management
-  void set_language(int lang);
-  int get_language() const { return current_language_; }
+  void set_language(int lang) {
+    if (has_language(lang)) controls_.language = lang;
+    submit_command({CMD_LANGUAGE, lang});
+  }
+  int get_language() const { return controls_.language; }
+  void set_default_language(int lang) {
+    default_language_ = lang;
+    current_language_ = lang;
+    controls_.language = lang;
+  }
+  int get_default_language() const { return default_language_; }
+
+  // Compile-time Features (see wordclock_config.h)
+  static bool has_language(int lang);
+  static bool has_effect(int effect);
 
   // Effect Parameters
-  void set_words_fade_in_duration(float seconds) { words_fade_in_duration_ = seconds; }
-  float get_words_fade_in_duration() const { return words_fade_in_duration_; }
-  void set_words_fade_out_duration(float seconds) { words_fade_out_duration_ = seconds; }
-  float get_words_fade_out_duration() const { return words_fade_out_duration_; }
-  void set_seconds_fade_out_duration(float seconds) { seconds_fade_out_duration_ = seconds; }
-  float get_seconds_fade_out_duration() const { return seconds_fade_out_duration_; }
-  void set_typing_delay(float delay) { typing_delay_ = delay; }
-  float get_typing_delay() const { return typing_delay_; }
-  void set_rainbow_spread(float spread) { rainbow_spread_ = spread; }
-  float get_rainbow_spread() const { return rainbow_spread_; }
-  void set_words_effect_brightness(float brightness) { words_effect_brightness_ = brightness; }
-  float get_words_effect_brightness() const { return words_effect_brightness_; }
-  void set_seconds_effect_brightness(float brightness) { seconds_effect_brightness_ = brightness; }
-  float get_seconds_effect_brightness() const { return seconds_effect_brightness_; }
-  void set_effect_speed(float speed) { effect_speed_ = speed; }
-  float get_effect_speed() const { return effect_speed_; }
-
-  // Status & Monitoring
-  float get_estimated_power() const { return estimated_power_w_; }
+  void set_words_fade_in_duration(float seconds) {
+    controls_.words_fade_in_duration = seconds;
+    submit_command({CMD_WORDS_FADE_IN, 0, seconds});
+  }
+  float get_words_fade_in_duration() const { return controls_.words_fade_in_duration; }
+  void set_words_fade_out_duration(float seconds) {
+    controls_.words_fade_out_duration = seconds;
+    submit_command({CMD_WORDS_FADE_OUT, 0, seconds});
+  }
+  float get_words_fade_out_duration() const { return controls_.words_fade_out_duration; }
+  void set_seconds_fade_out_duration(float seconds) {
+    controls_.seconds_fade_out_duration = seconds;
+    submit_command({CMD_SECONDS_FADE_OUT, 0, seconds});
+  }
+  float get_seconds_fade_out_duration() const { return controls_.seconds_fade_out_duration; }
+  void set_typing_delay(float delay) {
+    controls_.typing_delay = delay;
+    submit_command({CMD_TYPING_DELAY, 0, delay});
+  }
+  float get_typing_delay() const { return controls_.typing_delay; }
+  void set_rainbow_spread(float spread) {
+    controls_.rainbow_spread = spread;
+    submit_command({CMD_RAINBOW_SPREAD, 0, spread});
+  }
+  float get_rainbow_spread() const { return controls_.rainbow_spread; }
+  void set_words_effect_brightness(float brightness) { set_layer_effect_brightness(LIGHT_WORDS, brightness); }
+  float get_words_effect_brightness() const { return get_layer_effect_brightness(LIGHT_WORDS); }
+  void set_seconds_effect_brightness(float brightness) { set_layer_effect_brightness(LIGHT_SECONDS, brightness); }
+  float get_seconds_effect_brightness() const { return get_layer_effect_brightness(LIGHT_SECONDS); }
+  /// Speed of every layer without its own speed control; get_effect_speed() reports the hours layer
+  void set_effect_speed(float speed) {
+    submit_layer_command(CMD_LAYER_EFFECT_SPEED, EFFECT_LAYERS_ALL & ~dedicated_layers(CMD_LAYER_EFFECT_SPEED), 0,
+                         speed);
+  }
+  float get_effect_speed() const { return get_layer_effect_speed(LIGHT_HOURS); }
+
+  // Light Notifications (called from WordClockLight::write_state)
+  void on_light_changed(LightType type);
+
+  // Status & Monitoring (as of the last rendered frame)
+  float get_estimated_power() const { return status_.estimated_power_w.load(std::memory_order_relaxed); }
+  size_t get_led_fade_count() const { return status_.led_fades.load(std::memory_order_relaxed); }
+  size_t get_seconds_fade_count() const { return status_.seconds_fades.load(std::memory_order_relaxed); }
+  size_t get_typing_count() const { return status_.typing_leds.load(std::memory_order_relaxed); }
+  uint32_t frame_checksum();
+  ControlLatency &get_control_latency() { return control_latency_; }
+  /// setup() to the first presented frame showing the time, 0 until then
+  uint32_t get_first_frame_latency_ms() const { return first_frame_latency_ms_; }
+#ifdef USE_WORDCLOCK_ALLOC_AUDIT
+  AllocAudit &get_alloc_audit() { return alloc_audit_; }
+#endif
 
   // Display Control
   void update_display();
   void set_boot_state(BootState state);
+  void complete_boot();
   void show_boot_display();
   void factory_reset();
 
   // Helper Methods for Language Implementations
-  void add_word_from_map(const std::string& key, LightType light_type);
+  void add_phrase_word(uint8_t word_id);
+  void add_phrase_key(const PhraseWord &word, uint8_t word_id);
   void compute_seconds_leds(int time_seconds);
   void compute_background_leds();
   
+  // Active LED Sets (replay / golden-frame verification / phrase benchmark)
+  void evaluate_time(int hours, int minutes, int seconds);
+  /// evaluate_time() without the LED type index: compute_active_leds() alone
+  void evaluate_leds(int hours, int minutes, int seconds);
+  /// Phrase rules alone, with the current language and engine
+  PhraseWords evaluate_phrase(int hours, int minutes) const;
+  /// True if the current language compiled in its phrase table
+  bool has_phrase_table() const;
+  const std::vector<int>& get_active_hours_leds() const { return active_hours_leds_; }
+  const std::vector<int>& get_active_minutes_leds() const { return active_minutes_leds_; }
+  const std::vector<int>& get_active_seconds_leds() const { return active_seconds_leds_; }
+  const std::vector<int>& get_active_background_leds() const { return active_background_leds_; }
+  const std::vector<int>& get_typing_sequence() const { return typing_sequence_; }
+  /// Spells the active words; empty while the render task owns them
+  std::string describe_active_words();
+
   const std::vector<int>& get_second_leds(int second) const {
     static const std::vector<int> empty;
     if (second < 0 || second >= 60) return empty;
@@ -286,39 +621,129 @@ class WordClock : public Component {
     }
   }
 
+  // ==========================================================================
+  // Control Commands & Frame Output
+  // ==========================================================================
+
+  /// Applies cmd, or queues it to the render task; false if the queue is full
+  bool submit_command(const RenderCommand &cmd);
+  void submit_layer_command(RenderCommandType type, uint8_t layers, int value, float fvalue) {
+    if (layers == 0) return;
+    RenderCommand cmd{type, value, fvalue};
+    cmd.layers = layers;
+    apply_layer_command(controls_.layer_effects, cmd);
+    submit_command(cmd);
+  }
+  /// CMD_LAYER_EFFECT* on the layers of the command's mask
+  static void apply_layer_command(std::array<LayerEffect, EFFECT_LAYER_COUNT> &layers, const RenderCommand &cmd);
+  void apply_command(const RenderCommand &cmd);
+  /// Layers with their own number or select for a CMD_LAYER_EFFECT* setting
+  uint8_t &dedicated_layers(RenderCommandType type) {
+    return dedicated_layers_[type == CMD_LAYER_EFFECT ? 0 : type == CMD_LAYER_EFFECT_BRIGHTNESS ? 1 : 2];
+  }
+  /// Layers a control reaches: LIGHT_WORDS skips the layers with their own control
+  uint8_t control_mask(RenderCommandType type, LightType layer) {
+    uint8_t mask = effect_layer_mask(layer);
+    return layer == LIGHT_WORDS ? uint8_t(mask & ~dedicated_layers(type)) : mask;
+  }
+  /// Requested settings of one layer; LIGHT_WORDS reads the hours layer
+  const LayerEffect &control_layer(LightType layer) const {
+    return controls_.layer_effects[layer <= LIGHT_BACKGROUND ? layer : LIGHT_HOURS];
+  }
+  /// Counters of the frame just composed, for the loop thread
+  void publish_status();
+  /// An effect on a layer whose light is on: the clock animates
+  bool any_layer_effect() const;
+  void apply_language(int lang);
+  void apply_power_state(bool state);
+#ifdef USE_WORDCLOCK_OVERLAYS
+  void apply_overlay(int preset, uint32_t duration_ms);
+#endif
+  void request_redraw();
+  FrameBuffer &frame() { return frame_handoff_.back(); }
+  void present_frame();
+  void copy_frame_to_strip();
+#ifdef USE_WORDCLOCK_THROTTLE
+  void update_throttle(uint32_t now_ms);
+#endif
+#ifdef USE_WORDCLOCK_WARM_START
+  void restore_warm_start();
+  void save_warm_start_time(uint32_t now_ms);
+#endif
+#ifdef USE_WORDCLOCK_UDP_INPUT
+  bool service_udp_input();
+  void show_input_frame(const InputFrame &frame);
+#endif
+#ifdef USE_WORDCLOCK_RENDER_TASK
+  void start_render_task();
+  void loop_with_render_task();
+  void render_task_iteration();
+  static void render_task_body(void *arg);
+#endif
+
+  // ==========================================================================
+  // Time Access (overridable by TimeSource)
+  // ==========================================================================
+
+  uint32_t get_millis() { return time_source_ ? time_source_->get_millis() : millis(); }
+  ESPTime get_time() { return time_source_ ? time_source_->get_time() : time_->now(); }
+  void sample_wall_clock(uint32_t current_millis);
+
   // ==========================================================================
   // LED Mapping & Computation
   // ==========================================================================
   
   void init_leds_arrays();
+  void build_word_index(const LanguageBase &lang);
+  const std::vector<int> *find_word_leds(const PhraseWord &word);
+#ifdef USE_WORDCLOCK_OVERLAYS
+  void build_overlay_leds();
+#endif
   void compute_active_leds();
-  void add_word(const std::vector<int> &leds, LightType light_type);
+  void add_word(const std::vector<int> &leds, LightType light_type, uint8_t color);
   void clear_active_leds();
   LightType get_led_type(int led_index);
   void update_led_type_index();
 
+#ifdef USE_WORDCLOCK_HSV
+  /// HSV to RGB through this instance's cache
+  Color hsv_to_rgb(float h, float s, float v) { return hsv_cache_.get_rgb(h, s, v); }
+#endif
+
   // Rendering Methods (effects.cpp)
-  LightColors get_light_colors();
-  EffectParams calculate_effect_params();
-  void clear_led_output();
-  void apply_words_with_effects(const LightColors& colors, const EffectParams& params);
-  void apply_seconds_with_effects(const LightColors& colors, const EffectParams& params);
-  void apply_word_fades(Color background_color);
-  void apply_seconds_fades(Color background_color, const EffectParams& params);
-  void apply_background(Color background_color);
+  void rebuild_render_config();
+#ifdef USE_WORDCLOCK_PALETTES
+  void update_palette_luts();
+#endif
+  FrameContext make_frame_context(uint32_t now_ms);
+  Color seconds_effect_color(const FrameContext& ctx);
+  Color seconds_trail_color(const FrameContext& ctx);
+  float compose_frame(const FrameContext& ctx, bool words_enabled);
   void apply_light_colors();
+#ifdef USE_WORDCLOCK_EFFECT_VM
+  void begin_effect_program(EffectVmFrame &program, int effect, int count, const FrameContext &ctx, int layer,
+                            uint32_t budget);
+#endif
+#ifdef USE_WORDCLOCK_BOOT_ANIMATION
   void apply_boot_transition();
-  void detect_led_changes();
+#endif
+  void detect_led_changes(uint32_t now_ms);
+#ifdef USE_WORDCLOCK_BOOT_ANIMATION
   void render_boot_matrix(uint32_t now_ms);
+#endif
   void render_boot_ring(uint32_t now_ms);
-  float calculate_visual_change_intensity();
 
   // Loop Helpers
+  void update_loop();
   void handle_boot_sequence(uint32_t current_millis);
-  void handle_time_display(const esphome::ESPTime& now, uint32_t current_millis);
+  void handle_time_display(int hours, int minutes, int seconds, uint32_t current_millis);
 
   // Logging
   void log_display_status();
+  void dump_feature_footprint();
+#ifdef USE_WORDCLOCK_ALLOC_AUDIT
+  void end_alloc_audit();
+#endif
 
   // ==========================================================================
   // Member Variables
@@ -328,6 +753,7 @@ class WordClock : public Component {
   uint16_t num_leds_{256};
   time::RealTimeClock *time_{nullptr};
   light::AddressableLightState *strip_{nullptr};
+  TimeSource *time_source_{nullptr};
 
   /// Registered Light Components
   WordClockLight *hours_light_{nullptr};
@@ -344,10 +770,16 @@ class WordClock : public Component {
   /// Registered Controls
   WordClockSwitch *power_switch_{nullptr};
   WordClockSecondsSelect *seconds_select_{nullptr};
-  WordClockEffectSelect *words_effect_select_{nullptr};
-  WordClockEffectSelect *seconds_effect_select_{nullptr};
+  std::array<WordClockEffectSelect *, LIGHT_WORDS + 1> effect_selects_{};  ///< Indexed by LightType
+  /// Layer masks with their own effect, brightness and speed control (add_layer_control())
+  std::array<uint8_t, 3> dedicated_layers_{};
   WordClockLanguageSelect *language_select_{nullptr};
 
+  /// Layer light snapshots, indexed by LightType (hours..background)
+  std::array<LayerLight, 4> layer_lights_{};
+  /// Colors and effect timing derived from the lights and numbers
+  RenderConfig render_config_{};
+
   /// Number Components - Array for simplified factory_reset
   std::array<WordClockNumber*, NUM_NUMBER_COMPONENTS> number_components_{};
 
@@ -359,6 +791,8 @@ class WordClock : public Component {
   uint32_t setup_time_{0};
 
   /// Time State
+  WallClock wall_clock_;
+  uint32_t second_start_ms_{0};  ///< millis() at which the displayed second began
   int last_hours_{-1};
   int last_minutes_{-1};
   int last_seconds_{-1};
@@ -367,30 +801,86 @@ class WordClock : public Component {
   BootState boot_state_{BOOT_WAITING_WIFI};
   uint32_t boot_transition_start_{0};
   bool first_time_display_{true};
+  bool warm_started_{false};
+  bool first_frame_shown_{false};
+  uint32_t first_frame_latency_ms_{0};
+#ifdef USE_WORDCLOCK_WARM_START
+  WarmStart warm_start_;
+  bool warm_frame_due_{false};  ///< A tick passed since the frame was last saved
+#endif
 
   /// Effect Configuration
   int seconds_mode_{defaults::DEFAULT_SECONDS_MODE};
-  int words_effect_{defaults::DEFAULT_WORDS_EFFECT};
-  int seconds_effect_{defaults::DEFAULT_SECONDS_EFFECT};
   int current_language_{LANG_FRENCH};
+  int default_language_{LANG_FRENCH};
   float words_fade_in_duration_{defaults::WORDS_FADE_IN_DURATION};
   float words_fade_out_duration_{defaults::WORDS_FADE_OUT_DURATION};
   float seconds_fade_out_duration_{defaults::SECONDS_FADE_OUT_DURATION};
   float rainbow_spread_{defaults::RAINBOW_SPREAD};
-  float words_effect_brightness_{defaults::WORDS_EFFECT_BRIGHTNESS};
-  float seconds_effect_brightness_{defaults::SECONDS_EFFECT_BRIGHTNESS};
-  float effect_speed_{defaults::EFFECT_SPEED};
+  /// Indexed by LightType (hours..background)
+  std::array<LayerEffect, EFFECT_LAYER_COUNT> layer_effects_{DEFAULT_LAYER_EFFECTS};
   float typing_delay_{defaults::TYPING_DELAY};
+  /// Loop-side copy of the settings above, as requested
+  ControlSettings controls_;
   
   /// Monitoring
   float estimated_power_w_{0.0f};
+  RenderStatus status_;
+
+  /// Per-instance caches (languages themselves are shared read-only)
+  StringPool string_pool_;
+#ifdef USE_WORDCLOCK_HSV
+  HSVCache hsv_cache_;
+#endif
 
   /// LED Mappings
   IndexedLedMap ledsarray_start_;
   IndexedLedMap ledsarray_hours_;
   IndexedLedMap ledsarray_minutes_;
   IndexedLedMap ledsarray_misc_;
+  std::vector<PhraseWordEntry> word_index_;  ///< Phrase word ID -> LEDs, layer, colour
+  PhraseEngine phrase_engine_{PHRASE_ENGINE_BYTECODE};
   std::array<std::vector<int>, 60> seconds_ring_leds_;
+  SecondsRing seconds_ring_;
+  BootAnimation boot_animation_;
+#ifdef USE_WORDCLOCK_EFFECT_VM
+  EffectVm effect_vm_;
+  std::array<const char *, config::EFFECT_VM_SLOTS> program_sources_{};
+  /// Loop-side copy of what each slot was loaded with: the slots belong to the renderer
+  std::array<EffectProgramInfo, config::EFFECT_VM_SLOTS> program_info_{};
+  std::array<bool, EFFECT_LAYER_COUNT> program_downgraded_{};  ///< Per layer: over the frame budget
+#endif
+#ifdef USE_WORDCLOCK_WORD_COLORS
+  struct WordColorSlot {
+    Color color{};
+    std::vector<const char *> hours;    ///< Hour-layer word keys (codegen literals)
+    std::vector<const char *> minutes;  ///< Minute-layer word keys
+  };
+  std::array<WordColorSlot, config::WORD_COLOR_SLOTS> word_color_slots_{};
+  int word_color_count_{0};
+#endif
+#ifdef USE_WORDCLOCK_OVERLAYS
+  std::array<OverlayPreset, config::OVERLAY_PRESETS> overlay_presets_{};
+  int overlay_preset_count_{0};
+  OverlayQueue overlays_;  ///< Renderer side (CMD_OVERLAY)
+#endif
+#ifdef USE_WORDCLOCK_MARQUEE
+  Marquee marquee_;
+#endif
+#ifdef USE_WORDCLOCK_THROTTLE
+  RenderThrottle throttle_;
+  bool throttle_ota_{true};  ///< Throttle during OTA updates (state callback)
+  bool throttle_posted_{false};  ///< Throttle state last sent to the renderer
+#endif
+#ifdef USE_WORDCLOCK_PALETTES
+  std::array<Palette, config::PALETTE_SLOTS> palettes_{};
+  int palette_count_{0};
+  std::array<PaletteLut, EFFECT_LAYER_COUNT> palette_luts_;  ///< Per layer, at its effect brightness
+#endif
+#ifdef USE_WORDCLOCK_ALLOC_AUDIT
+  AllocAudit alloc_audit_;
+  uint32_t last_alloc_warning_ms_{0};
+#endif
 
   /// LED Vector Pool - Avoids heap allocations
   LedVectorPool led_pool_;
@@ -399,6 +889,7 @@ class WordClock : public Component {
   std::vector<int> active_hours_leds_;
   std::vector<int> active_minutes_leds_;
   std::vector<int> active_seconds_leds_;
+  SecondsMask active_seconds_mask_{0};
   std::vector<int> active_background_leds_;
   std::vector<int> prev_active_words_;
   
@@ -407,16 +898,48 @@ class WordClock : public Component {
 
   /// LED Type Index - O(1) lookup
   std::array<LightType, 256> led_type_index_;
+  /// Word colour of each lit word LED (RenderConfig::word_colors index)
+  std::array<uint8_t, 256> led_color_index_{};
+  /// Layers of each LED for the frame pass
+  std::array<LedComposeState, LED_SET_SIZE> led_compose_{};
+  /// Static layer cache: LEDs whose clock colour stays prev_led_colors_
+  /// until the active LEDs or a setting change (see compose_frame())
+  LedSet static_leds_;
+  LedSet static_written_;  ///< Cached LEDs that are painted (the others stay black)
+  bool static_cache_valid_{false};
 
   /// Transition State
   std::vector<LightType> prev_led_types_;
   std::vector<Color> prev_led_colors_;
-  std::map<int, LedFadeState> led_fades_;
-  std::map<int, LedFadeState> seconds_fades_;
-  std::map<int, std::pair<uint32_t, int>> typing_in_leds_;
+  LedSlots<LedFadeState> led_fades_;
+  LedSet seconds_fades_;  ///< Ring LEDs that faded out (the trail is drawn from the ring table)
+  LedSlots<std::pair<uint32_t, int>> typing_in_leds_;
   
   /// Adaptive FPS Controller
   AdaptiveFPS adaptive_fps_;
+
+  /// Composed frame (back buffer) and its handoff to the strip driver
+  FrameHandoff frame_handoff_;
+  ControlLatency control_latency_;
+#ifdef USE_WORDCLOCK_PREVIEW
+  PreviewStream *preview_{nullptr};  ///< Receives every presented frame
+#endif
+#ifdef USE_WORDCLOCK_UDP_INPUT
+  UdpFrameInput udp_input_;
+  bool udp_streaming_{false};  ///< External frames currently own the strip
+#endif
+
+  /// Render Task State
+  bool render_task_enabled_{false};
+  int render_task_core_{-1};
+  int render_task_priority_{1};
+  std::atomic<bool> redraw_pending_{false};
+  int32_t posted_time_{-1};   ///< Last h*3600+m*60+s posted to the renderer
+  int32_t pending_time_{-1};  ///< Last tick received by the renderer
+#ifdef USE_WORDCLOCK_RENDER_TASK
+  SpscQueue<RenderCommand, 32> command_queue_;
+  RenderTask render_task_;  ///< Declared last: joined before the state it renders is destroyed
+#endif
 };
 
 }  // namespace wordclock
@@ -1,7 +1,23 @@
 #pragma once
 
+#include "esphome/core/defines.h"
+#include <cstddef>
 #include <cstdint>
 
+// ============================================================================
+// Compile-time Features
+// ============================================================================
+//
+// __init__.py emits one define per selected language (USE_WORDCLOCK_LANG_*),
+// effect (USE_WORDCLOCK_EFFECT_*) and USE_WORDCLOCK_BOOT_ANIMATION. Code for
+// unselected features is not compiled. The HSV cache is only needed by the
+// hue-based effects and the boot animation.
+
+#if defined(USE_WORDCLOCK_EFFECT_RAINBOW) || defined(USE_WORDCLOCK_EFFECT_COLOR_CYCLE) || \
+    defined(USE_WORDCLOCK_BOOT_ANIMATION)
+#define USE_WORDCLOCK_HSV
+#endif
+
 namespace esphome {
 namespace wordclock {
 namespace config {
@@ -65,6 +81,148 @@ static constexpr float COLOR_CYCLE_PERIOD_BASE_MS = 10000.0f;
 /// Effect speed scaling factor
 static constexpr float EFFECT_SPEED_SCALE = 50.0f;
 
+// ============================================================================
+// Wall Clock Constants
+// ============================================================================
+
+/// Periodic RTC resync, on top of the one after each time sync (ms)
+static constexpr uint32_t WALL_CLOCK_RESYNC_MS = 5 * 60 * 1000;
+
+/// Give up waiting for an RTC second edge after this long (ms)
+static constexpr uint32_t WALL_CLOCK_EDGE_TIMEOUT_MS = 1500;
+
+/// Maximum slew correction per second of elapsed time (ms)
+static constexpr uint32_t WALL_CLOCK_MAX_SLEW_MS = 50;
+
+/// Errors above this are stepped instead of slewed (ms)
+static constexpr int64_t WALL_CLOCK_STEP_THRESHOLD_MS = 2000;
+
+/// Errors below this are ignored (loop period jitter, ms)
+static constexpr int64_t WALL_CLOCK_DEADBAND_MS = 20;
+
+// ============================================================================
+// Render Task Constants
+// ============================================================================
+
+/// Render task stack size (bytes on ESP-IDF)
+static constexpr uint32_t RENDER_TASK_STACK_SIZE = 4096;
+
+/// Render task sleep between iterations (ms)
+static constexpr uint32_t RENDER_TASK_IDLE_MS = 2;
+
+// ============================================================================
+// Allocation Audit Constants
+// ============================================================================
+
+/// Display time before loops count as steady (first minute change, fades)
+static constexpr uint32_t ALLOC_AUDIT_WARMUP_MS = 2 * 60 * 1000;
+
+/// Minimum interval between steady-state allocation warnings
+static constexpr uint32_t ALLOC_AUDIT_LOG_INTERVAL_MS = 60 * 1000;
+
+// ============================================================================
+// Preview Stream Constants
+// ============================================================================
+
+/// Default preview rate limit (frames per second sent to clients)
+static constexpr float PREVIEW_DEFAULT_FPS = 10.0f;
+
+/// Full frame resent this often so dropped deltas heal
+static constexpr uint32_t PREVIEW_KEYFRAME_INTERVAL_MS = 5 * 60 * 1000;
+
+// ============================================================================
+// UDP Frame Input Constants
+// ============================================================================
+
+/// Clock takes over again after this long without a complete frame
+static constexpr uint32_t UDP_INPUT_DEFAULT_TIMEOUT_MS = 2500;
+
+/// Frame slots: one being assembled, one complete
+static constexpr size_t UDP_INPUT_RING_SIZE = 2;
+
+/// Largest datagram read (DDP: 10/14-byte header + 1440 bytes; E1.31: 638)
+static constexpr size_t UDP_INPUT_PACKET_SIZE = 1500;
+
+/// Datagrams read per loop at most, so a flood cannot stall the loop
+static constexpr int UDP_INPUT_MAX_PACKETS_PER_LOOP = 16;
+
+// ============================================================================
+// Effect Program Constants (effect_vm.h)
+// ============================================================================
+
+/// Program slots per clock (select values EFFECT_PROGRAM + slot)
+static constexpr int EFFECT_VM_SLOTS = 4;
+
+/// Longest program (instructions)
+static constexpr int EFFECT_VM_MAX_INSTRUCTIONS = 32;
+
+/// Distinct literals per program
+static constexpr int EFFECT_VM_MAX_CONSTANTS = 16;
+
+/// Programs costing more VM cycles per LED are rejected at load time
+static constexpr uint32_t EFFECT_VM_MAX_CYCLES = 128;
+
+/// Per frame, split evenly across the layers running a program: a layer over
+/// its share runs its program once per frame (uniform colour)
+static constexpr uint32_t EFFECT_VM_FRAME_CYCLES = 4096;
+
+// ============================================================================
+// Palette Constants (palette.h)
+// ============================================================================
+
+/// Palettes per clock (select values EFFECT_PALETTE + index)
+static constexpr int PALETTE_SLOTS = 8;
+
+/// Gradient stops per palette
+static constexpr int PALETTE_MAX_STOPS = 16;
+
+// ============================================================================
+// Word Colour Constants
+// ============================================================================
+
+/// Per-word colour slots (word_colors: in the YAML)
+static constexpr int WORD_COLOR_SLOTS = 8;
+
+// ============================================================================
+// Overlay Constants (overlay.h)
+// ============================================================================
+
+/// Overlay presets per clock (overlays: in the YAML)
+static constexpr int OVERLAY_PRESETS = 8;
+
+/// Overlays shown at once; a full queue evicts the lowest priority
+static constexpr int OVERLAY_SLOTS = 4;
+
+/// Fade in at the start and out at the end of an overlay (ms)
+static constexpr uint32_t OVERLAY_FADE_MS = 150;
+
+// ============================================================================
+// Marquee Constants (marquee.h)
+// ============================================================================
+
+/// Longest marquee message (glyphs)
+static constexpr int MARQUEE_MAX_CHARS = 64;
+
+/// Default scroll speed (letter columns per second)
+static constexpr float MARQUEE_DEFAULT_SPEED = 8.0f;
+
+// ============================================================================
+// Warm Start Constants (warm_start.h)
+// ============================================================================
+
+/// Clocks per device with a retained warm start record
+static constexpr int WARM_START_SLOTS = 2;
+
+// ============================================================================
+// Render Throttle Constants (render_throttle.h)
+// ============================================================================
+
+/// Smoothed loop() period above which the network counts as busy (ms)
+static constexpr uint32_t THROTTLE_DEFAULT_BUSY_LOOP_MS = 50;
+
+/// Animations resume this long after the last busy sign (ms)
+static constexpr uint32_t THROTTLE_DEFAULT_HOLD_MS = 2000;
+
 // ============================================================================
 // Millis Overflow Protection
 // ============================================================================
@@ -138,13 +296,15 @@ static constexpr float TYPING_DELAY = 0.13f;
 static constexpr float RAINBOW_SPREAD = 15.0f;
 static constexpr float WORDS_EFFECT_BRIGHTNESS = 50.0f;
 static constexpr float SECONDS_EFFECT_BRIGHTNESS = 50.0f;
+static constexpr float BACKGROUND_EFFECT_BRIGHTNESS = 10.0f;
 static constexpr float EFFECT_SPEED = 10.0f;
 /// @}
 
 /// @name Effect Type Defaults
 /// @{
-static constexpr int DEFAULT_WORDS_EFFECT = 1;    // Rainbow
-static constexpr int DEFAULT_SECONDS_EFFECT = 1;  // Rainbow
+static constexpr int DEFAULT_WORDS_EFFECT = 1;       // Rainbow
+static constexpr int DEFAULT_SECONDS_EFFECT = 1;     // Rainbow
+static constexpr int DEFAULT_BACKGROUND_EFFECT = 0;  // None
 static constexpr int DEFAULT_SECONDS_MODE = 0;    // Current second
 /// @}
 
@@ -0,0 +1,90 @@
+#pragma once
+
+// Shared fixture of the host tests: a WordClock on an in-memory strip with
+// its four lights, driven by a ReplayTimeSource
+
+#include "wordclock.h"
+#include "light/wordclock_light.h"
+#include "time_replay.h"
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+namespace esphome {
+namespace wordclock {
+namespace test {
+
+/// Paris: the replay crosses a DST change on 2024-03-31
+static constexpr const char *TZ_PARIS = "CET-1CEST,M3.5.0,M10.5.0/3";
+/// 2024-03-31 01:00 local, one hour before the spring-forward change
+static constexpr time_t EPOCH_BEFORE_DST = 1711846800 - 3600;
+static constexpr const char *LIGHT_NAMES[4] = {"hours", "minutes", "seconds", "background"};
+
+inline void set_timezone(const char *tz) {
+  setenv("TZ", tz, 1);
+  tzset();
+}
+
+struct HostClock {
+  /// Light ids are <id>_hours ... <id>_background, as a YAML would name them
+  const char *id;
+  WordClock clock;
+  light::AddressableLight strip;
+  light::AddressableLightState strip_state;
+  light::LightState light_states[4];
+  WordClockLight lights[4];
+  ReplayTimeSource source;
+  TimeReplay replay{&clock, &source};
+
+  explicit HostClock(const char *id = "wordclock") : id(id) {
+    strip_state.output_ = &strip;
+    clock.set_strip(&strip_state);
+  }
+
+  /// Starts the replay at epoch, runs setup() and turns the four lights on
+  void start(time_t epoch, uint32_t start_millis = 0) {
+    replay.start(epoch, start_millis);
+    clock.setup();
+    for (int i = 0; i < 4; i++) {
+      lights[i].set_wordclock(&clock);
+      lights[i].set_light_type(LightType(i));
+      lights[i].set_restore_key(std::string(id) + "_" + LIGHT_NAMES[i]);
+      light_states[i].output_ = &lights[i];
+      lights[i].setup();
+      lights[i].write_state(&light_states[i]);
+      clock.register_light(&lights[i], LightType(i));
+    }
+  }
+
+  /// Starts the render task and replays until it runs (at most 10 s)
+  bool start_render_task() {
+    clock.set_render_task(-1, 1);
+    for (int s = 0; s < 10 && !clock.is_render_task_running(); s++) replay.run(1);
+    return clock.is_render_task_running();
+  }
+
+  /// Fills the render queue faster than the renderer drains it
+  void flood_render_queue() {
+    for (int i = 0; i < 64; i++) clock.set_rainbow_spread(0.5f);
+  }
+
+  /// FNV-1a over the strip
+  uint32_t strip_hash() const {
+    uint32_t hash = 2166136261UL;
+    for (uint8_t byte : strip.buf) hash = (hash ^ byte) * 16777619UL;
+    return hash;
+  }
+};
+
+/// Prints the failure and counts it; the test returns the count
+inline int check(bool ok, const char *what, int *failures) {
+  if (!ok) {
+    printf("FAIL: %s\n", what);
+    (*failures)++;
+  }
+  return ok;
+}
+
+}  // namespace test
+}  // namespace wordclock
+}  // namespace esphome
@@ -0,0 +1,40 @@
+#pragma once
+#include <cstdint>
+#include "light_state.h"
+
+namespace esphome {
+namespace light {
+
+struct ESPColorView {
+  uint8_t *r;
+  uint8_t *g;
+  uint8_t *b;
+  ESPColorView &operator=(const Color &c) {
+    *r = c.r;
+    *g = c.g;
+    *b = c.b;
+    return *this;
+  }
+  uint8_t get_red() const { return *r; }
+  uint8_t get_green() const { return *g; }
+  uint8_t get_blue() const { return *b; }
+  Color get() const { return Color(*r, *g, *b); }
+};
+
+/// 256-LED strip kept in memory; schedule_show() only counts the frames
+class AddressableLight : public LightOutput, public Component {
+ public:
+  ESPColorView operator[](int32_t i) { return ESPColorView{&buf[i * 3], &buf[i * 3 + 1], &buf[i * 3 + 2]}; }
+  int32_t size() const { return 256; }
+  void schedule_show() { shows++; }
+  LightTraits get_traits() override { return {}; }
+  void write_state(LightState *) override {}
+
+  uint8_t buf[256 * 3]{};
+  uint32_t shows{0};
+};
+
+class AddressableLightState : public LightState {};
+
+}  // namespace light
+}  // namespace esphome
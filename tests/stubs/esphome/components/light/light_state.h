@@ -0,0 +1,80 @@
+#pragma once
+#include <initializer_list>
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace light {
+
+enum class ColorMode { RGB };
+
+struct LightTraits {
+  void set_supported_color_modes(std::initializer_list<ColorMode>) {}
+};
+
+struct LightColorValues {
+  bool state{true};
+  float red{1.0f}, green{1.0f}, blue{1.0f}, brightness{1.0f};
+  bool is_on() const { return state; }
+  float get_red() const { return red; }
+  float get_green() const { return green; }
+  float get_blue() const { return blue; }
+  float get_brightness() const { return brightness; }
+};
+
+class LightState;
+
+class LightOutput {
+ public:
+  virtual ~LightOutput() = default;
+  virtual LightTraits get_traits() = 0;
+  virtual void write_state(LightState *state) = 0;
+};
+
+/// Applies the call to current_values and writes the output, like a transition of zero length
+struct LightCall {
+  LightState *parent;
+  LightColorValues values;
+  LightCall &set_state(bool v) {
+    values.state = v;
+    return *this;
+  }
+  LightCall &set_rgb(float r, float g, float b) {
+    values.red = r;
+    values.green = g;
+    values.blue = b;
+    return *this;
+  }
+  LightCall &set_red(float v) {
+    values.red = v;
+    return *this;
+  }
+  LightCall &set_green(float v) {
+    values.green = v;
+    return *this;
+  }
+  LightCall &set_blue(float v) {
+    values.blue = v;
+    return *this;
+  }
+  LightCall &set_brightness(float v) {
+    values.brightness = v;
+    return *this;
+  }
+  void perform();
+};
+
+class LightState : public EntityBase, public Component {
+ public:
+  LightCall make_call() { return {this, current_values}; }
+  LightOutput *get_output() { return output_; }
+  LightColorValues current_values;
+  LightOutput *output_{nullptr};
+};
+
+inline void LightCall::perform() {
+  parent->current_values = values;
+  if (parent->output_ != nullptr) parent->output_->write_state(parent);
+}
+
+}  // namespace light
+}  // namespace esphome
@@ -0,0 +1,34 @@
+#pragma once
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace number {
+
+class Number;
+
+struct NumberCall {
+  Number *parent;
+  float value{0.0f};
+  NumberCall &set_value(float v) {
+    value = v;
+    return *this;
+  }
+  void perform();
+};
+
+class Number : public EntityBase {
+ public:
+  virtual ~Number() = default;
+  void publish_state(float value) { state = value; }
+  NumberCall make_call() { return {this}; }
+  float state{0.0f};
+
+ protected:
+  friend struct NumberCall;
+  virtual void control(float value) = 0;
+};
+
+inline void NumberCall::perform() { parent->control(value); }
+
+}  // namespace number
+}  // namespace esphome
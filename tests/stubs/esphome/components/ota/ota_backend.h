@@ -0,0 +1,29 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace esphome {
+namespace ota {
+
+enum OTAState { OTA_COMPLETED = 0, OTA_STARTED, OTA_IN_PROGRESS, OTA_ABORT, OTA_ERROR };
+
+class OTAComponent;
+
+/// Global OTA state callback; the tests call fire() to simulate an upload
+class OTAGlobalCallback {
+ public:
+  using Callback = std::function<void(OTAState, float, uint8_t, OTAComponent *)>;
+  void add_on_state_callback(Callback &&callback) { callbacks_.push_back(std::move(callback)); }
+  void fire(OTAState state, float progress = 0.0f) {
+    for (auto &callback : callbacks_) callback(state, progress, 0, nullptr);
+  }
+
+ protected:
+  std::vector<Callback> callbacks_;
+};
+
+OTAGlobalCallback *get_global_ota_callback();
+
+}  // namespace ota
+}  // namespace esphome
@@ -0,0 +1,42 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace select {
+
+struct SelectTraits {
+  std::vector<std::string> options;
+  const std::vector<std::string> &get_options() const { return options; }
+};
+
+class Select;
+
+struct SelectCall {
+  Select *parent;
+  std::string option;
+  SelectCall &set_option(const std::string &value) {
+    option = value;
+    return *this;
+  }
+  void perform();
+};
+
+class Select : public EntityBase {
+ public:
+  virtual ~Select() = default;
+  void publish_state(const std::string &value) { state = value; }
+  SelectCall make_call() { return {this, ""}; }
+  SelectTraits traits;
+  std::string state;
+
+ protected:
+  friend struct SelectCall;
+  virtual void control(const std::string &value) = 0;
+};
+
+inline void SelectCall::perform() { parent->control(option); }
+
+}  // namespace select
+}  // namespace esphome
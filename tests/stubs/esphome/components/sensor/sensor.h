@@ -0,0 +1,14 @@
+#pragma once
+#include "esphome/core/component.h"
+
+namespace esphome {
+namespace sensor {
+
+class Sensor : public EntityBase {
+ public:
+  void publish_state(float value) { state = value; }
+  float state{0.0f};
+};
+
+}  // namespace sensor
+}  // namespace esphome
@@ -0,0 +1,50 @@
+#pragma once
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cstring>
+#include <memory>
+
+namespace esphome {
+namespace socket {
+
+/// BSD socket of the host
+class Socket {
+ public:
+  explicit Socket(int fd) : fd_(fd) {}
+  ~Socket() {
+    if (fd_ >= 0) ::close(fd_);
+  }
+  int bind(const struct sockaddr *addr, socklen_t len) { return ::bind(fd_, addr, len); }
+  int setsockopt(int level, int name, const void *value, socklen_t len) {
+    return ::setsockopt(fd_, level, name, value, len);
+  }
+  ssize_t read(void *buf, size_t len) { return ::read(fd_, buf, len); }
+  int setblocking(bool blocking) {
+    int flags = fcntl(fd_, F_GETFL, 0);
+    return fcntl(fd_, F_SETFL, blocking ? (flags & ~O_NONBLOCK) : (flags | O_NONBLOCK));
+  }
+
+ protected:
+  int fd_;
+};
+
+inline std::unique_ptr<Socket> socket_ip(int type, int protocol) {
+  int fd = ::socket(AF_INET, type, protocol);
+  if (fd < 0) return nullptr;
+  return std::unique_ptr<Socket>(new Socket(fd));
+}
+
+inline socklen_t set_sockaddr_any(struct sockaddr *addr, socklen_t addrlen, uint16_t port) {
+  auto *in = reinterpret_cast<struct sockaddr_in *>(addr);
+  memset(in, 0, sizeof(*in));
+  in->sin_family = AF_INET;
+  in->sin_port = htons(port);
+  in->sin_addr.s_addr = INADDR_ANY;
+  return sizeof(*in);
+}
+
+}  // namespace socket
+}  // namespace esphome
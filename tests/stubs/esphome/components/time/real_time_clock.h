@@ -0,0 +1,19 @@
+#pragma once
+#include <ctime>
+#include <functional>
+#include "esphome/core/component.h"
+#include "esphome/core/time.h"
+
+namespace esphome {
+namespace time {
+
+/// System clock of the host
+class RealTimeClock : public PollingComponent {
+ public:
+  ESPTime now() { return ESPTime::from_epoch_local(::time(nullptr)); }
+  time_t timestamp_now() { return ::time(nullptr); }
+  void add_on_time_sync_callback(std::function<void()> callback) {}
+};
+
+}  // namespace time
+}  // namespace esphome
@@ -0,0 +1,43 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+
+class AsyncEventSourceClient;
+
+class AsyncWebHandler {
+ public:
+  virtual ~AsyncWebHandler() = default;
+};
+
+/// Server-sent events endpoint; messages go to `sink` when a test sets it
+class AsyncEventSource : public AsyncWebHandler {
+ public:
+  explicit AsyncEventSource(std::string url) : url_(std::move(url)) {}
+  void onConnect(std::function<void(AsyncEventSourceClient *)> callback) { on_connect_ = std::move(callback); }
+  void send(const char *message, const char *event = nullptr, uint32_t id = 0, uint32_t reconnect = 0) {
+    if (sink) sink(message, event, id);
+  }
+  size_t count() const { return clients; }
+
+  std::function<void(const char *, const char *, uint32_t)> sink;
+  size_t clients{0};
+
+ protected:
+  std::string url_;
+  std::function<void(AsyncEventSourceClient *)> on_connect_;
+};
+
+namespace esphome {
+namespace web_server_base {
+
+class WebServerBase {
+ public:
+  void add_handler(AsyncWebHandler *handler) { last_handler = handler; }
+  AsyncWebHandler *last_handler{nullptr};
+};
+
+extern WebServerBase *global_web_server_base;
+
+}  // namespace web_server_base
+}  // namespace esphome
@@ -0,0 +1,15 @@
+#pragma once
+
+namespace esphome {
+namespace wifi {
+
+class WiFiComponent {
+ public:
+  bool is_connected() { return connected; }
+  bool connected{true};
+};
+
+extern WiFiComponent *global_wifi_component;
+
+}  // namespace wifi
+}  // namespace esphome
@@ -0,0 +1,15 @@
+#pragma once
+#include <cstdint>
+
+namespace esphome {
+
+struct Color {
+  uint8_t r{0}, g{0}, b{0}, w{0};
+  Color() = default;
+  Color(uint8_t r, uint8_t g, uint8_t b) : r(r), g(g), b(b) {}
+  Color(uint8_t r, uint8_t g, uint8_t b, uint8_t w) : r(r), g(g), b(b), w(w) {}
+  bool operator==(const Color &o) const { return r == o.r && g == o.g && b == o.b && w == o.w; }
+  bool operator!=(const Color &o) const { return !(*this == o); }
+};
+
+}  // namespace esphome
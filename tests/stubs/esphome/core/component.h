@@ -0,0 +1,56 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+#include "esphome/core/color.h"
+#include "esphome/core/preferences.h"
+
+namespace esphome {
+
+namespace setup_priority {
+const float DATA = 600.0f;
+const float HARDWARE = 800.0f;
+const float WIFI = 250.0f;
+const float AFTER_CONNECTION = 100.0f;
+}  // namespace setup_priority
+
+class Component {
+ public:
+  virtual ~Component() = default;
+  virtual void setup() {}
+  virtual void loop() {}
+  virtual void dump_config() {}
+  virtual void on_shutdown() {}
+  virtual void on_safe_shutdown() {}
+  virtual float get_setup_priority() const { return 0.0f; }
+  void mark_failed() { failed_ = true; }
+  bool is_failed() const { return failed_; }
+  void set_interval(const std::string &, uint32_t, std::function<void()>) {}
+  void set_timeout(const std::string &, uint32_t, std::function<void()>) {}
+  void defer(std::function<void()>) {}
+
+ protected:
+  bool failed_{false};
+};
+
+class PollingComponent : public Component {
+ public:
+  virtual void update() {}
+};
+
+/// Entities hash their object id for the preference key, as on a device
+class EntityBase {
+ public:
+  void set_object_id(const std::string &object_id) {
+    uint32_t hash = 2166136261UL;
+    for (char c : object_id) hash = (hash * 16777619UL) ^ uint8_t(c);
+    object_id_hash_ = hash;
+  }
+  uint32_t get_object_id_hash() { return object_id_hash_; }
+  const char *get_name() const { return ""; }
+
+ protected:
+  uint32_t object_id_hash_{0};
+};
+
+}  // namespace esphome
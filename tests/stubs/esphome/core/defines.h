@@ -0,0 +1,2 @@
+#pragma once
+// Host build: the features come from tests/CMakeLists.txt instead of codegen
@@ -0,0 +1,12 @@
+#pragma once
+#include <cstdint>
+
+namespace esphome {
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+}  // namespace esphome
+
+void esp_restart();
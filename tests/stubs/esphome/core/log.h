@@ -0,0 +1,21 @@
+#pragma once
+#include <cstdio>
+
+namespace esphome {
+/// Set by the tests to silence the component's logging
+extern bool host_log_quiet;
+}  // namespace esphome
+
+#define HOST_LOG_(...) \
+  do { \
+    if (!esphome::host_log_quiet) { \
+      printf(__VA_ARGS__); \
+      printf("\n"); \
+    } \
+  } while (0)
+#define ESP_LOGE(tag, ...) HOST_LOG_(__VA_ARGS__)
+#define ESP_LOGW(tag, ...) HOST_LOG_(__VA_ARGS__)
+#define ESP_LOGI(tag, ...) HOST_LOG_(__VA_ARGS__)
+#define ESP_LOGD(tag, ...) HOST_LOG_(__VA_ARGS__)
+#define ESP_LOGV(tag, ...) HOST_LOG_(__VA_ARGS__)
+#define ESP_LOGCONFIG(tag, ...) HOST_LOG_(__VA_ARGS__)
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <vector>
+
+namespace esphome {
+
+/// In-memory flash: one blob per key, shared by every object with that key
+struct ESPPreferenceObject {
+  std::vector<uint8_t> *blob{nullptr};
+
+  template<class T> bool save(const T *value) {
+    if (blob == nullptr) return false;
+    blob->assign(reinterpret_cast<const uint8_t *>(value), reinterpret_cast<const uint8_t *>(value) + sizeof(T));
+    return true;
+  }
+  template<class T> bool load(T *value) {
+    if (blob == nullptr || blob->size() != sizeof(T)) return false;
+    std::memcpy(value, blob->data(), sizeof(T));
+    return true;
+  }
+};
+
+struct ESPPreferences {
+  std::map<uint32_t, std::vector<uint8_t>> store;
+
+  template<class T> ESPPreferenceObject make_preference(uint32_t key, bool = false) { return {&store[key]}; }
+};
+
+extern ESPPreferences *global_preferences;
+
+}  // namespace esphome
@@ -0,0 +1,19 @@
+#pragma once
+#include <cstdint>
+#include <ctime>
+
+namespace esphome {
+
+struct ESPTime {
+  uint8_t second, minute, hour, day_of_week, day_of_month;
+  uint16_t day_of_year;
+  uint8_t month;
+  uint16_t year;
+  bool is_dst;
+  time_t timestamp;
+
+  bool is_valid() const { return year >= 2019; }
+  static ESPTime from_epoch_local(time_t epoch);
+};
+
+}  // namespace esphome
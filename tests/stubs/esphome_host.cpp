@@ -0,0 +1,65 @@
+// Host implementations behind the stub headers
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include "esphome/core/preferences.h"
+#include "esphome/core/time.h"
+#include "esphome/components/ota/ota_backend.h"
+#include "esphome/components/web_server_base/web_server_base.h"
+#include "esphome/components/wifi/wifi_component.h"
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+
+namespace esphome {
+
+bool host_log_quiet = false;
+
+static const auto START = std::chrono::steady_clock::now();
+
+uint32_t millis() {
+  return uint32_t(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - START).count());
+}
+uint32_t micros() {
+  return uint32_t(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - START).count());
+}
+void delay(uint32_t ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+void delayMicroseconds(uint32_t us) { std::this_thread::sleep_for(std::chrono::microseconds(us)); }
+void yield() { std::this_thread::yield(); }
+
+ESPTime ESPTime::from_epoch_local(time_t epoch) {
+  struct tm t;
+  localtime_r(&epoch, &t);
+  ESPTime result;
+  result.second = t.tm_sec;
+  result.minute = t.tm_min;
+  result.hour = t.tm_hour;
+  result.day_of_week = t.tm_wday + 1;
+  result.day_of_month = t.tm_mday;
+  result.day_of_year = t.tm_yday + 1;
+  result.month = t.tm_mon + 1;
+  result.year = t.tm_year + 1900;
+  result.is_dst = t.tm_isdst;
+  result.timestamp = epoch;
+  return result;
+}
+
+static ESPPreferences preferences;
+ESPPreferences *global_preferences = &preferences;
+
+namespace wifi {
+static WiFiComponent wifi_component;
+WiFiComponent *global_wifi_component = &wifi_component;
+}  // namespace wifi
+
+namespace web_server_base {
+WebServerBase *global_web_server_base = nullptr;
+}  // namespace web_server_base
+
+namespace ota {
+static OTAGlobalCallback ota_callback;
+OTAGlobalCallback *get_global_ota_callback() { return &ota_callback; }
+}  // namespace ota
+
+}  // namespace esphome
+
+void esp_restart() { std::abort(); }
@@ -0,0 +1,39 @@
+// Allocation audit: once warmed up, the display path makes no heap
+// allocation over a simulated day, with every seconds mode and effect
+
+#include "host_clock.h"
+#include <memory>
+
+using namespace esphome::wordclock;
+
+int main() {
+  test::set_timezone(test::TZ_PARIS);
+  esphome::host_log_quiet = true;
+  int failures = 0;
+
+  // The hook must see allocations, or the zero below proves nothing
+  uint32_t before = heap_allocation_count();
+  auto probe = std::make_unique<int>(42);
+  test::check(heap_allocation_count() > before, "operator new is counted", &failures);
+
+  test::HostClock host;
+  host.start(test::EPOCH_BEFORE_DST, UINT32_MAX - 60000);
+  test::check(heap_allocation_count() > before + 1, "setup allocations counted", &failures);
+
+  // A day in six-hour slices, each with its own seconds mode and effect;
+  // 10 fps keeps the run short, the effects still render every frame
+  host.replay.set_frame_interval_ms(100);
+  for (int slice = 0; slice < 4; slice++) {
+    host.clock.set_seconds_mode(slice);
+    host.clock.set_words_effect(slice + 1);
+    host.clock.set_layer_effect(LIGHT_BACKGROUND, 4 - slice);
+    host.replay.run(6 * 3600);
+  }
+  const auto &stats = host.replay.get_stats();
+  printf("steady loops %u, steady allocations %u, worst loop %u\n", (unsigned) stats.steady_loops,
+         (unsigned) stats.steady_allocations, (unsigned) stats.max_loop_allocations);
+  test::check(stats.millis_wrapped, "millis() wrapped", &failures);
+  test::check(stats.steady_loops > 800000, "the day ran in steady state", &failures);
+  test::check(stats.steady_allocations == 0, "no steady-state allocation", &failures);
+  return failures == 0 ? 0 : 1;
+}
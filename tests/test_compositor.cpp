@@ -0,0 +1,104 @@
+// Compositor: every combination of words and seconds effect, light on/off
+// state, fade setting, seconds mode and language against the frame stream
+// checksums of the five-pass renderer compose_frame() replaced
+
+#include "host_clock.h"
+#include "led_utils.h"
+
+using namespace esphome::wordclock;
+
+static constexpr int LANGUAGES = 2;
+static constexpr int EFFECTS = 5;  // none and the four built-in effects
+static constexpr int VARIANTS = 5;
+
+/// Checksum of all effects and variants per language and seconds mode,
+/// recorded from the renderer before the single-pass compositor (with an
+/// effect counted as animating only while its light is on)
+static const uint32_t EXPECTED_CHECKSUMS[LANGUAGES][SECONDS_MODE_COUNT] = {
+    {0x699ce829, 0x774fcf69, 0x962b556e, 0xb566dba8},
+    {0x0513b9be, 0xe6298254, 0x92a44ba3, 0xe4abdb9c},
+};
+
+static const float COLORS[4][3] = {{0.0f, 0.5f, 0.5f}, {1.0f, 0.5f, 0.0f}, {0.5f, 0.0f, 1.0f}, {0.1f, 0.1f, 0.1f}};
+
+static void set_light(test::HostClock &host, int type, bool on, const float *rgb) {
+  auto call = host.light_states[type].make_call();
+  call.set_state(on);
+  call.set_rgb(rgb[0], rgb[1], rgb[2]);
+  call.set_brightness(0.5f);
+  call.perform();
+}
+
+static bool excluded_leds_dark(const test::HostClock &host) {
+  for (int led = 0; led < 256; led++) {
+    if (!is_excluded_led(led)) continue;
+    for (int c = 0; c < 3; c++) {
+      if (host.strip.buf[led * 3 + c] != 0) return false;
+    }
+  }
+  return true;
+}
+
+/// Variants: 0 background off then on, 1 hours off then on, 2 seconds off
+/// with instant word changes, 3 minutes off with a long seconds trail,
+/// 4 black background
+static uint32_t run(int language, int mode, int effect, int variant, bool *excluded_dark) {
+  test::HostClock host;
+  host.start(test::EPOCH_BEFORE_DST + 11 * 60 + 30);
+  host.replay.set_frame_interval_ms(40);
+  host.clock.set_language(language);
+  host.clock.set_seconds_mode(mode);
+  host.clock.set_words_effect(effect);
+  host.clock.set_seconds_effect((effect + 1) % EFFECTS);
+
+  bool on[4] = {variant != 1, variant != 3, variant != 2, variant != 0};
+  static const float BLACK[3] = {0.0f, 0.0f, 0.0f};
+  for (int t = 0; t < 4; t++) set_light(host, t, on[t], t == LIGHT_BACKGROUND && variant == 4 ? BLACK : COLORS[t]);
+  if (variant == 2) {
+    host.clock.set_words_fade_out_duration(0.0f);
+    host.clock.set_typing_delay(0.0f);
+  }
+  if (variant == 3) {
+    host.clock.set_seconds_fade_out_duration(5.0f);
+    host.clock.set_words_fade_in_duration(0.0f);
+  }
+
+  for (int s = 0; s < 90; s++) {
+    if (s == 45 && variant == 0) set_light(host, LIGHT_BACKGROUND, true, COLORS[LIGHT_BACKGROUND]);
+    if (s == 45 && variant == 1) set_light(host, LIGHT_HOURS, true, COLORS[LIGHT_HOURS]);
+    host.replay.run(1);
+    *excluded_dark = *excluded_dark && excluded_leds_dark(host);
+  }
+  return host.replay.get_stats().checksum;
+}
+
+int main() {
+  test::set_timezone(test::TZ_PARIS);
+  esphome::host_log_quiet = true;
+  int failures = 0;
+  bool excluded_dark = true;
+
+  for (int language = 0; language < LANGUAGES; language++) {
+    for (int mode = 0; mode < SECONDS_MODE_COUNT; mode++) {
+      uint32_t checksum = 2166136261UL;
+      for (int effect = 0; effect < EFFECTS; effect++) {
+        for (int variant = 0; variant < VARIANTS; variant++) {
+          checksum = (checksum ^ run(language, mode, effect, variant, &excluded_dark)) * 16777619UL;
+        }
+      }
+      printf("language %d mode %d: checksum=%08x\n", language, mode, checksum);
+      test::check(checksum == EXPECTED_CHECKSUMS[language][mode], "frame stream checksum", &failures);
+    }
+  }
+  test::check(excluded_dark, "excluded LEDs stay dark", &failures);
+
+  // Every light off: nothing but fades left, then a black strip
+  test::HostClock host;
+  host.start(test::EPOCH_BEFORE_DST);
+  for (int t = 0; t < 4; t++) set_light(host, t, false, COLORS[t]);
+  host.replay.run(5);
+  bool black = true;
+  for (uint8_t byte : host.strip.buf) black = black && byte == 0;
+  test::check(black, "all lights off leave the strip black", &failures);
+  return failures == 0 ? 0 : 1;
+}
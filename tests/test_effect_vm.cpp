@@ -0,0 +1,56 @@
+// Effect programs: loads are compiled and verified on the loop thread and
+// committed by the renderer; a load whose command the full render queue
+// drops is rolled back instead of blocking every later load
+
+#include "host_clock.h"
+#include <thread>
+
+using namespace esphome::wordclock;
+
+static const char *const ONE_OP = "mul r r 0.5";
+static const char *const TWO_OPS = "mul r r 0.5\nmul g g 0.5";
+static const char *const THREE_OPS = "mul r r 0.5\nmul g g 0.5\nmul b b 0.5";
+
+int main() {
+  test::set_timezone(test::TZ_PARIS);
+  esphome::host_log_quiet = true;
+  int failures = 0;
+  test::HostClock host;
+  host.start(test::EPOCH_BEFORE_DST);
+
+  // Without the render task a load applies at once
+  test::check(host.clock.load_effect_program(0, ONE_OP), "valid program loaded", &failures);
+  test::check(host.clock.get_effect_program(0).size == 1, "program in its slot", &failures);
+  test::check(!host.clock.load_effect_program(0, "mul r r"), "missing operand rejected", &failures);
+  test::check(!host.clock.load_effect_program(0, "jump r"), "unknown instruction rejected", &failures);
+  test::check(host.clock.get_effect_program(0).size == 1, "rejected loads leave the slot alone", &failures);
+
+  if (!test::check(host.start_render_task(), "render task started", &failures)) return 1;
+
+  // Flood the queue between two renderer wakeups until a load is dropped
+  bool dropped = false;
+  for (int attempt = 0; attempt < 200 && !dropped; attempt++) {
+    host.flood_render_queue();
+    dropped = !host.clock.load_effect_program(1, TWO_OPS);
+    if (!dropped) std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  }
+  if (!test::check(dropped, "a load hit the full queue", &failures)) return 1;
+
+  // Once the renderer has drained the queue, the next load goes through
+  bool loaded = false;
+  for (int i = 0; i < 100 && !loaded; i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    loaded = host.clock.load_effect_program(1, THREE_OPS);
+  }
+  test::check(loaded, "a dropped load does not block the next one", &failures);
+
+  // A later load is only staged once the renderer committed the previous one
+  bool committed = false;
+  for (int i = 0; i < 100 && loaded && !committed; i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    committed = host.clock.load_effect_program(2, ONE_OP);
+  }
+  test::check(committed && host.clock.get_effect_program(1).size == 3, "the renderer committed the load",
+              &failures);
+  return failures == 0 ? 0 : 1;
+}
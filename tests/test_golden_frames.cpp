@@ -0,0 +1,41 @@
+// Golden frames: every second of the day, every language and seconds mode,
+// against golden_frames_data.h
+//
+//   golden_frames             verify (exit 1 on any mismatch)
+//   golden_frames --generate  print a new golden_frames_data.h
+
+#include "host_clock.h"
+#include "golden_frames.h"
+#include <cstring>
+
+using namespace esphome::wordclock;
+
+int main(int argc, char **argv) {
+  test::set_timezone("UTC0");
+  esphome::host_log_quiet = true;
+  test::HostClock host;
+  host.start(test::EPOCH_BEFORE_DST);
+
+  if (argc > 1 && strcmp(argv[1], "--generate") == 0) {
+    std::string data = golden::generate_golden_frames(&host.clock);
+    fputs(data.c_str(), stdout);
+    return data.empty() ? 1 : 0;
+  }
+
+  int failures = 0;
+#ifdef USE_WORDCLOCK_RENDER_TASK
+  // The render task owns the display state: the verification must refuse
+  test::check(host.start_render_task(), "render task started", &failures);
+  esphome::host_log_quiet = false;
+  auto report = golden::verify_golden_frames(&host.clock);
+  test::check(report.refused && report.checked == 0, "verification refused while the render task runs", &failures);
+  test::check(golden::generate_golden_frames(&host.clock).empty(), "generation refused while the render task runs",
+              &failures);
+#else
+  esphome::host_log_quiet = false;  // failing phrases are logged
+  auto report = golden::verify_golden_frames(&host.clock);
+  test::check(report.checked == 691200, "every second of every language and mode checked", &failures);
+  test::check(report.passed(), "no golden frame mismatch", &failures);
+#endif
+  return failures == 0 ? 0 : 1;
+}
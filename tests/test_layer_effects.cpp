@@ -0,0 +1,151 @@
+// Layer effects: the words and effect speed controls leave the layers with
+// their own control alone whatever the restore order, the layers running
+// an effect program share the frame budget, and a layer whose light is
+// off does not keep the clock animating; a palette expands into a seamless
+// LUT at the layer brightness
+
+#include "host_clock.h"
+#include "palette.h"
+#include <algorithm>
+#include <cstdlib>
+#include <set>
+
+using namespace esphome;
+using namespace esphome::wordclock;
+
+/// Background hue by column, 9 cycles per LED
+static const char *const COLUMN_HUES = "mul s0 x 0.0625\nhsv r s0 0.5";
+static const char *const HALF_RED = "mul r r 0.5";
+
+static int test_controls() {
+  int failures = 0;
+  for (bool words_first : {false, true}) {
+    test::HostClock host;
+    // Codegen: an hours effect select and an hours effect speed number
+    host.clock.add_layer_control(CMD_LAYER_EFFECT, LIGHT_HOURS);
+    host.clock.add_layer_control(CMD_LAYER_EFFECT_SPEED, LIGHT_HOURS);
+    host.start(test::EPOCH_BEFORE_DST);
+    // Boot restore, in either order
+    if (words_first) host.clock.set_words_effect(EFFECT_RAINBOW);
+    host.clock.set_layer_effect(LIGHT_HOURS, EFFECT_BREATHE);
+    host.clock.set_layer_effect_speed(LIGHT_HOURS, 3.0f);
+    if (!words_first) host.clock.set_words_effect(EFFECT_RAINBOW);
+    host.clock.set_effect_speed(0.5f);
+    test::check(host.clock.get_layer_effect(LIGHT_HOURS) == EFFECT_BREATHE, "hours keeps its own effect",
+                &failures);
+    test::check(host.clock.get_layer_effect(LIGHT_MINUTES) == EFFECT_RAINBOW, "words effect on the minutes",
+                &failures);
+    test::check(host.clock.get_layer_effect_speed(LIGHT_HOURS) == 3.0f, "hours keeps its own speed", &failures);
+    test::check(host.clock.get_layer_effect_speed(LIGHT_MINUTES) == 0.5f &&
+                    host.clock.get_layer_effect_speed(LIGHT_BACKGROUND) == 0.5f,
+                "effect speed on the other layers", &failures);
+  }
+
+  // Without dedicated controls the words effect drives both layers
+  test::HostClock host;
+  host.start(test::EPOCH_BEFORE_DST);
+  host.clock.set_layer_effect(LIGHT_HOURS, EFFECT_BREATHE);
+  host.clock.set_words_effect(EFFECT_RAINBOW);
+  test::check(host.clock.get_layer_effect(LIGHT_HOURS) == EFFECT_RAINBOW &&
+                  host.clock.get_layer_effect(LIGHT_MINUTES) == EFFECT_RAINBOW,
+              "words effect on both layers", &failures);
+  return failures;
+}
+
+/// Distinct colours on the strip with the background program, and the
+/// words programs too or not
+static int strip_colors(bool words_programs) {
+  test::HostClock host;
+  host.start(test::EPOCH_BEFORE_DST + 30);
+  host.clock.load_effect_program(0, COLUMN_HUES);
+  host.clock.load_effect_program(1, HALF_RED);
+  host.clock.set_layer_effect(LIGHT_BACKGROUND, EFFECT_PROGRAM + 0);
+  if (words_programs) host.clock.set_words_effect(EFFECT_PROGRAM + 1);
+  host.replay.run(2);
+  std::set<uint32_t> colors;
+  for (int led = 0; led < 256; led++) {
+    const uint8_t *c = host.strip.buf + led * 3;
+    colors.insert(uint32_t(c[0]) << 16 | uint32_t(c[1]) << 8 | c[2]);
+  }
+  return int(colors.size());
+}
+
+static int test_budget() {
+  int failures = 0;
+  int alone = strip_colors(false);
+  int shared = strip_colors(true);
+  test::check(alone > 10, "background program alone runs per LED", &failures);
+  // Three program layers: a third of the budget each, the background gets one colour
+  test::check(shared < alone / 2, "background program downgraded when the budget is shared", &failures);
+  return failures;
+}
+
+/// Frames the throttle skipped in 10 s of slow loops: only counted while
+/// the clock animates
+static uint32_t animated_frames(bool background_on) {
+  test::HostClock host;
+  host.clock.set_throttle(100, 0, false);
+  host.start(test::EPOCH_BEFORE_DST + 10);
+  host.clock.set_seconds_fade_out_duration(0.0f);
+  host.clock.set_words_effect(EFFECT_NONE);
+  host.clock.set_seconds_effect(EFFECT_NONE);
+  host.clock.set_layer_effect(LIGHT_BACKGROUND, EFFECT_RAINBOW);
+  auto call = host.light_states[LIGHT_BACKGROUND].make_call();
+  call.set_state(background_on);
+  call.perform();
+  host.replay.set_frame_interval_ms(300);
+  host.replay.set_speed(0.0f);
+  host.replay.run(3);
+  uint32_t skipped = host.clock.get_throttle().frames_skipped();
+  host.replay.run(10);
+  return host.clock.get_throttle().frames_skipped() - skipped;
+}
+
+static int test_animation() {
+  int failures = 0;
+  test::check(animated_frames(true) > 10, "background effect animates", &failures);
+  test::check(animated_frames(false) == 0, "background effect with its light off does not", &failures);
+  return failures;
+}
+
+static int max_step(const PaletteLut &lut) {
+  int step = 0;
+  for (int i = 0; i < 256; i++) {
+    Color a = lut.sample(uint8_t(i)), b = lut.sample(uint8_t(i + 1));
+    step = std::max({step, std::abs(a.r - b.r), std::abs(a.g - b.g), std::abs(a.b - b.b)});
+  }
+  return step;
+}
+
+static int test_palette() {
+  int failures = 0;
+  // Red at 0, blue at 128: blue back to red across 255 -> 0
+  Palette palette;
+  palette.count = 2;
+  palette.positions = {0, 128};
+  palette.colors[0] = Color(255, 0, 0);
+  palette.colors[1] = Color(0, 0, 255);
+
+  PaletteLut full;
+  full.update(&palette, 1.0f);
+  test::check(full.sample(0) == Color(255, 0, 0) && full.sample(128) == Color(0, 0, 255), "both stop colours",
+              &failures);
+  test::check(max_step(full) <= 2, "no seam, 255 -> 0 included", &failures);
+
+  PaletteLut half;
+  half.update(&palette, 0.5f);
+  bool scaled = true;
+  for (int i = 0; i < 256; i++) {
+    Color a = full.sample(uint8_t(i)), b = half.sample(uint8_t(i));
+    scaled = scaled && b.r == a.r / 2 && b.g == a.g / 2 && b.b == a.b / 2;
+  }
+  test::check(scaled, "LUT scaled by the brightness", &failures);
+  return failures;
+}
+
+int main() {
+  test::set_timezone(test::TZ_PARIS);
+  host_log_quiet = true;
+  int failures = test_controls() + test_budget() + test_animation() + test_palette();
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,149 @@
+// Marquee: glyph placement on the letter grid, scroll timing from the
+// start time only, the clock untouched underneath, and a message dropped
+// by the full render queue rolled back instead of blocking the next one
+
+#include "host_clock.h"
+#include "marquee.h"
+#include <cstring>
+#include <thread>
+
+using namespace esphome::wordclock;
+
+static bool same(const LedSet &a, const LedSet &b) {
+  for (int led = 0; led < 256; led++) {
+    if (a.contains(led) != b.contains(led)) return false;
+  }
+  return true;
+}
+
+static int test_scroll() {
+  int failures = 0;
+  int misplaced = 0;
+  for (int col = 0; col < GRID_COLS; col++) {
+    for (int row = 0; row < MARQUEE_GLYPH_HEIGHT; row++) {
+      int r, c;
+      misplaced += !get_led_grid_pos(MARQUEE_LEDS[col][row], &r, &c) || r != MARQUEE_TOP_ROW + row || c != col;
+    }
+  }
+  test::check(misplaced == 0, "MARQUEE_LEDS matches get_led_grid_pos()", &failures);
+
+  // 1000 columns per second: one column per ms, "I" crosses in 5 + 13 ms
+  Marquee marquee;
+  marquee.set_speed(1000.0f);
+  test::check(marquee.stage("I", 1), "message staged", &failures);
+  test::check(!marquee.stage("J", 1), "second message refused until the first starts", &failures);
+  marquee.commit(1000);
+  LedSet lit;
+  test::check(marquee.render(1000, lit) && lit.empty(), "enters from the right edge", &failures);
+  lit.clear();
+  marquee.render(1000 + GRID_COLS, lit);
+  bool in_rows = !lit.empty();
+  lit.for_each([&](int led) {
+    int r, c;
+    in_rows = in_rows && get_led_grid_pos(led, &r, &c) && r >= MARQUEE_TOP_ROW &&
+              r < MARQUEE_TOP_ROW + MARQUEE_GLYPH_HEIGHT && c < MARQUEE_GLYPH_WIDTH;
+  });
+  test::check(in_rows, "glyph at the left edge on the glyph rows", &failures);
+  lit.clear();
+  test::check(!marquee.render(1000 + GRID_COLS + 5, lit) && !marquee.active(), "stops after its passes",
+              &failures);
+
+  // Position from the start time only: any frame sequence, same window
+  Marquee a, b;
+  a.set_speed(8.0f);
+  b.set_speed(8.0f);
+  a.stage("Hello", 0);
+  b.stage("Hello", 0);
+  a.commit(5000);
+  b.commit(5000);
+  int differ = 0;
+  for (uint32_t t = 5000; t < 25000; t += 20) {
+    LedSet la, lb;
+    a.render(t, la);
+    if (t % 140 == 0) {
+      b.render(t, lb);
+      differ += !same(la, lb);
+    }
+  }
+  test::check(differ == 0, "window independent of the frame rate", &failures);
+
+  // Unknown UTF-8 characters are one '?' each
+  Marquee unknown, question;
+  unknown.set_speed(1000.0f);
+  question.set_speed(1000.0f);
+  unknown.stage("\xC3\xA9", 1);
+  question.stage("?", 1);
+  unknown.commit(0);
+  question.commit(0);
+  LedSet lu, lq;
+  unknown.render(GRID_COLS, lu);
+  question.render(GRID_COLS, lq);
+  test::check(same(lu, lq) && !lu.empty(), "unknown character shows as ?", &failures);
+  return failures;
+}
+
+/// The strip a minute in, with a message shown at the start or not
+static void run_clock(bool message, uint8_t *strip, int *blue, int *other) {
+  test::HostClock host;
+  host.clock.set_marquee(0x0000FF, 8.0f, 1);
+  host.start(test::EPOCH_BEFORE_DST + 30);
+  host.replay.run(2);
+  if (message) host.clock.show_marquee("12\xC2\xB0" "C");
+  host.replay.run(1);
+  // Grid LEDs are the marquee colour or black while it scrolls
+  *blue = *other = 0;
+  for (int row = 0; row < GRID_ROWS; row++) {
+    for (int col = 0; col < GRID_COLS; col++) {
+      const uint8_t *c = host.strip.buf + get_grid_led(row, col) * 3;
+      bool is_blue = c[0] == 0 && c[1] == 0 && c[2] == 255;
+      *blue += is_blue;
+      *other += !is_blue && (c[0] | c[1] | c[2]) != 0;
+    }
+  }
+  host.replay.run(60);
+  memcpy(strip, host.strip.buf, sizeof(host.strip.buf));
+}
+
+static int test_clock() {
+  int failures = 0;
+  uint8_t plain[768], shown[768];
+  int blue, other;
+  run_clock(false, plain, &blue, &other);
+  test::check(blue == 0 && other > 0, "clock lit without a message", &failures);
+  run_clock(true, shown, &blue, &other);
+  test::check(blue > 0 && other == 0, "grid shows only the message while it scrolls", &failures);
+  // Across a minute change, after the message: as if it never ran
+  test::check(memcmp(plain, shown, sizeof(plain)) == 0, "clock unchanged once the message is gone", &failures);
+  return failures;
+}
+
+static int test_dropped() {
+  int failures = 0;
+  test::HostClock host;
+  host.start(test::EPOCH_BEFORE_DST);
+  if (!test::check(host.start_render_task(), "render task started", &failures)) return failures;
+
+  // Flood the queue between two renderer wakeups until a message is dropped
+  bool dropped = false;
+  for (int attempt = 0; attempt < 200 && !dropped; attempt++) {
+    host.flood_render_queue();
+    dropped = !host.clock.show_marquee("Hello");
+    if (!dropped) std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  }
+  if (!test::check(dropped, "a message hit the full queue", &failures)) return failures;
+
+  bool shown = false;
+  for (int i = 0; i < 100 && !shown; i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    shown = host.clock.show_marquee("Hello");
+  }
+  test::check(shown, "a dropped message does not block the next one", &failures);
+  return failures;
+}
+
+int main() {
+  test::set_timezone(test::TZ_PARIS);
+  esphome::host_log_quiet = true;
+  int failures = test_scroll() + test_clock() + test_dropped();
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,84 @@
+// Two clocks on one device: each keeps its own light colours across a
+// restart, and stepping them alternately renders what each renders alone
+
+#include "host_clock.h"
+#include <memory>
+
+using namespace esphome;
+using namespace esphome::wordclock;
+
+static void set_color(test::HostClock &host, LightType type, float r, float g, float b) {
+  auto call = host.light_states[type].make_call();
+  call.set_state(true);
+  call.set_rgb(r, g, b);
+  call.set_brightness(0.8f);
+  call.perform();
+}
+
+static bool has_color(const test::HostClock &host, LightType type, float r, float g, float b) {
+  const auto &values = host.light_states[type].current_values;
+  return values.red == r && values.green == g && values.blue == b;
+}
+
+static uint32_t run_alone(const char *id, int language, uint32_t seconds) {
+  auto host = std::make_unique<test::HostClock>(id);
+  host->start(test::EPOCH_BEFORE_DST);
+  host->clock.set_language(language);
+  return host->replay.run(seconds).checksum;
+}
+
+int main() {
+  test::set_timezone(test::TZ_PARIS);
+  host_log_quiet = true;
+  int failures = 0;
+
+  {
+    // Colours saved by a single clock under the type-only key
+    light::LightState state;
+    WordClockLight legacy;
+    legacy.set_light_type(LIGHT_HOURS);
+    state.output_ = &legacy;
+    legacy.setup();
+    legacy.write_state(&state);
+    auto call = state.make_call();
+    call.set_rgb(1.0f, 0.0f, 0.0f);
+    call.perform();
+  }
+
+  {
+    auto a = std::make_unique<test::HostClock>("wall_a");
+    auto b = std::make_unique<test::HostClock>("wall_b");
+    a->start(test::EPOCH_BEFORE_DST);
+    b->start(test::EPOCH_BEFORE_DST);
+    test::check(has_color(*a, LIGHT_HOURS, 1.0f, 0.0f, 0.0f) && has_color(*b, LIGHT_HOURS, 1.0f, 0.0f, 0.0f),
+                "type-only colours adopted by the per-light keys", &failures);
+    set_color(*a, LIGHT_HOURS, 0.0f, 0.0f, 1.0f);
+    set_color(*b, LIGHT_HOURS, 0.0f, 1.0f, 0.0f);
+    set_color(*b, LIGHT_BACKGROUND, 1.0f, 1.0f, 0.0f);
+  }
+
+  // Restart: each clock restores its own colours
+  auto a = std::make_unique<test::HostClock>("wall_a");
+  auto b = std::make_unique<test::HostClock>("wall_b");
+  a->start(test::EPOCH_BEFORE_DST);
+  b->start(test::EPOCH_BEFORE_DST);
+  test::check(has_color(*a, LIGHT_HOURS, 0.0f, 0.0f, 1.0f), "first clock restores its hours colour", &failures);
+  test::check(has_color(*b, LIGHT_HOURS, 0.0f, 1.0f, 0.0f), "second clock restores its hours colour", &failures);
+  test::check(!has_color(*a, LIGHT_BACKGROUND, 1.0f, 1.0f, 0.0f), "background colour not shared", &failures);
+
+  // Per-instance language and pool state: interleaving changes nothing
+  a->clock.set_language(LANG_FRENCH);
+  b->clock.set_language(LANG_ENGLISH_UK);
+  for (int s = 0; s < 120; s++) {
+    a->replay.run(1);
+    b->replay.run(1);
+  }
+  uint32_t a_checksum = a->replay.get_stats().checksum;
+  uint32_t b_checksum = b->replay.get_stats().checksum;
+  test::check(a_checksum != b_checksum, "the clocks render their own colours", &failures);
+  test::check(a_checksum == run_alone("wall_a", LANG_FRENCH, 120), "first clock renders as it does alone",
+              &failures);
+  test::check(b_checksum == run_alone("wall_b", LANG_ENGLISH_UK, 120), "second clock renders as it does alone",
+              &failures);
+  return failures == 0 ? 0 : 1;
+}
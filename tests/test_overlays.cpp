@@ -0,0 +1,137 @@
+// Overlays: the queue keeps priority order in its fixed slots, the level
+// fades and blinks, and a shown overlay changes only its own LEDs while
+// the clock underneath (fades, typing, minute change) carries on unchanged
+
+#include "host_clock.h"
+#include "overlay.h"
+#include <array>
+#include <cstring>
+#include <vector>
+
+using namespace esphome;
+using namespace esphome::wordclock;
+
+static constexpr uint32_t FRAME_MS = 20;
+static constexpr int FRAMES_PER_SECOND = 1000 / FRAME_MS;
+static constexpr int SHOW_AT = 8;  // two seconds before the minute change (01:59)
+static constexpr int SECONDS = 20;
+
+enum Scenario { NONE, DOORBELL, CLEARED };
+
+struct Run {
+  std::vector<uint32_t> frames;
+  std::array<uint8_t, 768> shown{};  ///< Strip a second after SHOW_AT
+};
+
+static bool is_red(const uint8_t *c) { return c[0] == 255 && c[1] == 0 && c[2] == 0; }
+
+static Run run(Scenario scenario, int language) {
+  test::HostClock host;
+  // The "42" and the minute word that goes off at the minute change (HUIT, TWO)
+  host.clock.add_overlay("doorbell", 0xFF0000, OVERLAY_REPLACE, 5, 3000, 0, {}, {"8", "2"}, {"42"});
+  host.clock.add_overlay("timer", 0x00FF00, OVERLAY_ADD, 1, 20000, 250, {"il", "est", "it", "is"},
+                         {"et", "past"}, {});
+  host.start(test::EPOCH_BEFORE_DST + 58 * 60 + 50);
+  host.replay.set_frame_interval_ms(FRAME_MS);
+  host.clock.set_language(language);
+  host.clock.set_words_effect(1);
+  // Still fading out when the overlay ends
+  host.clock.set_words_fade_out_duration(3.0f);
+
+  Run result;
+  host.replay.set_frame_callback([&result](uint32_t, uint32_t checksum) { result.frames.push_back(checksum); });
+  for (int s = 0; s < SECONDS; s++) {
+    if (s == SHOW_AT && scenario != NONE) {
+      host.clock.show_overlay(std::string("doorbell"));
+      if (scenario == CLEARED) host.clock.show_overlay(1);
+    }
+    if (s == SHOW_AT + 1 && scenario == CLEARED) host.clock.clear_overlays();
+    host.replay.run(1);
+    if (s == SHOW_AT) memcpy(result.shown.data(), host.strip.buf, result.shown.size());
+  }
+  return result;
+}
+
+/// Same frame stream between two runs over [from_s, to_s)
+static bool frames_equal(const Run &a, const Run &b, int from_s, int to_s) {
+  for (int f = from_s * FRAMES_PER_SECOND; f < to_s * FRAMES_PER_SECOND; f++) {
+    if (f >= (int) a.frames.size() || f >= (int) b.frames.size() || a.frames[f] != b.frames[f]) return false;
+  }
+  return true;
+}
+
+static int test_queue() {
+  int failures = 0;
+  OverlayQueue queue;
+  // Priorities 0 1 2 0 1 2 into four slots: the oldest of the lowest goes first
+  bool pushed[6];
+  for (int i = 0; i < 6; i++) pushed[i] = queue.push({uint8_t(i), uint8_t(i % 3), 0, 100});
+  test::check(queue.size() == config::OVERLAY_SLOTS, "queue holds OVERLAY_SLOTS", &failures);
+  test::check(pushed[4] && pushed[5], "higher priorities evict the lowest", &failures);
+  test::check(queue[0].preset == 1 && queue[1].preset == 4 && queue[2].preset == 2 && queue[3].preset == 5,
+              "ascending priority, newer on top of equals", &failures);
+  test::check(!queue.push({6, 0, 0, 100}), "lower priority than every slot dropped", &failures);
+  test::check(queue.push({4, 3, 50, 100}) && queue[3].preset == 4 && queue.size() == 4,
+              "a preset shown again moves instead of duplicating", &failures);
+  queue.expire(100);
+  test::check(queue.size() == 1 && queue[0].preset == 4, "expired overlays dropped", &failures);
+  queue.clear();
+  test::check(queue.empty(), "clear empties the queue", &failures);
+
+  uint32_t fade = config::OVERLAY_FADE_MS;
+  test::check(overlay_level(0, 1000, 0) == 0 && overlay_level(fade / 2, 1000, 0) == 127, "fades in", &failures);
+  test::check(overlay_level(500, 1000, 0) == 255, "full level between the fades", &failures);
+  test::check(overlay_level(1000 - fade / 2, 1000, 0) == 127 && overlay_level(1000, 1000, 0) == 0, "fades out",
+              &failures);
+  test::check(overlay_level(300, 1000, 250) == 0 && overlay_level(550, 1000, 250) == 255, "blinks", &failures);
+
+  Color under(200, 100, 0);
+  Color over(100, 200, 50);
+  Color added = overlay_blend(under, over, 255, OVERLAY_ADD);
+  Color mixed = overlay_blend(under, over, 255, OVERLAY_MIX);
+  Color replaced = overlay_blend(under, over, 255, OVERLAY_REPLACE);
+  test::check(added.r == 255 && added.g == 255 && added.b == 50, "add saturates", &failures);
+  test::check(mixed.r == 151 && mixed.g == 149 && mixed.b == 24, "mix is half and half", &failures);
+  test::check(replaced.r == 100 && replaced.g == 200 && replaced.b == 50, "replace at full level", &failures);
+  return failures;
+}
+
+static int test_clock(int language) {
+  int failures = 0;
+  Run plain = run(NONE, language);
+  Run doorbell = run(DOORBELL, language);
+  Run cleared = run(CLEARED, language);
+
+  // A second in, at full level: only the overlay LEDs differ, all in its colour
+  int red = 0, other_changes = 0;
+  for (int led = 0; led < 256; led++) {
+    const uint8_t *under = plain.shown.data() + led * 3;
+    const uint8_t *over = doorbell.shown.data() + led * 3;
+    red += is_red(over);
+    other_changes += memcmp(under, over, 3) != 0 && !is_red(over);
+  }
+  test::check(red >= 8, "the 42 shows in the overlay colour", &failures);
+  test::check(other_changes == 0, "no other LED changes", &failures);
+  test::check(frames_equal(plain, doorbell, 0, SHOW_AT), "frames unchanged before the overlay", &failures);
+  test::check(!frames_equal(plain, doorbell, SHOW_AT, SHOW_AT + 3), "the overlay is shown", &failures);
+  // Expired 3 s after SHOW_AT, with the minute word fading out underneath:
+  // the fade started from the clock colour, not the overlay's
+  test::check(frames_equal(plain, doorbell, SHOW_AT + 4, SECONDS), "frames match the clock after expiry",
+              &failures);
+  test::check(frames_equal(plain, cleared, SHOW_AT + 2, SECONDS), "clear_overlays() restores the clock at once",
+              &failures);
+  return failures;
+}
+
+int main() {
+  test::set_timezone(test::TZ_PARIS);
+  host_log_quiet = true;
+  int failures = test_queue();
+  for (int language = 0; language < 2; language++) failures += test_clock(language);
+
+  test::HostClock host;
+  host.clock.add_overlay("doorbell", 0xFF0000, OVERLAY_REPLACE, 5, 3000, 0, {}, {}, {"42"});
+  host.start(test::EPOCH_BEFORE_DST);
+  test::check(!host.clock.show_overlay(std::string("doorbel")), "unknown overlay name refused", &failures);
+  return failures == 0 ? 0 : 1;
+}
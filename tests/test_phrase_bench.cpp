@@ -0,0 +1,44 @@
+// Phrase engine benchmark driver: prints the timing table, checks that
+// every engine matches the bytecode engine minute by minute without
+// allocating, and that the benchmark refuses to run beside the render task
+//
+//   phrase_bench [step] [rounds]   defaults 1 s and 3 rounds (CTest: 10 1)
+
+#include "host_clock.h"
+#include "phrase_bench.h"
+#include <cstdlib>
+
+using namespace esphome::wordclock;
+
+int main(int argc, char **argv) {
+  test::set_timezone(test::TZ_PARIS);
+  int step = argc > 1 ? atoi(argv[1]) : 1;
+  int rounds = argc > 2 ? atoi(argv[2]) : 3;
+  int failures = 0;
+
+  esphome::host_log_quiet = true;
+  test::HostClock host;
+  host.start(test::EPOCH_BEFORE_DST);
+  int language = host.clock.get_language();
+
+  esphome::host_log_quiet = false;  // the table is the output
+  auto results = bench::run_phrase_benchmark(&host.clock, step, rounds);
+  esphome::host_log_quiet = true;
+
+  int languages = 0;
+  for (int lang = 0; lang < LANG_COUNT; lang++) languages += WordClock::has_language(lang);
+  test::check(int(results.size()) == languages * PHRASE_ENGINE_COUNT, "every language and engine timed",
+              &failures);
+  for (const auto &r : results) {
+    test::check(r.matches, "same LED lists as the bytecode engine", &failures);
+    test::check(r.allocs_per_call == 0.0f, "no allocation per call", &failures);
+    test::check(r.leds_ns > 0.0f && r.calls == uint32_t((86400 + step - 1) / step), "timed over the day",
+                &failures);
+  }
+  test::check(host.clock.get_language() == language, "language restored", &failures);
+
+  test::check(host.start_render_task(), "render task started", &failures);
+  test::check(bench::run_phrase_benchmark(&host.clock, 3600, 1).empty(), "refused while the render task runs",
+              &failures);
+  return failures == 0 ? 0 : 1;
+}
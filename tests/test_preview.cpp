@@ -0,0 +1,207 @@
+// Preview stream: keyframes and deltas decode back to the frame that was
+// captured, the encoder stays within its buffers for any 256-LED frame,
+// and the stream sends the clock's presented frames
+
+#include "host_clock.h"
+#include "preview_stream.h"
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace esphome;
+using namespace esphome::wordclock;
+
+/// Client side of the wire format: base64, then RLE tokens XORed into the
+/// previous frame (black for a keyframe)
+struct PreviewDecoder {
+  std::vector<uint8_t> frame;
+  std::vector<uint8_t> rle;  ///< Payload of the last message
+  bool ok{true};
+
+  void decode(const char *message, bool keyframe) {
+    const char *p = message;
+    if (keyframe) {
+      int count = 0;
+      while (*p >= '0' && *p <= '9') count = count * 10 + (*p++ - '0');
+      ok = ok && *p++ == ',';
+      frame.assign(count * 3, 0);
+    }
+    rle.clear();
+    uint32_t bits = 0;
+    int nbits = 0;
+    for (; *p != '\0' && *p != '='; p++) {
+      const char *pos = strchr(ALPHABET, *p);
+      if (pos == nullptr) {
+        ok = false;
+        return;
+      }
+      bits = (bits << 6) | uint32_t(pos - ALPHABET);
+      nbits += 6;
+      if (nbits >= 8) {
+        nbits -= 8;
+        rle.push_back(uint8_t(bits >> nbits));
+      }
+    }
+    size_t out = 0, i = 0;
+    while (i < rle.size()) {
+      uint8_t token = rle[i++];
+      int pixels = token < 0x80 ? token + 1 : token - 0x7F;
+      for (int n = 0; n < pixels; n++) {
+        const uint8_t *pixel = &rle[token < 0x80 ? i : i + n * 3];
+        for (int c = 0; c < 3; c++, out++) {
+          if (out >= frame.size()) {
+            ok = false;
+            return;
+          }
+          frame[out] ^= pixel[c];
+        }
+      }
+      i += token < 0x80 ? 3 : pixels * 3;
+    }
+    ok = ok && i == rle.size() && out == frame.size();
+  }
+
+  static constexpr const char *ALPHABET = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+};
+
+static FrameBuffer make_frame(int num_leds, uint32_t seed, int pattern) {
+  FrameBuffer frame{};
+  for (int i = 0; i < num_leds; i++) {
+    switch (pattern) {
+      case 0:  // every LED different
+        frame[i] = Color(uint8_t(i), uint8_t(i * 7 + seed), uint8_t(255 - i));
+        break;
+      case 1:  // one LED then a pair, repeated: the densest token stream
+        frame[i] = Color(uint8_t(i / 3 * 2 + (i % 3 != 0)), uint8_t(seed), 0);
+        break;
+      default:  // runs and literals mixed
+        seed = seed * 1103515245u + 12345u;
+        frame[i] = (seed >> 16) % 4 == 0 ? Color(uint8_t(seed >> 8), uint8_t(seed >> 16), uint8_t(seed >> 24))
+                                         : Color(10, 20, 30);
+        break;
+    }
+  }
+  return frame;
+}
+
+static bool matches(const PreviewDecoder &decoder, const FrameBuffer &frame, int num_leds) {
+  if (!decoder.ok || decoder.frame.size() != size_t(num_leds) * 3) return false;
+  for (int i = 0; i < num_leds; i++) {
+    const uint8_t *c = &decoder.frame[i * 3];
+    if (c[0] != frame[i].r || c[1] != frame[i].g || c[2] != frame[i].b) return false;
+  }
+  return true;
+}
+
+static int test_encoder() {
+  int failures = 0;
+
+  // Prefix: the LED count, then the payload
+  for (int num_leds : {1, 9, 42, 256}) {
+    PreviewEncoder encoder;
+    encoder.capture(make_frame(num_leds, 1, 0), num_leds);
+    const char *message = encoder.encode(true);
+    std::string prefix = std::to_string(num_leds) + ",";
+    test::check(strncmp(message, prefix.c_str(), prefix.size()) == 0 && message[prefix.size()] != ',',
+                "keyframe starts with <num_leds>,", &failures);
+  }
+
+  // 256 different LEDs: two literal tokens of 128 pixels, within both bounds
+  PreviewEncoder encoder;
+  PreviewDecoder decoder;
+  FrameBuffer different = make_frame(256, 3, 0);
+  encoder.capture(different, 256);
+  const char *message = encoder.encode(true);
+  decoder.decode(message, true);
+  test::check(matches(decoder, different, 256), "all-different keyframe decodes", &failures);
+  test::check(decoder.rle.size() == 2 + 256 * 3 && decoder.rle[0] == 0xFF && decoder.rle[1 + 128 * 3] == 0xFF,
+              "literal runs of 128", &failures);
+  test::check(decoder.rle.size() <= PREVIEW_RLE_MAX && strlen(message) < PREVIEW_TEXT_MAX,
+              "all-different frame within PREVIEW_RLE_MAX and PREVIEW_TEXT_MAX", &failures);
+
+  // Densest token stream and mixed frames, as keyframes and as deltas
+  bool within = true, decoded = true;
+  for (uint32_t seed = 0; seed < 50; seed++) {
+    FrameBuffer frame = make_frame(256, seed, seed < 25 ? 1 : 2);
+    encoder.capture(frame, 256);
+    bool keyframe = seed % 10 == 0;
+    message = encoder.encode(keyframe);
+    if (message == nullptr) continue;
+    decoder.decode(message, keyframe);
+    within = within && decoder.rle.size() <= PREVIEW_RLE_MAX && strlen(message) < PREVIEW_TEXT_MAX;
+    decoded = decoded && matches(decoder, frame, 256);
+  }
+  test::check(within, "every frame within the bounds", &failures);
+  test::check(decoded, "keyframes and deltas decode to the captured frame", &failures);
+
+  // Identical frames: runs of 128 copies, and an empty delta
+  FrameBuffer black{};
+  encoder.capture(black, 256);
+  decoder.decode(encoder.encode(true), true);
+  test::check(decoder.rle.size() == 8 && decoder.rle[0] == 0x7F && decoder.rle[4] == 0x7F, "runs of 128",
+              &failures);
+  encoder.capture(black, 256);
+  test::check(encoder.encode(false) == nullptr, "empty delta is nullptr", &failures);
+  test::check(!encoder.dirty(), "empty delta consumes the capture", &failures);
+
+  // One LED changed: a short delta on top of the previous frame
+  black[100] = Color(1, 2, 3);
+  encoder.capture(black, 256);
+  message = encoder.encode(false);
+  test::check(message != nullptr && strchr(message, ',') == nullptr, "delta has no prefix", &failures);
+  if (message != nullptr) decoder.decode(message, false);
+  test::check(matches(decoder, black, 256) && decoder.rle.size() == 4 * 4, "one-LED delta decodes", &failures);
+  return failures;
+}
+
+static int test_stream() {
+  int failures = 0;
+  web_server_base::WebServerBase server;
+  web_server_base::global_web_server_base = &server;
+  PreviewStream stream;
+  stream.set_path("/wordclock/test/preview");
+  stream.set_max_fps(0.0f);
+  stream.setup();
+  auto *events = static_cast<AsyncEventSource *>(server.last_handler);
+  if (!test::check(events != nullptr, "event source registered", &failures)) return failures;
+
+  test::HostClock host;
+  host.clock.set_preview(&stream);
+  host.start(test::EPOCH_BEFORE_DST + 55);
+
+  PreviewDecoder decoder;
+  int keyframes = 0, deltas = 0, mismatches = 0;
+  events->sink = [&](const char *message, const char *event, uint32_t) {
+    bool keyframe = strcmp(event, "key") == 0;
+    keyframes += keyframe;
+    deltas += !keyframe;
+    decoder.decode(message, keyframe);
+  };
+  events->clients = 1;
+  host.replay.set_frame_callback([&](uint32_t, uint32_t) {
+    stream.loop();
+    if (events->clients == 0 || keyframes == 0) return;  // nothing presented yet, or nobody listening
+    bool same = decoder.ok && decoder.frame.size() == sizeof(host.strip.buf) &&
+                memcmp(decoder.frame.data(), host.strip.buf, sizeof(host.strip.buf)) == 0;
+    mismatches += !same;
+  });
+  host.replay.run(10);  // across a minute change
+  test::check(keyframes == 1 && deltas > 10, "one keyframe, then deltas", &failures);
+  test::check(mismatches == 0, "every frame decodes to the strip", &failures);
+
+  // Client gone: the next one starts from a keyframe
+  events->clients = 0;
+  host.replay.run(1);
+  events->clients = 1;
+  host.replay.run(1);
+  test::check(keyframes == 2, "keyframe for a new client", &failures);
+  web_server_base::global_web_server_base = nullptr;
+  return failures;
+}
+
+int main() {
+  test::set_timezone(test::TZ_PARIS);
+  host_log_quiet = true;
+  int failures = test_encoder() + test_stream();
+  return failures == 0 ? 0 : 1;
+}
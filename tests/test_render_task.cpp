@@ -0,0 +1,53 @@
+// Render task stress: the loop thread drives the replay and works every
+// control while the renderer composes frames on its own thread. Configure
+// with -DWORDCLOCK_TSAN=ON to run it under ThreadSanitizer.
+
+#include "host_clock.h"
+#include <thread>
+
+using namespace esphome::wordclock;
+
+int main() {
+  test::set_timezone(test::TZ_PARIS);
+  esphome::host_log_quiet = true;
+  test::HostClock host;
+  host.start(test::EPOCH_BEFORE_DST);
+  host.clock.set_words_fade_out_duration(0.2f);
+
+  int failures = 0;
+  if (!test::check(host.start_render_task(), "render task started", &failures)) return 1;
+
+  // Real time between frames, so the renderer interleaves with the controls
+  host.replay.set_speed(20.0f);
+  uint32_t shows_before = host.strip.shows;
+  for (int round = 0; round < 40; round++) {
+    int effect = round % 5;
+    int mode = round % 4;
+    int language = round % 2;
+    host.clock.set_words_effect(effect);
+    host.clock.set_layer_effect_speed(LIGHT_BACKGROUND, 10.0f + round);
+    host.clock.set_seconds_mode(mode);
+    if (round % 10 == 0) host.clock.set_language(language);
+    // ESPHome runs it again on each log subscription, here while the
+    // renderer may be switching language
+    host.clock.dump_config();
+    host.clock.set_typing_delay(0.01f * round);
+    host.clock.set_power_state(round % 7 != 6);
+    host.lights[round % 4].write_state(&host.light_states[round % 4]);
+
+    // The getters report what was requested, without racing the renderer
+    test::check(host.clock.get_words_effect() == (WordClock::has_effect(effect) ? effect : 0),
+                "words effect read back", &failures);
+    test::check(host.clock.get_seconds_mode() == mode, "seconds mode read back", &failures);
+    test::check(round % 10 != 0 || host.clock.get_language() == language, "language read back", &failures);
+    test::check(host.clock.get_layer_effect_speed(LIGHT_BACKGROUND) == 10.0f + round, "layer speed read back",
+                &failures);
+    test::check(host.clock.describe_active_words().empty(), "active words refused to the loop thread", &failures);
+    host.clock.get_led_fade_count();
+    host.clock.get_estimated_power();
+
+    host.replay.run(1);
+  }
+  test::check(host.strip.shows > shows_before, "render task presented frames", &failures);
+  return failures == 0 ? 0 : 1;
+}
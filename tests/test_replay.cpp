@@ -0,0 +1,35 @@
+// Replay: two simulated hours across the DST change and the millis() wrap,
+// per seconds mode, against the checksum of the frame stream
+
+#include "host_clock.h"
+
+using namespace esphome::wordclock;
+
+/// Frame stream checksums of the current renderer, per SecondsMode.
+/// A change is a visible regression unless the rendering was changed on
+/// purpose; then update them from the output of this test.
+static const uint32_t EXPECTED_CHECKSUMS[SECONDS_MODE_COUNT] = {0xa43bac82, 0x71499247, 0xbb8fbe03, 0x73588da8};
+
+int main() {
+  test::set_timezone(test::TZ_PARIS);
+  esphome::host_log_quiet = true;
+  int failures = 0;
+
+  for (int mode = 0; mode < SECONDS_MODE_COUNT; mode++) {
+    test::HostClock host;
+    host.start(test::EPOCH_BEFORE_DST, UINT32_MAX - 60000);
+    host.clock.set_seconds_mode(mode);
+    const ReplayStats &stats = host.replay.run(7200);
+
+    printf("mode %d: frames=%u ticks=%u avg=%.1fus max=%uus checksum=%08x fades=%zu/%zu/%zu\n", mode, stats.frames,
+           stats.ticks, stats.average_frame_us(), stats.max_frame_us, stats.checksum, stats.max_led_fades,
+           stats.max_seconds_fades, stats.max_typing_leds);
+    test::check(stats.ticks == 7200, "one tick per simulated second", &failures);
+    test::check(stats.millis_wrapped, "millis() wrapped during the replay", &failures);
+    test::check(stats.checksum == EXPECTED_CHECKSUMS[mode], "frame stream checksum", &failures);
+    // Fade containers are bounded by the LED count: no growth over time
+    test::check(stats.max_led_fades <= 256 && stats.max_seconds_fades <= 60 && stats.max_typing_leds <= 256,
+                "fade containers bounded", &failures);
+  }
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,66 @@
+// Render throttle: an OTA upload pauses the animations on the render task
+// and they resume afterwards, even when the full render queue drops the
+// CMD_THROTTLE the loop sends at each change
+
+#include "host_clock.h"
+#include "esphome/components/ota/ota_backend.h"
+#include <thread>
+
+using namespace esphome;
+using namespace esphome::wordclock;
+
+int main() {
+  test::set_timezone(test::TZ_PARIS);
+  host_log_quiet = true;
+  int failures = 0;
+
+  // One clock for the whole test: it registers with the global OTA callback
+  test::HostClock host;
+  host.clock.set_throttle(0, 0, true);  // OTA only, no hold
+  host.start(test::EPOCH_BEFORE_DST);
+  host.clock.set_words_effect(1);
+  if (!test::check(host.start_render_task(), "render task started", &failures)) return 1;
+  RenderThrottle &throttle = host.clock.get_throttle();
+
+  host.replay.set_speed(20.0f);
+  host.replay.run(2);
+  test::check(throttle.frames_skipped() == 0, "animating before the upload", &failures);
+
+  // Upload starts; the loop's CMD_THROTTLE meets a full queue
+  ota::get_global_ota_callback()->fire(ota::OTA_STARTED);
+  host.flood_render_queue();
+  host.replay.run(3);
+  uint32_t skipped = throttle.frames_skipped();
+  test::check(throttle.throttled(), "loop side throttled during the upload", &failures);
+  test::check(skipped > 10, "renderer skips animation frames during the upload", &failures);
+
+  // Upload done; the release meets a full queue too
+  ota::get_global_ota_callback()->fire(ota::OTA_COMPLETED);
+  host.flood_render_queue();
+  host.replay.run(1);
+  skipped = throttle.frames_skipped();
+  host.replay.run(3);
+  test::check(!throttle.throttled(), "loop side released after the upload", &failures);
+  test::check(throttle.frames_skipped() == skipped, "animations resume after the upload", &failures);
+  test::check(throttle.episodes() == 1, "one throttle episode", &failures);
+
+  // Network burst: slow loops, each one preceded by a flood while it lasts.
+  // The renderer only learns of it from CMD_THROTTLE, sent again once the
+  // queue has room.
+  host.clock.set_throttle(100, 0, true);
+  bool flooding = true;
+  host.replay.set_frame_callback([&](uint32_t, uint32_t) {
+    if (flooding) host.flood_render_queue();
+  });
+  host.replay.set_frame_interval_ms(300);
+  host.replay.set_speed(0.0f);  // no pause between a flood and the next loop
+  host.replay.run(5);
+  test::check(throttle.throttled(), "slow loops throttle", &failures);
+  flooding = false;
+  host.replay.set_speed(20.0f);
+  host.replay.run(1);
+  skipped = throttle.frames_skipped();
+  host.replay.run(3);
+  test::check(throttle.frames_skipped() > skipped, "renderer throttled once the queue drains", &failures);
+  return failures == 0 ? 0 : 1;
+}
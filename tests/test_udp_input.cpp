@@ -0,0 +1,228 @@
+// UDP input over loopback: DDP and E1.31 frames sent to the clock's
+// socket, header validation, sequence windows, the strip contents and the
+// fallback to the clock once the stream times out
+
+#include "host_clock.h"
+#include "led_utils.h"
+#include "udp_input.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <cstring>
+#include <thread>
+
+using namespace esphome::wordclock;
+
+static constexpr uint16_t DDP_PORT = 14048;
+static constexpr uint16_t E131_PORT = 15568;
+static constexpr uint32_t TIMEOUT_MS = 300;
+static constexpr int PIXEL_BYTES = 256 * 3;
+
+/// Datagrams to 127.0.0.1:port
+class LoopbackSender {
+ public:
+  explicit LoopbackSender(uint16_t port) : fd_(::socket(AF_INET, SOCK_DGRAM, 0)) {
+    to_.sin_family = AF_INET;
+    to_.sin_port = htons(port);
+    to_.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  }
+  ~LoopbackSender() { ::close(fd_); }
+  void send(const uint8_t *data, size_t len) {
+    ::sendto(fd_, data, len, 0, reinterpret_cast<const sockaddr *>(&to_), sizeof(to_));
+    sent_++;
+  }
+  uint32_t sent() const { return sent_; }
+
+ protected:
+  int fd_;
+  sockaddr_in to_{};
+  uint32_t sent_{0};
+};
+
+/// Byte of pixel p (row-major), channel c in test frame f; never 0
+static uint8_t pattern(int f, int p, int c) { return uint8_t((f * 7 + p * 3 + c) & 0xFF) | 1; }
+
+/// Runs loop() until the clock has read every datagram sent, then once more
+static void deliver(test::HostClock &host, const LoopbackSender &sender) {
+  const auto &stats = host.clock.get_udp_input().stats();
+  for (int i = 0; i < 1000 && stats.packets < sender.sent(); i++) {
+    host.clock.loop();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  host.clock.loop();
+}
+
+/// Pixels of the 16x16 row-major frame f the strip does not show
+static int mismatches(const test::HostClock &host, int f) {
+  int wrong = 0;
+  for (int p = 0; p < 256; p++) {
+    int led = get_led_index(p % 16, p / 16);
+    if (is_excluded_led(led)) continue;
+    for (int c = 0; c < 3; c++) wrong += host.strip.buf[led * 3 + c] != pattern(f, p, c);
+  }
+  return wrong;
+}
+
+static void send_ddp(LoopbackSender &sender, uint8_t flags, uint8_t sequence, uint32_t offset, uint16_t length,
+                     int f, uint8_t id = 1) {
+  uint8_t packet[1500] = {};
+  size_t header = (flags & 0x10) ? 14 : 10;
+  packet[0] = flags;
+  packet[1] = sequence;
+  packet[2] = 0x0B;  // RGB, 8 bits
+  packet[3] = id;
+  packet[4] = uint8_t(offset >> 24);
+  packet[5] = uint8_t(offset >> 16);
+  packet[6] = uint8_t(offset >> 8);
+  packet[7] = uint8_t(offset);
+  packet[8] = uint8_t(length >> 8);
+  packet[9] = uint8_t(length);
+  for (uint32_t i = 0; i < length; i++) packet[header + i] = pattern(f, (offset + i) / 3, (offset + i) % 3);
+  sender.send(packet, header + length);
+}
+
+/// Frame f in two packets, PUSH on the second
+static void send_ddp_frame(LoopbackSender &sender, uint8_t *sequence, int f) {
+  *sequence = *sequence % 15 + 1;
+  send_ddp(sender, 0x40, *sequence, 0, 480, f);
+  *sequence = *sequence % 15 + 1;
+  send_ddp(sender, 0x41, *sequence, 480, PIXEL_BYTES - 480, f);
+}
+
+static void send_e131(LoopbackSender &sender, uint16_t universe, uint8_t sequence, int f, uint8_t options = 0) {
+  uint8_t packet[126 + 512] = {};
+  int index = universe - 1;
+  int channels = index == 0 ? 510 : PIXEL_BYTES - 510;
+  packet[1] = 0x10;  // preamble size
+  memcpy(packet + 4, "ASC-E1.17", 9);
+  packet[21] = 0x04;  // root vector: data
+  packet[43] = 0x02;  // framing vector: data
+  packet[111] = sequence;
+  packet[112] = options;
+  packet[113] = uint8_t(universe >> 8);
+  packet[114] = uint8_t(universe);
+  packet[117] = 0x02;  // DMP set property
+  packet[123] = uint8_t((channels + 1) >> 8);
+  packet[124] = uint8_t(channels + 1);
+  for (int i = 0; i < channels; i++) {
+    int byte = index * 510 + i;
+    packet[126 + i] = pattern(f, byte / 3, byte % 3);
+  }
+  sender.send(packet, 126 + channels);
+}
+
+static int test_ddp() {
+  int failures = 0;
+  test::HostClock host;
+  host.clock.set_udp_input(UDP_PROTOCOL_DDP, DDP_PORT, 1, TIMEOUT_MS, UDP_LAYOUT_ROWS);
+  host.start(test::EPOCH_BEFORE_DST);
+  host.replay.run(5);
+  LoopbackSender sender(DDP_PORT);
+  const auto &stats = host.clock.get_udp_input().stats();
+
+  uint8_t sequence = 0;
+  send_ddp_frame(sender, &sequence, 0);
+  deliver(host, sender);
+  test::check(host.clock.is_udp_streaming(), "DDP: streaming after the first frame", &failures);
+  test::check(stats.frames == 1 && stats.frames_shown == 1, "DDP: frame assembled and shown", &failures);
+  test::check(mismatches(host, 0) == 0, "DDP: strip shows the frame, row-major remapped", &failures);
+
+  // Header validation: version, query, destination id, offset past the strip, short datagram
+  send_ddp(sender, 0x80, 0, 0, 3, 1);
+  send_ddp(sender, 0x42, 0, 0, 3, 1);
+  send_ddp(sender, 0x40, 0, 0, 3, 1, 7);
+  send_ddp(sender, 0x40, 0, PIXEL_BYTES, 3, 1);
+  sender.send(reinterpret_cast<const uint8_t *>("junk"), 4);
+  deliver(host, sender);
+  test::check(stats.dropped_packets == 5, "DDP: malformed and foreign datagrams dropped", &failures);
+  test::check(mismatches(host, 0) == 0, "DDP: dropped datagrams change nothing", &failures);
+
+  // Sequence window: up to 7 behind the last packet is late, up to 7 ahead is accepted
+  auto step = [](uint8_t from, int delta) { return uint8_t((from - 1 + delta + 30) % 15 + 1); };
+  send_ddp(sender, 0x41, step(sequence, -3), 0, PIXEL_BYTES, 2);
+  deliver(host, sender);
+  test::check(stats.late_packets == 1, "DDP: 3 behind is late", &failures);
+  test::check(mismatches(host, 0) == 0, "DDP: late packet not shown", &failures);
+  sequence = step(sequence, 7);
+  send_ddp(sender, 0x41, sequence, 0, PIXEL_BYTES, 3);
+  deliver(host, sender);
+  test::check(stats.late_packets == 1 && mismatches(host, 3) == 0, "DDP: 7 ahead is accepted", &failures);
+
+  // Timecode flag: 4 more header bytes; no PUSH, completes at the end of the strip
+  sequence = sequence % 15 + 1;
+  send_ddp(sender, 0x50, sequence, 0, PIXEL_BYTES, 4);
+  deliver(host, sender);
+  test::check(mismatches(host, 4) == 0, "DDP: timecode header skipped", &failures);
+
+  // Two frames between loops: the first is superseded
+  uint32_t dropped_before = stats.dropped_frames;
+  send_ddp_frame(sender, &sequence, 5);
+  send_ddp_frame(sender, &sequence, 6);
+  for (int i = 0; i < 1000 && stats.packets < sender.sent(); i++) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    if (i > 20) host.clock.loop();
+  }
+  host.clock.loop();
+  test::check(mismatches(host, 6) == 0, "DDP: newest frame shown", &failures);
+  test::check(stats.dropped_frames == dropped_before + 1, "DDP: superseded frame counted", &failures);
+
+  // Timeout: the clock takes the strip back
+  std::this_thread::sleep_for(std::chrono::milliseconds(TIMEOUT_MS + 50));
+  host.replay.run(1);
+  test::check(!host.clock.is_udp_streaming(), "DDP: falls back after the timeout", &failures);
+  test::check(mismatches(host, 6) > 300, "DDP: strip shows the clock again", &failures);
+  return failures;
+}
+
+static int test_e131() {
+  int failures = 0;
+  test::HostClock host;
+  host.clock.set_udp_input(UDP_PROTOCOL_E131, E131_PORT, 1, TIMEOUT_MS, UDP_LAYOUT_ROWS);
+  host.start(test::EPOCH_BEFORE_DST);
+  host.replay.run(5);
+  LoopbackSender sender(E131_PORT);
+  const auto &stats = host.clock.get_udp_input().stats();
+
+  send_e131(sender, 1, 100, 0);
+  deliver(host, sender);
+  test::check(stats.frames == 0, "E1.31: one universe of two is no frame", &failures);
+  send_e131(sender, 2, 100, 0);
+  deliver(host, sender);
+  test::check(host.clock.is_udp_streaming() && stats.frames == 1, "E1.31: frame from both universes", &failures);
+  test::check(mismatches(host, 0) == 0, "E1.31: strip shows the frame", &failures);
+
+  // Header validation: ACN id, preview option, foreign universe, DMX start code
+  uint8_t bad[126 + 3] = {};
+  memcpy(bad + 4, "ASC-E1.18", 9);
+  sender.send(bad, sizeof(bad));
+  send_e131(sender, 1, 101, 1, 0x80);
+  send_e131(sender, 7, 101, 1);
+  deliver(host, sender);
+  test::check(stats.dropped_packets == 3, "E1.31: malformed and foreign packets dropped", &failures);
+
+  // Sequence window per universe: up to 20 behind is out of order, further is a restart
+  send_e131(sender, 1, 90, 2);
+  deliver(host, sender);
+  test::check(stats.late_packets == 1, "E1.31: 10 behind is late", &failures);
+  send_e131(sender, 1, 70, 3);
+  send_e131(sender, 2, 71, 3);
+  deliver(host, sender);
+  test::check(stats.late_packets == 1 && mismatches(host, 3) == 0, "E1.31: 30 behind restarts the numbering",
+              &failures);
+
+  // Stream terminated: the clock takes the strip back at once
+  send_e131(sender, 1, 72, 3, 0x40);
+  deliver(host, sender);
+  host.replay.run(1);
+  test::check(!host.clock.is_udp_streaming(), "E1.31: falls back on stream termination", &failures);
+  test::check(mismatches(host, 3) > 300, "E1.31: strip shows the clock again", &failures);
+  return failures;
+}
+
+int main() {
+  test::set_timezone(test::TZ_PARIS);
+  esphome::host_log_quiet = true;
+  int failures = test_ddp() + test_e131();
+  return failures == 0 ? 0 : 1;
+}
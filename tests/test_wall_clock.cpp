@@ -0,0 +1,73 @@
+// Wall clock: SNTP corrections are slewed at most WALL_CLOCK_MAX_SLEW_MS
+// per second, time never moves backwards and every second is displayed
+// exactly once, across the millis() wrap
+
+#include "host_clock.h"
+#include "wall_clock.h"
+
+using namespace esphome::wordclock;
+
+int main() {
+  test::set_timezone(test::TZ_PARIS);
+  ReplayTimeSource source;
+  source.set_epoch(test::EPOCH_BEFORE_DST - 120);
+  source.set_millis(UINT32_MAX - 30000);
+  WallClock clock;
+
+  int failures = 0;
+  int ticks = 0, repeats = 0, skips = 0, prev_second = -1;
+  int64_t slewed_ms = 0, slewing_ms = 0;
+  bool backwards = false, over_budget = false, still_slewing = false;
+  const uint32_t frame_ms = 3;  // well below the 20 ms that earn 1 ms of slew
+  for (uint32_t t = 0; t < 1200 * 1000; t += frame_ms) {
+    // First frame of simulated second s
+    auto at = [t, frame_ms](uint32_t s) { return t / 1000 == s && t % 1000 < frame_ms; };
+    uint32_t now = source.get_millis();
+    if (clock.needs_sample(now)) clock.observe(source.get_time().timestamp, now);
+
+    // epoch_ms_at() interpolates without the slew: the difference is the correction
+    int64_t interpolated = clock.epoch_ms_at(now);
+    int32_t remaining = clock.get_slew_remaining_ms();
+    if (clock.update(now)) {
+      ticks++;
+      int second = clock.second();
+      if (prev_second >= 0) {
+        int step = (second - prev_second + 60) % 60;
+        if (step == 0) repeats++;
+        if (step > 1) skips++;
+      }
+      prev_second = second;
+    }
+    int64_t correction = clock.epoch_ms_at(now) - interpolated;
+    // A call with no elapsed time earns no slew
+    if (clock.update(now) || clock.epoch_ms_at(now) != interpolated + correction) backwards = true;
+
+    if (remaining != 0) {
+      slewing_ms += frame_ms;
+      slewed_ms += correction < 0 ? -correction : correction;
+      if (slewed_ms * 1000 > slewing_ms * int64_t(config::WALL_CLOCK_MAX_SLEW_MS)) over_budget = true;
+    } else {
+      slewing_ms = slewed_ms = 0;
+    }
+    if (correction < -int64_t(frame_ms)) backwards = true;
+
+    // SNTP corrections, each followed by its sync callback
+    int32_t shift = at(100) ? 800 : at(300) ? -600 : at(600) ? 5000 : 0;
+    if (shift != 0) {
+      source.correct(shift);
+      clock.request_resync();
+    }
+    if (at(299) || at(599)) still_slewing = still_slewing || remaining != 0;
+    source.advance(frame_ms);
+  }
+
+  test::check(!backwards, "no slew without elapsed time, never backwards", &failures);
+  test::check(!over_budget, "slew stays within WALL_CLOCK_MAX_SLEW_MS per second", &failures);
+  test::check(repeats == 0, "no displayed second repeats", &failures);
+  test::check(skips == 1, "only the 5 s step skips seconds", &failures);
+  test::check(ticks >= 1190, "one tick per second", &failures);
+  test::check(!still_slewing, "small corrections converge", &failures);
+  test::check(clock.epoch_ms_at(source.get_millis()) / 1000 == source.get_epoch(), "clock follows the RTC",
+              &failures);
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,124 @@
+// Warm start: a new clock in the same process finds the record the last
+// one saved, shows its frame at once and keeps its time without a time
+// source; a damaged or implausible record gives a cold start
+
+#include "host_clock.h"
+#include "warm_start.h"
+#include <cstring>
+
+using namespace esphome::wordclock;
+
+static constexpr int SLOT = 0;
+
+/// The record of a slot, to damage it as a power loss would
+struct RecordAccess : WarmStart {
+  explicit RecordAccess(int slot) { set_slot(slot); }
+  WarmStartRecord &record() { return *record_; }
+};
+
+struct Saved {
+  std::string words;
+  uint8_t strip[768];
+};
+
+/// Runs a clock for a few seconds with a still display; returns what it showed
+static Saved run_cold(int *failures) {
+  Saved saved{};
+  test::HostClock host;
+  host.clock.set_warm_start(SLOT);
+  host.start(test::EPOCH_BEFORE_DST + 30);
+  host.clock.set_words_effect(EFFECT_NONE);
+  host.clock.set_seconds_effect(EFFECT_NONE);
+  host.clock.set_seconds_fade_out_duration(0.0f);
+  test::check(!host.clock.is_warm_started(), "first boot is cold", failures);
+  host.replay.run(10);
+  saved.words = host.clock.describe_active_words();
+  memcpy(saved.strip, host.strip.buf, sizeof(saved.strip));
+  return saved;
+}
+
+/// A new clock without a valid time source (before SNTP)
+struct Rebooted {
+  test::HostClock host;
+  bool frame_restored;
+
+  Rebooted() {
+    host.clock.set_warm_start(SLOT);
+    memset(host.strip.buf, 0, sizeof(host.strip.buf));
+    host.start(0);
+    bool black = true;
+    for (uint8_t byte : host.strip.buf) black = black && byte == 0;
+    frame_restored = !black;
+  }
+};
+
+static int test_restore() {
+  int failures = 0;
+  Saved saved = run_cold(&failures);
+
+  Rebooted reboot;
+  test::check(reboot.host.clock.is_warm_started(), "new clock warm-started", &failures);
+  test::check(memcmp(reboot.host.strip.buf, saved.strip, sizeof(saved.strip)) == 0,
+              "first frame from the record, before any loop", &failures);
+  reboot.host.replay.run(1);
+  test::check(reboot.host.clock.describe_active_words() == saved.words, "time restored without a time source",
+              &failures);
+  return failures;
+}
+
+static int test_rejected() {
+  int failures = 0;
+  RecordAccess access(SLOT);
+
+  access.invalidate();
+  run_cold(&failures);
+  access.record().frame[7] ^= 0x01;
+  {
+    Rebooted reboot;
+    test::check(!reboot.host.clock.is_warm_started() && !reboot.frame_restored, "corrupted byte: cold start",
+                &failures);
+  }
+
+  access.invalidate();
+  run_cold(&failures);
+  access.record().frame_leds--;
+  {
+    Rebooted reboot;
+    test::check(!reboot.host.clock.is_warm_started() && !reboot.frame_restored, "changed frame_leds: cold start",
+                &failures);
+  }
+
+  // Valid checksum, but from before 2020
+  access.save_time(1546300800LL * 1000);  // 2019-01-01
+  {
+    Rebooted reboot;
+    test::check(!reboot.host.clock.is_warm_started(), "record older than 2020: cold start", &failures);
+  }
+  return failures;
+}
+
+static int test_shutdown() {
+  int failures = 0;
+  RecordAccess access(SLOT);
+  test::HostClock host;
+  host.clock.set_warm_start(SLOT);
+  host.start(test::EPOCH_BEFORE_DST + 30);
+  host.replay.run(10);
+
+  // Between two ticks, with nothing saved: the reset time is written
+  access.invalidate();
+  host.source.advance(600);
+  host.clock.on_shutdown();
+  int64_t epoch_ms = 0;
+  test::check(access.restore(&epoch_ms), "on_shutdown() saves", &failures);
+  int64_t expected_ms = int64_t(host.source.get_epoch()) * 1000;
+  test::check(epoch_ms >= expected_ms && epoch_ms < expected_ms + 1000, "the time at the shutdown", &failures);
+  return failures;
+}
+
+int main() {
+  test::set_timezone(test::TZ_PARIS);
+  esphome::host_log_quiet = true;
+  int failures = test_restore() + test_rejected() + test_shutdown();
+  return failures == 0 ? 0 : 1;
+}
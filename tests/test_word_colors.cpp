@@ -0,0 +1,83 @@
+// Word colours: the words a word_colors: slot lists show its colour, in
+// the start words as in the hours layer, while the other hour words keep
+// the hours light colour
+
+#include "host_clock.h"
+
+using namespace esphome;
+using namespace esphome::wordclock;
+
+/// LEDs of the French start words and hour words (lang_french.h)
+static const int IL_EST[] = {17, 18, 20, 21, 22};
+static const int HEURE[] = {88, 89, 90, 91, 92};
+static const int HOUR_1[] = {46, 45, 44};
+static const int HOUR_3[] = {40, 39, 38, 37, 36};
+static const int PLURAL_S[] = {93};
+
+static void set_light(test::HostClock &host, int type, bool on, float r, float g, float b) {
+  auto call = host.light_states[type].make_call();
+  call.set_state(on);
+  call.set_rgb(r, g, b);
+  call.set_brightness(1.0f);
+  call.perform();
+}
+
+/// Every LED lit with the colour of a single channel (0 red, 1 green, 2 blue)
+template<size_t N> static bool lit_in(const test::HostClock &host, const int (&leds)[N], int channel) {
+  for (int led : leds) {
+    const uint8_t *c = host.strip.buf + led * 3;
+    for (int ch = 0; ch < 3; ch++) {
+      if ((c[ch] != 0) != (ch == channel)) return false;
+    }
+  }
+  return true;
+}
+
+/// Still French display at epoch: hours green, minutes and seconds off,
+/// "il"/"est" red and "heure" blue
+struct ColoredClock {
+  test::HostClock host;
+
+  explicit ColoredClock(time_t epoch) {
+    host.clock.add_word_color(0xFF0000, {"il", "est"}, {});
+    host.clock.add_word_color(0x0000FF, {"heure"}, {});
+    host.start(epoch);
+    host.clock.set_words_effect(EFFECT_NONE);
+    host.clock.set_seconds_effect(EFFECT_NONE);
+    host.clock.set_words_fade_in_duration(0.0f);
+    host.clock.set_seconds_fade_out_duration(0.0f);
+    set_light(host, LIGHT_HOURS, true, 0.0f, 1.0f, 0.0f);
+    set_light(host, LIGHT_MINUTES, false, 1.0f, 1.0f, 1.0f);
+    set_light(host, LIGHT_SECONDS, false, 1.0f, 1.0f, 1.0f);
+    set_light(host, LIGHT_BACKGROUND, false, 1.0f, 1.0f, 1.0f);
+    host.replay.run(3);
+  }
+};
+
+static int test_one_oclock() {
+  int failures = 0;
+  ColoredClock colored(test::EPOCH_BEFORE_DST + 10);  // 01:00, "il est 1 heure"
+  test::HostClock &host = colored.host;
+  test::check(host.clock.get_word_color_count() == 2, "two slots", &failures);
+  test::check(lit_in(host, IL_EST, 0), "il/est in the first slot colour", &failures);
+  test::check(lit_in(host, HEURE, 2), "heure in the second slot colour", &failures);
+  test::check(lit_in(host, HOUR_1, 1), "the hour keeps the hours colour", &failures);
+  return failures;
+}
+
+static int test_plural() {
+  int failures = 0;
+  ColoredClock colored(test::EPOCH_BEFORE_DST + 3600 + 10);  // 03:00 CEST, "il est 3 heures"
+  test::HostClock &host = colored.host;
+  test::check(lit_in(host, IL_EST, 0) && lit_in(host, HEURE, 2), "slot colours after the hour change",
+              &failures);
+  test::check(lit_in(host, HOUR_3, 1) && lit_in(host, PLURAL_S, 1), "3 and s keep the hours colour", &failures);
+  return failures;
+}
+
+int main() {
+  test::set_timezone(test::TZ_PARIS);
+  host_log_quiet = true;
+  int failures = test_one_oclock() + test_plural();
+  return failures == 0 ? 0 : 1;
+}